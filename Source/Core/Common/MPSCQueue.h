@@ -0,0 +1,84 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// a simple lockless thread-safe,
+// multiple producer, single consumer queue
+//
+// Producers push onto an intrusive stack with a single compare-and-swap. The consumer detaches the
+// whole stack at once and reverses it, so items are consumed in the order they were pushed.
+
+#include <atomic>
+#include <utility>
+
+namespace Common
+{
+template <typename T>
+class MPSCQueue final
+{
+public:
+  MPSCQueue() = default;
+  ~MPSCQueue() { Clear(); }
+
+  MPSCQueue(const MPSCQueue&) = delete;
+  MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+  // The following are safe from any thread:
+  void Push(const T& arg) { Emplace(arg); }
+  void Push(T&& arg) { Emplace(std::move(arg)); }
+  template <typename... Args>
+  void Emplace(Args&&... args)
+  {
+    Node* const node =
+        new Node{T(std::forward<Args>(args)...), m_head.load(std::memory_order_relaxed)};
+    while (!m_head.compare_exchange_weak(node->next, node, std::memory_order_release,
+                                         std::memory_order_relaxed))
+    {
+    }
+  }
+
+  bool Empty() const { return m_head.load(std::memory_order_acquire) == nullptr; }
+
+  // The following are only safe from the "consumer thread":
+
+  // Calls func with each item pushed so far, oldest first, and removes them from the queue.
+  template <typename Func>
+  void ConsumeAll(Func&& func)
+  {
+    Node* node = m_head.exchange(nullptr, std::memory_order_acquire);
+
+    Node* oldest = nullptr;
+    while (node != nullptr)
+    {
+      Node* const next = node->next;
+      node->next = oldest;
+      oldest = node;
+      node = next;
+    }
+
+    while (oldest != nullptr)
+    {
+      Node* const next = oldest->next;
+      func(std::move(oldest->value));
+      delete oldest;
+      oldest = next;
+    }
+  }
+
+  void Clear()
+  {
+    ConsumeAll([](T&&) {});
+  }
+
+private:
+  struct Node
+  {
+    T value;
+    Node* next;
+  };
+
+  std::atomic<Node*> m_head{nullptr};
+};
+
+}  // namespace Common
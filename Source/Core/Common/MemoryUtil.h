@@ -34,5 +34,7 @@ bool ReadProtectMemory(void* ptr, size_t size);
 bool WriteProtectMemory(void* ptr, size_t size, bool executable = false);
 bool UnWriteProtectMemory(void* ptr, size_t size, bool allowExecute = false);
 size_t MemPhysical();
+// Returns the granularity of memory protection.
+size_t MemPageSize();
 
 }  // namespace Common
@@ -0,0 +1,234 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// A priority queue of timed items, implemented as a hierarchical timing wheel.
+//
+// Time is divided into granules of 2^GRANULE_SHIFT ticks. The wheel has NUM_LEVELS levels of
+// NUM_SLOTS slots each; an item lands on the level of the highest byte in which its granule differs
+// from the current granule, so insertion is O(1) no matter how many items are pending. Items whose
+// granule has been reached are kept in a small binary heap, which is what provides the exact
+// ordering: items are popped in ascending operator<=> order, exactly like a min-heap of all items
+// would. T must have an s64 member named time and a strict total order consistent with it.
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "Common/Assert.h"
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+template <typename T>
+class TimingWheel final
+{
+public:
+  static constexpr u32 GRANULE_SHIFT = 10;
+  static constexpr u32 LEVEL_BITS = 8;
+  static constexpr u32 NUM_LEVELS = 4;
+  static constexpr u32 NUM_SLOTS = 1u << LEVEL_BITS;
+
+  bool Empty() const { return m_size == 0; }
+  std::size_t Size() const { return m_size; }
+
+  // Removes all items and moves the wheel to the given time. Items earlier than this time may still
+  // be pushed afterwards; they are simply kept in the heap of due items.
+  void Reset(s64 time)
+  {
+    m_due.clear();
+    for (Level& level : m_levels)
+    {
+      ForEachOccupiedSlot(level, [](std::vector<T>& slot) { slot.clear(); });
+      level.occupied = {};
+    }
+    m_overflow.clear();
+    m_now = time >> GRANULE_SHIFT;
+    m_size = 0;
+  }
+
+  void Push(T item)
+  {
+    Insert(std::move(item));
+    ++m_size;
+  }
+
+  // The earliest item. Must not be called on an empty wheel.
+  const T& Top()
+  {
+    DEBUG_ASSERT(!Empty());
+    if (m_due.empty())
+      AdvanceToNextItem();
+    return m_due.front();
+  }
+
+  T Pop()
+  {
+    Top();
+    std::ranges::pop_heap(m_due, std::ranges::greater{});
+    T item = std::move(m_due.back());
+    m_due.pop_back();
+    --m_size;
+    return item;
+  }
+
+  template <typename Predicate>
+  std::size_t EraseIf(Predicate pred)
+  {
+    std::size_t erased = std::erase_if(m_due, pred);
+    // Removing random items breaks the invariant so we have to re-establish it.
+    if (erased != 0)
+      std::ranges::make_heap(m_due, std::ranges::greater{});
+
+    for (Level& level : m_levels)
+    {
+      for (u32 slot = FindOccupiedSlot(level, 0); slot < NUM_SLOTS;
+           slot = FindOccupiedSlot(level, slot + 1))
+      {
+        erased += std::erase_if(level.slots[slot], pred);
+        if (level.slots[slot].empty())
+          level.occupied[slot / 64] &= ~(u64(1) << (slot % 64));
+      }
+    }
+
+    erased += std::erase_if(m_overflow, pred);
+
+    m_size -= erased;
+    return erased;
+  }
+
+  // Calls func with every pending item, in no particular order.
+  template <typename Func>
+  void ForEach(Func&& func) const
+  {
+    for (const T& item : m_due)
+      func(item);
+    for (const Level& level : m_levels)
+    {
+      for (u32 slot = FindOccupiedSlot(level, 0); slot < NUM_SLOTS;
+           slot = FindOccupiedSlot(level, slot + 1))
+      {
+        for (const T& item : level.slots[slot])
+          func(item);
+      }
+    }
+    for (const T& item : m_overflow)
+      func(item);
+  }
+
+private:
+  struct Level
+  {
+    std::array<std::vector<T>, NUM_SLOTS> slots;
+    std::array<u64, NUM_SLOTS / 64> occupied{};
+  };
+
+  static u32 GetSlot(s64 granule, u32 level)
+  {
+    return static_cast<u32>(static_cast<u64>(granule) >> (level * LEVEL_BITS)) & (NUM_SLOTS - 1);
+  }
+
+  static u32 FindOccupiedSlot(const Level& level, u32 first_slot)
+  {
+    for (u32 word = first_slot / 64; word < level.occupied.size(); ++word)
+    {
+      u64 bits = level.occupied[word];
+      if (word == first_slot / 64)
+        bits &= ~u64(0) << (first_slot % 64);
+      if (bits != 0)
+        return word * 64 + std::countr_zero(bits);
+    }
+    return NUM_SLOTS;
+  }
+
+  template <typename Func>
+  static void ForEachOccupiedSlot(Level& level, Func&& func)
+  {
+    for (u32 slot = FindOccupiedSlot(level, 0); slot < NUM_SLOTS;
+         slot = FindOccupiedSlot(level, slot + 1))
+    {
+      func(level.slots[slot]);
+    }
+  }
+
+  void Insert(T&& item)
+  {
+    const s64 granule = item.time >> GRANULE_SHIFT;
+    if (granule <= m_now)
+    {
+      m_due.push_back(std::move(item));
+      std::ranges::push_heap(m_due, std::ranges::greater{});
+      return;
+    }
+
+    const u64 difference = static_cast<u64>(granule) ^ static_cast<u64>(m_now);
+    const u32 level = static_cast<u32>(63 - std::countl_zero(difference)) / LEVEL_BITS;
+    if (level >= NUM_LEVELS)
+    {
+      m_overflow.push_back(std::move(item));
+      return;
+    }
+
+    const u32 slot = GetSlot(granule, level);
+    m_levels[level].slots[slot].push_back(std::move(item));
+    m_levels[level].occupied[slot / 64] |= u64(1) << (slot % 64);
+  }
+
+  // Moves the current granule forward until at least one item is due. Every item on a level shares
+  // all bytes above that level with the current granule, and the slots at or before the current
+  // granule's byte are always empty, so the first occupied slot of the lowest non-empty level holds
+  // the earliest items.
+  void AdvanceToNextItem()
+  {
+    while (m_due.empty())
+    {
+      bool found = false;
+      for (u32 level_index = 0; level_index < NUM_LEVELS && !found; ++level_index)
+      {
+        Level& level = m_levels[level_index];
+        const u32 slot = FindOccupiedSlot(level, GetSlot(m_now, level_index) + 1);
+        if (slot == NUM_SLOTS)
+          continue;
+
+        // All lower levels are empty, so jumping to the start of this slot skips nothing.
+        const u32 shift = level_index * LEVEL_BITS;
+        const u64 low_mask = (u64(NUM_SLOTS) << shift) - 1;
+        m_now = static_cast<s64>((static_cast<u64>(m_now) & ~low_mask) | (u64(slot) << shift));
+
+        // Items in this slot can only move to the due heap or to lower levels, never back into it.
+        std::vector<T>& items = level.slots[slot];
+        for (T& item : items)
+          Insert(std::move(item));
+        items.clear();
+        level.occupied[slot / 64] &= ~(u64(1) << (slot % 64));
+        found = true;
+      }
+
+      if (!found)
+      {
+        ASSERT(!m_overflow.empty());
+        std::vector<T> items = std::move(m_overflow);
+        m_overflow.clear();
+        m_now = std::ranges::min(items, {}, [](const T& item) { return item.time; }).time >>
+                GRANULE_SHIFT;
+        for (T& item : items)
+          Insert(std::move(item));
+      }
+    }
+  }
+
+  // Items whose granule is at or before m_now, as a min-heap.
+  std::vector<T> m_due;
+  std::array<Level, NUM_LEVELS> m_levels;
+  // Items too far in the future for the wheel.
+  std::vector<T> m_overflow;
+  s64 m_now = 0;
+  std::size_t m_size = 0;
+};
+
+}  // namespace Common
@@ -201,6 +201,15 @@ void CPUInfo::Detect()
       info = cpuid(7);
       if ((info.ebx >> 3) & 1)
         bBMI1 = true;
+      // AVX2 also depends on the OS saving the AVX state, which the AVX check above covers.
+      if (bAVX && ((info.ebx >> 5) & 1))
+        bAVX2 = true;
+      // AVX-512 also needs the OS to save the opmask and upper ZMM registers.
+      if (bAVX && ((info.ebx >> 16) & 1) &&
+          (xgetbv(XCR_XFEATURE_ENABLED_MASK) & 0b11100110) == 0b11100110)
+      {
+        bAVX512F = true;
+      }
       if ((info.ebx >> 8) & 1)
         bBMI2 = true;
       if ((info.ebx >> 29) & 1)
@@ -259,6 +268,10 @@ std::string CPUInfo::Summarize()
     sum.push_back("HTT");
   if (bAVX)
     sum.push_back("AVX");
+  if (bAVX2)
+    sum.push_back("AVX2");
+  if (bAVX512F)
+    sum.push_back("AVX512F");
   if (bBMI1)
     sum.push_back("BMI1");
   if (bBMI2)
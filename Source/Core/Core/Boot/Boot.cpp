@@ -240,7 +240,8 @@ std::unique_ptr<BootParameters> BootParameters::GenerateFromFile(std::vector<std
        ".elf"}};
   if (disc_image_extensions.contains(extension))
   {
-    std::unique_ptr<DiscIO::VolumeDisc> disc = DiscIO::CreateDisc(path);
+    std::unique_ptr<DiscIO::VolumeDisc> disc =
+        DiscIO::CreateDisc(path, Config::Get(Config::MAIN_MAP_DISC_IMAGES));
     if (disc)
     {
       return std::make_unique<BootParameters>(Disc{std::move(path), std::move(disc), paths},
@@ -469,7 +470,8 @@ static void SetDefaultDisc(DVD::DVDInterface& dvd_interface)
 {
   const std::string default_iso = Config::Get(Config::MAIN_DEFAULT_ISO);
   if (!default_iso.empty())
-    SetDisc(dvd_interface, DiscIO::CreateDisc(default_iso));
+    SetDisc(dvd_interface,
+            DiscIO::CreateDisc(default_iso, Config::Get(Config::MAIN_MAP_DISC_IMAGES)));
 }
 
 static void CopyDefaultExceptionHandlers(Core::System& system)
@@ -629,7 +631,8 @@ bool CBoot::BootUp(Core::System& system, const Core::CPUThreadGuard& guard,
       if (ipl.disc)
       {
         NOTICE_LOG_FMT(BOOT, "Inserting disc: {}", ipl.disc->path);
-        SetDisc(system.GetDVDInterface(), DiscIO::CreateDisc(ipl.disc->path),
+        SetDisc(system.GetDVDInterface(),
+                DiscIO::CreateDisc(ipl.disc->path, Config::Get(Config::MAIN_MAP_DISC_IMAGES)),
                 ipl.disc->auto_disc_change_paths);
       }
       else
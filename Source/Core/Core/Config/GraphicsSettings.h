@@ -94,9 +94,12 @@ extern const Info<bool> GFX_WAIT_FOR_SHADERS_BEFORE_STARTING;
 extern const Info<ShaderCompilationMode> GFX_SHADER_COMPILATION_MODE;
 extern const Info<int> GFX_SHADER_COMPILER_THREADS;
 extern const Info<int> GFX_SHADER_PRECOMPILER_THREADS;
+extern const Info<int> GFX_TEXTURE_DECODING_THREADS;
 extern const Info<bool> GFX_SAVE_TEXTURE_CACHE_TO_STATE;
 extern const Info<bool> GFX_PREFER_VS_FOR_LINE_POINT_EXPANSION;
 extern const Info<bool> GFX_CPU_CULL;
+extern const Info<bool> GFX_DISPLAY_LIST_CACHE;
+extern const Info<bool> GFX_MERGE_DRAWS;
 
 extern const Info<TriState> GFX_MTL_MANUALLY_UPLOAD_BUFFERS;
 extern const Info<TriState> GFX_MTL_USE_PRESENT_DRAWABLE;
@@ -104,6 +107,8 @@ extern const Info<TriState> GFX_MTL_USE_PRESENT_DRAWABLE;
 extern const Info<bool> GFX_SW_DUMP_OBJECTS;
 extern const Info<bool> GFX_SW_DUMP_TEV_STAGES;
 extern const Info<bool> GFX_SW_DUMP_TEV_TEX_FETCHES;
+extern const Info<int> GFX_SW_RASTERIZER_THREADS;
+extern const Info<bool> GFX_SW_VECTORIZED_TEV;
 
 extern const Info<bool> GFX_PREFER_GLES;
 
@@ -161,6 +166,7 @@ static constexpr int GFX_STEREO_CONVERGENCE_MAXIMUM = 200;
 extern const Info<bool> GFX_HACK_EFB_ACCESS_ENABLE;
 extern const Info<bool> GFX_HACK_EFB_DEFER_INVALIDATION;
 extern const Info<int> GFX_HACK_EFB_ACCESS_TILE_SIZE;
+extern const Info<int> GFX_HACK_EFB_ACCESS_LATENCY;
 extern const Info<bool> GFX_HACK_BBOX_ENABLE;
 extern const Info<bool> GFX_HACK_FORCE_PROGRESSIVE;
 extern const Info<bool> GFX_HACK_SKIP_EFB_COPY_TO_RAM;
@@ -176,6 +182,7 @@ extern const Info<bool> GFX_HACK_VERTEX_ROUNDING;
 extern const Info<bool> GFX_HACK_VI_SKIP;
 extern const Info<u32> GFX_HACK_MISSING_COLOR_VALUE;
 extern const Info<bool> GFX_HACK_FAST_TEXTURE_SAMPLING;
+extern const Info<bool> GFX_HACK_TEXTURE_WRITE_TRACKING;
 #ifdef __APPLE__
 extern const Info<bool> GFX_HACK_NO_MIPMAPPING;
 #endif
@@ -42,6 +42,12 @@ const Info<bool> MAIN_JIT_FOLLOW_BRANCH{{System::Main, "Core", "JITFollowBranch"
 const Info<bool> MAIN_FASTMEM{{System::Main, "Core", "Fastmem"}, true};
 const Info<bool> MAIN_FASTMEM_ARENA{{System::Main, "Core", "FastmemArena"}, true};
 const Info<bool> MAIN_LARGE_ENTRY_POINTS_MAP{{System::Main, "Core", "LargeEntryPointsMap"}, true};
+const Info<bool> MAIN_JIT_PERSISTENT_BLOCK_CACHE{{System::Main, "Core", "JITPersistentBlockCache"},
+                                                 false};
+const Info<bool> MAIN_JIT_TIERED_COMPILATION{{System::Main, "Core", "JITTieredCompilation"}, false};
+const Info<bool> MAIN_JIT_TRACE_COMPILATION{{System::Main, "Core", "JITTraceCompilation"}, false};
+const Info<bool> MAIN_JIT_PRELOADED_ENTRY_POINTS{{System::Main, "Core", "JITPreloadedEntryPoints"},
+                                                 false};
 const Info<bool> MAIN_ACCURATE_CPU_CACHE{{System::Main, "Core", "AccurateCPUCache"}, false};
 const Info<bool> MAIN_DSP_HLE{{System::Main, "Core", "DSPHLE"}, true};
 const Info<int> MAIN_MAX_FALLBACK{{System::Main, "Core", "MaxFallback"}, 100};
@@ -210,7 +216,11 @@ const Info<bool> MAIN_SYNC_GPU{{System::Main, "Core", "SyncGPU"}, false};
 const Info<int> MAIN_SYNC_GPU_MAX_DISTANCE{{System::Main, "Core", "SyncGpuMaxDistance"}, 200000};
 const Info<int> MAIN_SYNC_GPU_MIN_DISTANCE{{System::Main, "Core", "SyncGpuMinDistance"}, -200000};
 const Info<float> MAIN_SYNC_GPU_OVERCLOCK{{System::Main, "Core", "SyncGpuOverclock"}, 1.0f};
+const Info<bool> MAIN_FIFO_PREPARSE_THREAD{{System::Main, "Core", "FifoPreparseThread"}, false};
 const Info<bool> MAIN_FAST_DISC_SPEED{{System::Main, "Core", "FastDiscSpeed"}, false};
+const Info<int> MAIN_DVD_PREFETCH_THREADS{{System::Main, "Core", "DVDPrefetchThreads"}, 2};
+const Info<int> MAIN_WIA_RVZ_CHUNK_CACHE_SIZE{{System::Main, "Core", "WIARVZChunkCacheSize"}, 16};
+const Info<bool> MAIN_MAP_DISC_IMAGES{{System::Main, "Core", "MapDiscImages"}, false};
 const Info<bool> MAIN_LOW_DCBZ_HACK{{System::Main, "Core", "LowDCBZHack"}, false};
 const Info<bool> MAIN_FLOAT_EXCEPTIONS{{System::Main, "Core", "FloatExceptions"}, false};
 const Info<bool> MAIN_DIVIDE_BY_ZERO_EXCEPTIONS{{System::Main, "Core", "DivByZeroExceptions"},
@@ -59,6 +59,10 @@ extern const Info<bool> MAIN_JIT_FOLLOW_BRANCH;
 extern const Info<bool> MAIN_FASTMEM;
 extern const Info<bool> MAIN_FASTMEM_ARENA;
 extern const Info<bool> MAIN_LARGE_ENTRY_POINTS_MAP;
+extern const Info<bool> MAIN_JIT_PERSISTENT_BLOCK_CACHE;
+extern const Info<bool> MAIN_JIT_TIERED_COMPILATION;
+extern const Info<bool> MAIN_JIT_TRACE_COMPILATION;
+extern const Info<bool> MAIN_JIT_PRELOADED_ENTRY_POINTS;
 extern const Info<bool> MAIN_ACCURATE_CPU_CACHE;
 // Should really be in the DSP section, but we're kind of stuck with bad decisions made in the past.
 extern const Info<bool> MAIN_DSP_HLE;
@@ -119,7 +123,15 @@ extern const Info<bool> MAIN_SYNC_GPU;
 extern const Info<int> MAIN_SYNC_GPU_MAX_DISTANCE;
 extern const Info<int> MAIN_SYNC_GPU_MIN_DISTANCE;
 extern const Info<float> MAIN_SYNC_GPU_OVERCLOCK;
+extern const Info<bool> MAIN_FIFO_PREPARSE_THREAD;
 extern const Info<bool> MAIN_FAST_DISC_SPEED;
+// Number of threads that read ahead in compressed disc images, or 0 to not read ahead.
+extern const Info<int> MAIN_DVD_PREFETCH_THREADS;
+// Memory in MiB that each reader of a WIA/RVZ disc image may keep decompressed chunks in.
+extern const Info<int> MAIN_WIA_RVZ_CHUNK_CACHE_SIZE;
+// Map uncompressed disc images into memory instead of reading them with system calls. Only safe
+// for local files that stay readable: a failed read through the mapping crashes the emulator.
+extern const Info<bool> MAIN_MAP_DISC_IMAGES;
 extern const Info<bool> MAIN_LOW_DCBZ_HACK;
 extern const Info<bool> MAIN_FLOAT_EXCEPTIONS;
 extern const Info<bool> MAIN_DIVIDE_BY_ZERO_EXCEPTIONS;
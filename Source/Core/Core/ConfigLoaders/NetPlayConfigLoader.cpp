@@ -97,6 +97,8 @@ public:
     layer->Set(Config::GFX_HACK_DEFER_EFB_COPIES, m_settings.defer_efb_copies);
     layer->Set(Config::GFX_HACK_EFB_ACCESS_TILE_SIZE, m_settings.efb_access_tile_size);
     layer->Set(Config::GFX_HACK_EFB_DEFER_INVALIDATION, m_settings.efb_access_defer_invalidation);
+    // Which frame a late peek sees depends on how far the GPU thread is behind.
+    layer->Set(Config::GFX_HACK_EFB_ACCESS_LATENCY, 0);
 
     layer->Set(Config::SESSION_USE_FMA, m_settings.use_fma);
 
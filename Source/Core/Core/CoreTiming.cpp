@@ -4,7 +4,6 @@
 #include "Core/CoreTiming.h"
 
 #include <algorithm>
-#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -14,7 +13,6 @@
 #include "Common/Assert.h"
 #include "Common/ChunkFile.h"
 #include "Common/Logging/Log.h"
-#include "Common/SPSCQueue.h"
 
 #include "Core/AchievementManager.h"
 #include "Core/CPUThreadConfigCallback.h"
@@ -76,7 +74,7 @@ EventType* CoreTimingManager::RegisterEvent(const std::string& name, TimedCallba
 
 void CoreTimingManager::UnregisterAllEvents()
 {
-  ASSERT_MSG(POWERPC, m_event_queue.empty(), "Cannot unregister events with events pending");
+  ASSERT_MSG(POWERPC, m_event_queue.Empty(), "Cannot unregister events with events pending");
   m_event_types.clear();
 }
 
@@ -96,6 +94,7 @@ void CoreTimingManager::Init()
   // Reset data used by the throttling system
   ResetThrottle(0);
 
+  m_event_queue.Reset(m_globals.global_timer);
   m_event_fifo_id = 0;
   m_ev_lost = RegisterEvent("_lost_event", &EmptyTimedCallback);
 
@@ -119,7 +118,6 @@ void CoreTimingManager::Shutdown()
 {
   Core::RemoveOnStateChangedCallback(&m_on_state_changed_handle);
 
-  std::lock_guard lk(m_ts_write_lock);
   MoveEvents();
   ClearPendingEvents();
   UnregisterAllEvents();
@@ -158,7 +156,6 @@ void CoreTimingManager::RefreshConfig()
 
 void CoreTimingManager::DoState(PointerWrap& p)
 {
-  std::lock_guard lk(m_ts_write_lock);
   p.Do(m_globals.slice_length);
   p.Do(m_globals.global_timer);
   p.Do(m_idled_cycles);
@@ -173,7 +170,14 @@ void CoreTimingManager::DoState(PointerWrap& p)
   p.DoMarker("CoreTimingData");
 
   MoveEvents();
-  p.DoEachElement(m_event_queue, [this](PointerWrap& pw, Event& ev) {
+
+  // Events are saved sorted, so the state doesn't depend on the layout of the wheel.
+  std::vector<Event> events;
+  events.reserve(m_event_queue.Size());
+  m_event_queue.ForEach([&](const Event& ev) { events.push_back(ev); });
+  std::ranges::sort(events);
+
+  p.DoEachElement(events, [this](PointerWrap& pw, Event& ev) {
     pw.Do(ev.time);
     pw.Do(ev.fifo_order);
 
@@ -209,9 +213,11 @@ void CoreTimingManager::DoState(PointerWrap& p)
   if (p.IsReadMode())
   {
     // When loading from a save state, we must assume the Event order is random and meaningless.
-    // The exact layout of the heap in memory is implementation defined, therefore it is platform
-    // and library version specific.
-    std::ranges::make_heap(m_event_queue, std::ranges::greater{});
+    // Older states stored the raw layout of a binary heap, which is platform and library version
+    // specific.
+    m_event_queue.Reset(m_globals.global_timer);
+    for (Event& ev : events)
+      m_event_queue.Push(std::move(ev));
 
     // The stave state has changed the time, so our previous Throttle targets are invalid.
     // Especially when global_time goes down; So we create a fake throttle update.
@@ -239,7 +245,7 @@ u64 CoreTimingManager::GetIdleTicks() const
 
 void CoreTimingManager::ClearPendingEvents()
 {
-  m_event_queue.clear();
+  m_event_queue.Reset(m_globals.global_timer);
 }
 
 void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_type, u64 userdata,
@@ -268,8 +274,7 @@ void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_t
     if (!m_is_global_timer_sane)
       ForceExceptionCheck(cycles_into_future);
 
-    m_event_queue.emplace_back(Event{timeout, m_event_fifo_id++, userdata, event_type});
-    std::ranges::push_heap(m_event_queue, std::ranges::greater{});
+    m_event_queue.Push(Event{timeout, m_event_fifo_id++, userdata, event_type});
   }
   else
   {
@@ -281,21 +286,13 @@ void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_t
                     *event_type->name);
     }
 
-    std::lock_guard lk(m_ts_write_lock);
     m_ts_queue.Push(Event{cycles_into_future, 0, userdata, event_type});
   }
 }
 
 void CoreTimingManager::RemoveEvent(EventType* event_type)
 {
-  const size_t erased =
-      std::erase_if(m_event_queue, [&](const Event& e) { return e.type == event_type; });
-
-  // Removing random items breaks the invariant so we have to re-establish it.
-  if (erased != 0)
-  {
-    std::ranges::make_heap(m_event_queue, std::ranges::greater{});
-  }
+  m_event_queue.EraseIf([&](const Event& e) { return e.type == event_type; });
 }
 
 void CoreTimingManager::RemoveAllEvents(EventType* event_type)
@@ -319,16 +316,11 @@ void CoreTimingManager::ForceExceptionCheck(s64 cycles)
 
 void CoreTimingManager::MoveEvents()
 {
-  while (!m_ts_queue.Empty())
-  {
-    auto& ev = m_event_queue.emplace_back(m_ts_queue.Front());
-    m_ts_queue.Pop();
-
+  m_ts_queue.ConsumeAll([this](Event&& ev) {
     ev.fifo_order = m_event_fifo_id++;
     ev.time += m_globals.global_timer;
-
-    std::ranges::push_heap(m_event_queue, std::ranges::greater{});
-  }
+    m_event_queue.Push(std::move(ev));
+  });
 }
 
 void CoreTimingManager::Advance()
@@ -348,21 +340,19 @@ void CoreTimingManager::Advance()
 
   m_is_global_timer_sane = true;
 
-  while (!m_event_queue.empty() && m_event_queue.front().time <= m_globals.global_timer)
+  while (!m_event_queue.Empty() && m_event_queue.Top().time <= m_globals.global_timer)
   {
-    Event evt = std::move(m_event_queue.front());
-    std::ranges::pop_heap(m_event_queue, std::ranges::greater{});
-    m_event_queue.pop_back();
+    Event evt = m_event_queue.Pop();
     evt.type->callback(m_system, evt.userdata, m_globals.global_timer - evt.time);
   }
 
   m_is_global_timer_sane = false;
 
   // Still events left (scheduled in the future)
-  if (!m_event_queue.empty())
+  if (!m_event_queue.Empty())
   {
     m_globals.slice_length = static_cast<int>(
-        std::min<s64>(m_event_queue.front().time - m_globals.global_timer, MAX_SLICE_LENGTH));
+        std::min<s64>(m_event_queue.Top().time - m_globals.global_timer, MAX_SLICE_LENGTH));
   }
 
   ppc_state.downcount = CyclesToDowncount(m_globals.slice_length);
@@ -514,7 +504,9 @@ bool CoreTimingManager::UseSyncOnSkipIdle() const
 
 void CoreTimingManager::LogPendingEvents() const
 {
-  auto clone = m_event_queue;
+  std::vector<Event> clone;
+  clone.reserve(m_event_queue.Size());
+  m_event_queue.ForEach([&](const Event& ev) { clone.push_back(ev); });
   std::ranges::sort(clone);
   for (const Event& ev : clone)
   {
@@ -532,10 +524,17 @@ void CoreTimingManager::AdjustEventQueueTimes(u32 new_ppc_clock, u32 old_ppc_clo
 
   g_perf_metrics.AdjustClockSpeed(ticks, new_ppc_clock, old_ppc_clock);
 
-  for (Event& ev : m_event_queue)
+  std::vector<Event> events;
+  events.reserve(m_event_queue.Size());
+  m_event_queue.ForEach([&](const Event& ev) { events.push_back(ev); });
+
+  // Rescaling can reorder events relative to the wheel's slots, so the wheel is rebuilt.
+  m_event_queue.Reset(ticks);
+  for (Event& ev : events)
   {
     const s64 ev_ticks = (ev.time - ticks) * new_ppc_clock / old_ppc_clock;
     ev.time = ticks + ev_ticks;
+    m_event_queue.Push(std::move(ev));
   }
 }
 
@@ -560,7 +559,9 @@ std::string CoreTimingManager::GetScheduledEventsSummary() const
   std::string text = "Scheduled events\n";
   text.reserve(1000);
 
-  auto clone = m_event_queue;
+  std::vector<Event> clone;
+  clone.reserve(m_event_queue.Size());
+  m_event_queue.ForEach([&](const Event& ev) { clone.push_back(ev); });
   std::ranges::sort(clone);
   for (const Event& ev : clone)
   {
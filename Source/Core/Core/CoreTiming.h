@@ -16,15 +16,16 @@
 // inside callback:
 //   ScheduleEvent(periodInCycles - cyclesLate, callback, "whatever")
 
-#include <mutex>
+#include <atomic>
 #include <string>
 #include <tuple>
 #include <unordered_map>
 #include <vector>
 
 #include "Common/CommonTypes.h"
-#include "Common/SPSCQueue.h"
+#include "Common/MPSCQueue.h"
 #include "Common/Timer.h"
+#include "Common/TimingWheel.h"
 #include "Core/CPUThreadConfigCallback.h"
 
 class PointerWrap;
@@ -179,17 +180,15 @@ private:
   std::unordered_map<std::string, EventType> m_event_types;
 
   // STATE_TO_SAVE
-  // The queue is a min-heap using std::ranges::make_heap/push_heap/pop_heap.
-  // We don't use std::priority_queue because we need to be able to serialize, unserialize and
-  // erase arbitrary events (RemoveEvent()) regardless of the queue order. These aren't accommodated
-  // by the standard adaptor class.
-  std::vector<Event> m_event_queue;
+  // The queue is a hierarchical timing wheel, so scheduling is O(1) regardless of how many events
+  // are pending. Events still come out in exactly the (time, fifo_order) order of a min-heap, which
+  // keeps emulation deterministic.
+  Common::TimingWheel<Event> m_event_queue;
   u64 m_event_fifo_id = 0;
-  std::mutex m_ts_write_lock;
 
-  // Event objects created from other threads.
+  // Event objects created from other threads. Any number of threads may push without locking.
   // The time value of each Event here is a cycles_into_future value.
-  Common::SPSCQueue<Event> m_ts_queue;
+  Common::MPSCQueue<Event> m_ts_queue;
 
   float m_last_oc_factor = 0.0f;
 
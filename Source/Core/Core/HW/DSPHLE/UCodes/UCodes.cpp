@@ -53,6 +53,7 @@ void HLEMemory_Write_U8(Memory::MemoryManager& memory, u32 address, u8 value)
     memory.GetEXRAM()[address & memory.GetExRamMask()] = value;
   else
     memory.GetRAM()[address & memory.GetRamMask()] = value;
+  memory.RecordWrite(address, sizeof(value));
 }
 
 u16 HLEMemory_Read_U16LE(Memory::MemoryManager& memory, u32 address)
@@ -78,6 +79,7 @@ void HLEMemory_Write_U16LE(Memory::MemoryManager& memory, u32 address, u16 value
     std::memcpy(&memory.GetEXRAM()[address & memory.GetExRamMask()], &value, sizeof(u16));
   else
     std::memcpy(&memory.GetRAM()[address & memory.GetRamMask()], &value, sizeof(u16));
+  memory.RecordWrite(address, sizeof(value));
 }
 
 void HLEMemory_Write_U16(Memory::MemoryManager& memory, u32 address, u16 value)
@@ -108,6 +110,7 @@ void HLEMemory_Write_U32LE(Memory::MemoryManager& memory, u32 address, u32 value
     std::memcpy(&memory.GetEXRAM()[address & memory.GetExRamMask()], &value, sizeof(u32));
   else
     std::memcpy(&memory.GetRAM()[address & memory.GetRamMask()], &value, sizeof(u32));
+  memory.RecordWrite(address, sizeof(value));
 }
 
 void HLEMemory_Write_U32(Memory::MemoryManager& memory, u32 address, u32 value)
@@ -0,0 +1,264 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/DVD/DVDPrefetcher.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <fmt/format.h>
+
+#include "Common/Logging/Log.h"
+#include "Common/Timer.h"
+
+#include "DiscIO/Blob.h"
+#include "DiscIO/Filesystem.h"
+
+namespace DVD
+{
+DVDPrefetcher::DVDPrefetcher() = default;
+
+DVDPrefetcher::~DVDPrefetcher()
+{
+  Stop();
+}
+
+void DVDPrefetcher::Start(const DiscIO::Volume& volume, u32 thread_count)
+{
+  Stop();
+
+  for (u32 i = 0; i < thread_count; i++)
+  {
+    std::unique_ptr<DiscIO::BlobReader> reader = volume.GetBlobReader().CopyReader();
+    if (!reader)
+      break;
+    std::unique_ptr<DiscIO::Volume> copy = DiscIO::CreateVolume(std::move(reader));
+    if (!copy)
+      break;
+
+    auto worker = std::make_unique<Worker>();
+    worker->volume = std::move(copy);
+    worker->thread.Reset(fmt::format("DVD Prefetch {}", i),
+                         [this, volume = worker->volume.get()](std::shared_ptr<Block> block) {
+                           ReadBlock(*volume, *block);
+                         });
+    m_workers.push_back(std::move(worker));
+  }
+
+  if (m_workers.empty() && thread_count != 0)
+    WARN_LOG_FMT(DVDINTERFACE, "Can't read ahead in this disc image");
+}
+
+void DVDPrefetcher::Stop()
+{
+  if (!IsRunning())
+    return;
+
+  for (const std::unique_ptr<Worker>& worker : m_workers)
+  {
+    worker->thread.Cancel();
+    worker->thread.Shutdown();
+  }
+  m_workers.clear();
+  m_next_worker = 0;
+
+  LogStatistics();
+
+  m_blocks.clear();
+  m_block_order.clear();
+  m_has_last_read = false;
+  m_hits = 0;
+  m_misses = 0;
+  m_blocks_read = 0;
+  m_block_read_time_us = 0;
+}
+
+bool DVDPrefetcher::Read(u64 offset, u32 length, u8* buffer, const DiscIO::Partition& partition)
+{
+  if (!IsRunning() || length == 0)
+    return false;
+
+  const u64 first_block = offset / BLOCK_SIZE;
+  const u64 last_block = (offset + length - 1) / BLOCK_SIZE;
+
+  std::unique_lock lock(m_blocks_lock);
+
+  std::vector<std::shared_ptr<Block>> blocks;
+  for (u64 block = first_block; block <= last_block; block++)
+  {
+    const auto it = m_blocks.find({partition, block});
+    if (it == m_blocks.end())
+    {
+      m_misses++;
+      return false;
+    }
+    blocks.push_back(it->second);
+  }
+
+  // Waiting for a block that is already being read is faster than reading it again, but a block
+  // that is still queued may be behind a lot of other work.
+  if (std::ranges::any_of(blocks, [](const std::shared_ptr<Block>& block) {
+        return block->state == BlockState::Queued;
+      }))
+  {
+    m_misses++;
+    return false;
+  }
+
+  m_block_done.wait(lock, [&] {
+    return std::ranges::none_of(blocks, [](const std::shared_ptr<Block>& block) {
+      return block->state == BlockState::Reading;
+    });
+  });
+
+  if (std::ranges::any_of(blocks, [](const std::shared_ptr<Block>& block) {
+        return block->state != BlockState::Ready;
+      }))
+  {
+    m_misses++;
+    return false;
+  }
+
+  for (const std::shared_ptr<Block>& block : blocks)
+  {
+    const u64 start = std::max(offset, block->offset);
+    const u64 end = std::min(offset + length, block->offset + BLOCK_SIZE);
+    std::memcpy(buffer + (start - offset), block->data.data() + (start - block->offset),
+                end - start);
+  }
+  m_hits++;
+  return true;
+}
+
+void DVDPrefetcher::Predict(const DiscIO::Volume& volume, u64 offset, u32 length,
+                            const DiscIO::Partition& partition)
+{
+  if (!IsRunning())
+    return;
+
+  if (!m_has_last_read || partition != m_last_partition)
+  {
+    m_has_last_read = false;
+    m_last_stride = 0;
+  }
+
+  const u64 end = offset + length;
+  const bool sequential = m_has_last_read && offset == m_last_end;
+  // Blocks beyond this would only push the first ones out of the cache again.
+  size_t max_blocks = MAX_BLOCKS;
+
+  // Games usually read files from start to end, so the rest of the file is likely to be read next,
+  // even if the read doesn't continue an earlier one.
+  u64 file_end = 0;
+  if (const DiscIO::FileSystem* file_system = volume.GetFileSystem(partition))
+  {
+    const std::unique_ptr<DiscIO::FileInfo> file_info = file_system->FindFileInfo(offset);
+    if (file_info && !file_info->IsDirectory())
+      file_end = file_info->GetOffset() + file_info->GetSize();
+  }
+
+  if (file_end > end)
+    QueueRange(partition, end, std::min(file_end, end + READ_AHEAD_DISTANCE), &max_blocks);
+  else if (sequential)
+    QueueRange(partition, end, end + READ_AHEAD_DISTANCE, &max_blocks);
+
+  const s64 stride = m_has_last_read ? static_cast<s64>(offset - m_last_offset) : 0;
+  if (!sequential && stride != 0 && stride == m_last_stride)
+  {
+    for (u32 i = 1; i <= READ_AHEAD_STRIDES; i++)
+    {
+      const u64 next_offset = offset + static_cast<u64>(stride * i);
+      // Strides going backwards must not wrap around.
+      if ((stride < 0) != (next_offset < offset))
+        break;
+      QueueRange(partition, next_offset, next_offset + length, &max_blocks);
+    }
+  }
+
+  m_last_partition = partition;
+  m_last_offset = offset;
+  m_last_end = end;
+  m_last_stride = stride;
+  m_has_last_read = true;
+}
+
+void DVDPrefetcher::ReadBlock(DiscIO::Volume& volume, Block& block)
+{
+  {
+    std::lock_guard lock(m_blocks_lock);
+    if (block.state == BlockState::Cancelled)
+      return;
+    block.state = BlockState::Reading;
+  }
+
+  const u64 start_time = Common::Timer::NowUs();
+  std::vector<u8> data(BLOCK_SIZE);
+  const bool success = volume.Read(block.offset, BLOCK_SIZE, data.data(), block.partition);
+  const u64 read_time = Common::Timer::NowUs() - start_time;
+
+  DEBUG_LOG_FMT(DVDINTERFACE, "Read ahead {:#x} - {:#x} in {} us", block.offset,
+                block.offset + BLOCK_SIZE, read_time);
+
+  {
+    std::lock_guard lock(m_blocks_lock);
+    block.data = std::move(data);
+    block.state = success ? BlockState::Ready : BlockState::Failed;
+    m_blocks_read++;
+    m_block_read_time_us += read_time;
+  }
+  m_block_done.notify_all();
+}
+
+void DVDPrefetcher::QueueRange(const DiscIO::Partition& partition, u64 start, u64 end,
+                               size_t* max_blocks)
+{
+  if (start >= end)
+    return;
+
+  const u64 first_block = start / BLOCK_SIZE;
+  const u64 last_block = std::min((end - 1) / BLOCK_SIZE, first_block + MAX_BLOCKS / 2 - 1);
+
+  std::lock_guard lock(m_blocks_lock);
+  for (u64 block = first_block; block <= last_block; block++)
+  {
+    const BlockKey key{partition, block};
+    if (m_blocks.contains(key))
+      continue;
+    if (*max_blocks == 0)
+      return;
+    (*max_blocks)--;
+
+    // Blocks that are being read are dropped too. The worker keeps them alive until it's done.
+    if (m_blocks.size() >= MAX_BLOCKS)
+    {
+      const auto oldest = m_blocks.find(m_block_order.front());
+      if (oldest->second->state == BlockState::Queued)
+        oldest->second->state = BlockState::Cancelled;
+      m_blocks.erase(oldest);
+      m_block_order.pop_front();
+    }
+
+    auto new_block = std::make_shared<Block>();
+    new_block->partition = partition;
+    new_block->offset = block * BLOCK_SIZE;
+    m_blocks.emplace(key, new_block);
+    m_block_order.push_back(key);
+
+    m_workers[m_next_worker]->thread.Push(std::move(new_block));
+    m_next_worker = (m_next_worker + 1) % m_workers.size();
+  }
+}
+
+void DVDPrefetcher::LogStatistics() const
+{
+  const u64 reads = m_hits + m_misses;
+  if (reads == 0)
+    return;
+
+  INFO_LOG_FMT(DVDINTERFACE,
+               "Read ahead: {} of {} reads ({:.1f}%) were served from {} blocks read ahead, "
+               "which took {} us each on average",
+               m_hits, reads, m_hits * 100.0 / reads, m_blocks_read,
+               m_blocks_read ? m_block_read_time_us / m_blocks_read : 0);
+}
+}  // namespace DVD
@@ -0,0 +1,121 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/WorkQueueThread.h"
+#include "DiscIO/Volume.h"
+
+namespace DVD
+{
+// Reads the parts of a disc that the game is likely to read next on worker threads, so that the
+// DVD thread doesn't have to wait for them to be decompressed or decrypted.
+//
+// The disc is split into blocks of BLOCK_SIZE bytes within each partition. Every read is used to
+// predict which blocks come next:
+// - The rest of the file that the read is in, as far as the filesystem knows it.
+// - The data after the read, if it continues the previous read.
+// - The data one stride further, if the last reads were the same distance apart.
+// Predicted blocks are read on the worker threads, each of which uses its own copy of the volume,
+// and are kept in a bounded cache that later reads are served from.
+//
+// All functions except the constructor and destructor have to be called from the same thread.
+class DVDPrefetcher
+{
+public:
+  static constexpr u32 BLOCK_SIZE = 0x20000;
+  // Number of blocks that are kept, including those that are still being read.
+  static constexpr size_t MAX_BLOCKS = 64;
+  // How far ahead of sequential reads blocks are read.
+  static constexpr u64 READ_AHEAD_DISTANCE = 0x100000;
+  // How many strides ahead of strided reads blocks are read.
+  static constexpr u32 READ_AHEAD_STRIDES = 4;
+
+  DVDPrefetcher();
+  ~DVDPrefetcher();
+
+  DVDPrefetcher(const DVDPrefetcher&) = delete;
+  DVDPrefetcher& operator=(const DVDPrefetcher&) = delete;
+
+  // Starts reading ahead in the volume with the given number of threads, after stopping reading
+  // ahead in the previous one. Does nothing if the volume can't be copied.
+  void Start(const DiscIO::Volume& volume, u32 thread_count);
+  void Stop();
+  bool IsRunning() const { return !m_workers.empty(); }
+
+  // Copies the range from blocks that were read ahead, waiting for those that are being read.
+  // Returns false if any part of it wasn't read ahead or a worker hasn't started reading it yet, in
+  // which case it has to be read directly.
+  bool Read(u64 offset, u32 length, u8* buffer, const DiscIO::Partition& partition);
+  // Queues the blocks that are likely to be read after this read, at most MAX_BLOCKS of them.
+  void Predict(const DiscIO::Volume& volume, u64 offset, u32 length,
+               const DiscIO::Partition& partition);
+
+private:
+  enum class BlockState
+  {
+    // Waiting for a worker
+    Queued,
+    // Being read by a worker
+    Reading,
+    Ready,
+    Failed,
+    // Removed from the cache before a worker got to it, so it won't be read
+    Cancelled,
+  };
+
+  struct Block
+  {
+    DiscIO::Partition partition;
+    u64 offset;
+    std::vector<u8> data;
+    BlockState state = BlockState::Queued;
+  };
+
+  using BlockKey = std::pair<DiscIO::Partition, u64>;
+
+  struct Worker
+  {
+    std::unique_ptr<DiscIO::Volume> volume;
+    Common::WorkQueueThreadSP<std::shared_ptr<Block>> thread;
+  };
+
+  void ReadBlock(DiscIO::Volume& volume, Block& block);
+  // Queues the blocks of the range that aren't cached yet, at most as many as max_blocks, which
+  // is lowered by the number of blocks that were queued.
+  void QueueRange(const DiscIO::Partition& partition, u64 start, u64 end, size_t* max_blocks);
+  void LogStatistics() const;
+
+  std::vector<std::unique_ptr<Worker>> m_workers;
+  size_t m_next_worker = 0;
+
+  // Guards the blocks, which the workers fill in.
+  std::mutex m_blocks_lock;
+  std::condition_variable m_block_done;
+  std::map<BlockKey, std::shared_ptr<Block>> m_blocks;
+  // Keys of m_blocks from oldest to newest, for removing the oldest blocks.
+  std::deque<BlockKey> m_block_order;
+
+  // The previous read, for detecting patterns.
+  DiscIO::Partition m_last_partition;
+  u64 m_last_offset = 0;
+  u64 m_last_end = 0;
+  s64 m_last_stride = 0;
+  bool m_has_last_read = false;
+
+  // Statistics, of which the block ones are guarded by m_blocks_lock
+  u64 m_hits = 0;
+  u64 m_misses = 0;
+  u64 m_blocks_read = 0;
+  u64 m_block_read_time_us = 0;
+};
+}  // namespace DVD
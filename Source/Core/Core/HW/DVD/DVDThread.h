@@ -14,6 +14,7 @@
 
 #include "Common/WorkQueueThread.h"
 #include "Core/HW/DVD/DVDInterface.h"
+#include "Core/HW/DVD/DVDPrefetcher.h"
 #include "Core/HW/DVD/FileMonitor.h"
 
 #include "DiscIO/Volume.h"
@@ -135,6 +136,9 @@ private:
 
   FileMonitor::FileLogger m_file_logger;
 
+  // Only used by the DVD thread, except for starting and stopping it while the thread is idle.
+  DVDPrefetcher m_prefetcher;
+
   Core::System& m_system;
 };
 }  // namespace DVD
@@ -19,6 +19,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/MemArena.h"
+#include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
 #include "Common/Swap.h"
 #include "Core/Config/MainSettings.h"
@@ -33,6 +34,7 @@
 #include "Core/HW/SI/SI.h"
 #include "Core/HW/VideoInterface.h"
 #include "Core/HW/WII_IPC.h"
+#include "Core/MemTools.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
@@ -153,6 +155,9 @@ void MemoryManager::Init()
 
   InitMMIO(wii);
 
+  m_write_tracker.Init(GetRamSizeReal(), wii ? GetExRamSizeReal() : 0);
+  m_is_write_tracking_supported = true;
+
   Clear();
 
   INFO_LOG_FMT(MEMMAP, "Memory system initialized. RAM at {}", fmt::ptr(m_ram));
@@ -230,11 +235,25 @@ bool MemoryManager::InitFastmemArena()
 
   m_is_fastmem_arena_initialized = true;
   m_fastmem_arena_size = memory_size;
+
+  // Stores to watched pages have to fault, and the faults have to be handled.
+#if defined(_M_ARM_64) && defined(__APPLE__)
+  // WriteProtectMemory can't be used on this platform.
+  m_is_write_tracking_supported = false;
+#else
+  m_is_write_tracking_supported = EMM::IsExceptionHandlerSupported() &&
+                                  Common::MemPageSize() == PageWriteTracker::PAGE_SIZE;
+#endif
+
   return true;
 }
 
 void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
 {
+  // The protection of watched pages is lost when remapping, so stop watching them.
+  std::lock_guard lock(m_write_tracking_lock);
+  UnwatchAllPages();
+
   for (auto& entry : m_logical_mapped_entries)
   {
     m_arena.UnmapFromMemoryRegion(entry.mapped_pointer, entry.mapped_size);
@@ -294,7 +313,7 @@ void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
                   intersection_start, mapped_size, logical_address);
               exit(0);
             }
-            m_logical_mapped_entries.push_back({mapped_pointer, mapped_size});
+            m_logical_mapped_entries.push_back({mapped_pointer, mapped_size, intersection_start});
           }
 
           m_logical_page_mappings[i] =
@@ -352,6 +371,12 @@ void MemoryManager::DoState(PointerWrap& p)
   if (current_have_exram)
     p.DoArray(m_exram, current_exram_size);
   p.DoMarker("Memory EXRAM");
+
+  if (p.IsReadMode())
+  {
+    std::lock_guard lock(m_write_tracking_lock);
+    UnwatchAllPages();
+  }
 }
 
 void MemoryManager::Shutdown()
@@ -369,6 +394,8 @@ void MemoryManager::Shutdown()
   }
   m_arena.ReleaseSHMSegment();
   m_mmio_mapping.reset();
+  m_write_tracker.Shutdown();
+  m_is_write_tracking_supported = false;
   INFO_LOG_FMT(MEMMAP, "Memory system shut down.");
 }
 
@@ -377,6 +404,9 @@ void MemoryManager::ShutdownFastmemArena()
   if (!m_is_fastmem_arena_initialized)
     return;
 
+  std::lock_guard lock(m_write_tracking_lock);
+  UnwatchAllPages();
+
   for (const PhysicalMemoryRegion& region : m_physical_regions)
   {
     if (!region.active)
@@ -412,6 +442,9 @@ void MemoryManager::Clear()
     memset(m_fake_vmem, 0, GetFakeVMemSize());
   if (m_exram)
     memset(m_exram, 0, GetExRamSize());
+
+  std::lock_guard lock(m_write_tracking_lock);
+  UnwatchAllPages();
 }
 
 u8* MemoryManager::GetPointerForRange(u32 address, size_t size) const
@@ -461,6 +494,7 @@ void MemoryManager::CopyToEmu(u32 address, const void* data, size_t size)
     return;
   }
   memcpy(pointer, data, size);
+  RecordWrite(address, size);
 }
 
 void MemoryManager::Memset(u32 address, u8 value, size_t size)
@@ -475,6 +509,96 @@ void MemoryManager::Memset(u32 address, u8 value, size_t size)
     return;
   }
   memset(pointer, value, size);
+  RecordWrite(address, size);
+}
+
+std::optional<u64> MemoryManager::WatchForWrites(u32 address, u32 size)
+{
+  if (!m_is_write_tracking_supported)
+    return std::nullopt;
+
+  std::lock_guard lock(m_write_tracking_lock);
+  return m_write_tracker.Watch(address, size, [this](u32 page_address, u32 page_size) {
+    SetFastmemWriteProtection(page_address, page_size, true);
+  });
+}
+
+void MemoryManager::RecordWatchedWrite(u32 address, u32 size)
+{
+  std::lock_guard lock(m_write_tracking_lock);
+  m_write_tracker.Unwatch(address, size, [this](u32 page_address, u32 page_size) {
+    SetFastmemWriteProtection(page_address, page_size, false);
+  });
+}
+
+bool MemoryManager::HandleWriteFault(const u8* address)
+{
+  if (!m_is_write_tracking_supported || !IsAddressInFastmemArea(address))
+    return false;
+
+  std::lock_guard lock(m_write_tracking_lock);
+
+  std::optional<u32> physical_address;
+  if (address >= m_physical_base && address < m_physical_base + 0x1'0000'0000)
+  {
+    physical_address = static_cast<u32>(address - m_physical_base);
+  }
+  else
+  {
+    for (const LogicalMemoryView& entry : m_logical_mapped_entries)
+    {
+      const u8* mapped_pointer = static_cast<const u8*>(entry.mapped_pointer);
+      if (address >= mapped_pointer && address < mapped_pointer + entry.mapped_size)
+      {
+        physical_address = entry.physical_address + static_cast<u32>(address - mapped_pointer);
+        break;
+      }
+    }
+  }
+  if (!physical_address || !m_write_tracker.IsTracked(*physical_address))
+    return false;
+
+  // Faults in RAM can only come from writes to watched pages, since reads of them don't fault. If
+  // the page isn't watched anymore, another thread stopped watching it between the fault and
+  // taking the lock, and the write can be retried all the same.
+  m_write_tracker.Unwatch(*physical_address, 1, [this](u32 page_address, u32 page_size) {
+    SetFastmemWriteProtection(page_address, page_size, false);
+  });
+  return true;
+}
+
+void MemoryManager::UnwatchAllPages()
+{
+  m_write_tracker.UnwatchAll([this](u32 page_address, u32 page_size) {
+    SetFastmemWriteProtection(page_address, page_size, false);
+  });
+}
+
+void MemoryManager::SetFastmemWriteProtection(u32 address, u32 size, bool write_protect)
+{
+  if (!m_is_fastmem_arena_initialized)
+    return;
+
+  const auto set_protection = [write_protect](u8* pointer, u32 protected_size) {
+    if (write_protect)
+      Common::WriteProtectMemory(pointer, protected_size);
+    else
+      Common::UnWriteProtectMemory(pointer, protected_size);
+  };
+
+  set_protection(m_physical_base + address, size);
+
+  // The same physical memory can be mapped at several logical addresses.
+  for (const LogicalMemoryView& entry : m_logical_mapped_entries)
+  {
+    const u32 start = std::max(address, entry.physical_address);
+    const u32 end = std::min(address + size, entry.physical_address + entry.mapped_size);
+    if (start < end)
+    {
+      set_protection(static_cast<u8*>(entry.mapped_pointer) + (start - entry.physical_address),
+                     end - start);
+    }
+  }
 }
 
 std::string MemoryManager::GetString(u32 em_address, size_t size)
@@ -5,6 +5,8 @@
 
 #include <array>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <span>
 #include <string>
 #include <vector>
@@ -13,6 +15,7 @@
 #include "Common/MathUtil.h"
 #include "Common/MemArena.h"
 #include "Common/Swap.h"
+#include "Core/HW/PageWriteTracker.h"
 #include "Core/PowerPC/MMU.h"
 
 // Global declarations
@@ -54,6 +57,7 @@ struct LogicalMemoryView
 {
   void* mapped_pointer;
   u32 mapped_size;
+  u32 physical_address;
 };
 
 class MemoryManager
@@ -130,6 +134,26 @@ public:
   void Write_U32_Swap(u32 var, u32 address);
   void Write_U64_Swap(u64 var, u32 address);
 
+  // Write tracking for RAM, see PageWriteTracker. Writes through the functions above and through
+  // PowerPC::MMU are recorded. Anything that writes to RAM through a pointer has to call
+  // RecordWrite itself.
+
+  // Starts watching the physical range for writes. Returns the generation that writes from now on
+  // will be newer than, or nothing if writes to the range can't be tracked.
+  std::optional<u64> WatchForWrites(u32 address, u32 size);
+  bool IsUnchangedSince(u32 address, u32 size, u64 generation) const
+  {
+    return m_write_tracker.IsUnchangedSince(address, size, generation);
+  }
+  void RecordWrite(u32 address, size_t size)
+  {
+    if (m_write_tracker.IsWatched(address, static_cast<u32>(size)))
+      RecordWatchedWrite(address, static_cast<u32>(size));
+  }
+  // Called for faults in the fastmem area. Returns true if the fault was in MEM1 or MEM2, which is
+  // only write protected for watching pages, so that the write can be retried now.
+  bool HandleWriteFault(const u8* address);
+
   // Templated functions for byteswapped copies.
   template <typename T>
   void CopyFromEmuSwapped(T* data, u32 address, size_t size) const
@@ -153,6 +177,7 @@ public:
 
     for (size_t i = 0; i < size / sizeof(T); i++)
       dest[i] = Common::FromBigEndian(data[i]);
+    RecordWrite(address, size);
   }
 
 private:
@@ -196,6 +221,13 @@ private:
 
   bool m_is_fastmem_arena_initialized = false;
 
+  // Fastmem stores to watched pages are caught by write protecting them in the fastmem arena,
+  // which isn't possible everywhere.
+  bool m_is_write_tracking_supported = false;
+  PageWriteTracker m_write_tracker;
+  // Serializes changes to the watched pages and their protection with remapping the arena.
+  std::mutex m_write_tracking_lock;
+
   // STATE_TO_SAVE
   // Save the Init(), Shutdown() state
   bool m_is_initialized = false;
@@ -255,5 +287,9 @@ private:
   Core::System& m_system;
 
   void InitMMIO(bool is_wii);
+
+  void RecordWatchedWrite(u32 address, u32 size);
+  void UnwatchAllPages();
+  void SetFastmemWriteProtection(u32 address, u32 size, bool write_protect);
 };
 }  // namespace Memory
@@ -0,0 +1,94 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/PageWriteTracker.h"
+
+#include <algorithm>
+
+#include "Common/Align.h"
+
+namespace Memory
+{
+namespace
+{
+constexpr u32 MEM2_PHYSICAL_ADDRESS = 0x10000000;
+}
+
+void PageWriteTracker::Init(u32 mem1_size, u32 mem2_size)
+{
+  m_mem1_pages = Common::AlignUp(mem1_size, PAGE_SIZE) >> PAGE_SHIFT;
+  m_mem2_pages = Common::AlignUp(mem2_size, PAGE_SIZE) >> PAGE_SHIFT;
+
+  const size_t total_pages = m_mem1_pages + m_mem2_pages;
+  m_last_write = std::make_unique<std::atomic<u64>[]>(total_pages);
+  m_watched = std::make_unique<std::atomic<bool>[]>(total_pages);
+  m_generation = 0;
+  m_watched_pages = 0;
+}
+
+void PageWriteTracker::Shutdown()
+{
+  m_last_write.reset();
+  m_watched.reset();
+  m_mem1_pages = 0;
+  m_mem2_pages = 0;
+  m_watched_pages = 0;
+}
+
+bool PageWriteTracker::IsUnchangedSince(u32 address, u32 size, u64 generation) const
+{
+  const std::optional<std::pair<size_t, size_t>> pages = GetPages(address, size, false);
+  if (!pages)
+    return false;
+
+  for (size_t page = pages->first; page < pages->second; page++)
+  {
+    if (m_last_write[page].load() > generation)
+      return false;
+  }
+  return true;
+}
+
+std::optional<std::pair<size_t, size_t>> PageWriteTracker::GetPages(u32 address, u32 size,
+                                                                    bool clamp) const
+{
+  if (size == 0)
+    return std::nullopt;
+
+  // Same as MemoryManager::GetSpanForAddress.
+  address &= 0x3FFFFFFF;
+
+  size_t base_page;
+  size_t region_pages;
+  if ((address >> 28) == 0)
+  {
+    base_page = 0;
+    region_pages = m_mem1_pages;
+  }
+  else if ((address >> 28) == 1)
+  {
+    address -= MEM2_PHYSICAL_ADDRESS;
+    base_page = m_mem1_pages;
+    region_pages = m_mem2_pages;
+  }
+  else
+  {
+    return std::nullopt;
+  }
+
+  const size_t first = address >> PAGE_SHIFT;
+  size_t end = (static_cast<size_t>(address) + size + PAGE_SIZE - 1) >> PAGE_SHIFT;
+  if (first >= region_pages || (end > region_pages && !clamp))
+    return std::nullopt;
+  end = std::min(end, region_pages);
+
+  return std::pair(base_page + first, base_page + end);
+}
+
+u32 PageWriteTracker::GetPageAddress(size_t page) const
+{
+  if (page < m_mem1_pages)
+    return static_cast<u32>(page << PAGE_SHIFT);
+  return MEM2_PHYSICAL_ADDRESS + static_cast<u32>((page - m_mem1_pages) << PAGE_SHIFT);
+}
+}  // namespace Memory
@@ -0,0 +1,167 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "Common/CommonTypes.h"
+
+namespace Memory
+{
+// Remembers when each page of MEM1 and MEM2 was last written to, so that users of guest memory
+// like the texture cache can tell that data is unchanged without looking at it again.
+//
+// Time is measured in generations, which increase with every recorded write. Writes are only
+// recorded for pages that are watched. Watch returns the current generation, and the first write
+// to a watched page afterwards gives the page a newer generation and stops watching it. Writes to
+// pages that aren't watched don't have to be recorded, since those pages already have a newer
+// generation than whatever relied on them.
+//
+// Watch and the Unwatch functions must not be called concurrently. The other functions may be
+// called from any thread at any time.
+//
+// Addresses are physical, with MEM2 starting at 0x10000000.
+class PageWriteTracker
+{
+public:
+  static constexpr u32 PAGE_SHIFT = 12;
+  static constexpr u32 PAGE_SIZE = 1 << PAGE_SHIFT;
+
+  void Init(u32 mem1_size, u32 mem2_size);
+  void Shutdown();
+
+  // Starts watching the pages of the range, and calls protect(address, size) for each run of pages
+  // which weren't watched before. Returns the generation that writes to the range recorded from
+  // now on will be newer than, or nothing if the range isn't within MEM1 or MEM2.
+  template <typename ProtectFunc>
+  std::optional<u64> Watch(u32 address, u32 size, ProtectFunc&& protect)
+  {
+    const std::optional<std::pair<size_t, size_t>> pages = GetPages(address, size, false);
+    if (!pages)
+      return std::nullopt;
+
+    ForEachRun(pages->first, pages->second, false, [&](size_t first, size_t end) {
+      for (size_t page = first; page < end; page++)
+        m_watched[page].store(true);
+      m_watched_pages.fetch_add(static_cast<u32>(end - first));
+      protect(GetPageAddress(first), static_cast<u32>((end - first) << PAGE_SHIFT));
+    });
+
+    return m_generation.load();
+  }
+
+  // Returns true if no write to the range was recorded after the given generation.
+  bool IsUnchangedSince(u32 address, u32 size, u64 generation) const;
+
+  // Returns false if writing to the range doesn't have to be recorded. This is the fast path of
+  // recording a write, and has to be called after the memory was written to.
+  bool IsWatched(u32 address, u32 size) const
+  {
+    // Makes sure that whoever starts watching a page after this check sees the data that was
+    // written before it.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_watched_pages.load(std::memory_order_relaxed) == 0)
+      return false;
+
+    const std::optional<std::pair<size_t, size_t>> pages = GetPages(address, size, true);
+    if (!pages)
+      return false;
+
+    for (size_t page = pages->first; page < pages->second; page++)
+    {
+      if (m_watched[page].load(std::memory_order_relaxed))
+        return true;
+    }
+    return false;
+  }
+
+  // Records a write to the range. Calls unprotect(address, size) for each run of watched pages,
+  // which stop being watched. Returns false if none of the pages was watched.
+  template <typename UnprotectFunc>
+  bool Unwatch(u32 address, u32 size, UnprotectFunc&& unprotect)
+  {
+    const std::optional<std::pair<size_t, size_t>> pages = GetPages(address, size, true);
+    if (!pages)
+      return false;
+
+    return UnwatchPages(pages->first, pages->second, unprotect);
+  }
+
+  // Records a write to every page.
+  template <typename UnprotectFunc>
+  void UnwatchAll(UnprotectFunc&& unprotect)
+  {
+    // Runs must not cross from MEM1 to MEM2, which aren't contiguous.
+    UnwatchPages(0, m_mem1_pages, unprotect);
+    UnwatchPages(m_mem1_pages, m_mem1_pages + m_mem2_pages, unprotect);
+  }
+
+  u32 GetWatchedPageCount() const { return m_watched_pages.load(std::memory_order_relaxed); }
+  // Returns true if the address is within MEM1 or MEM2, without mirroring.
+  bool IsTracked(u32 address) const
+  {
+    return (address & ~0x3FFFFFFFu) == 0 && GetPages(address, 1, false).has_value();
+  }
+
+private:
+  // Returns the indices of the first page and the page after the last one of the range. If clamp
+  // is set, a range that goes beyond the end of MEM1 or MEM2 is cut off there.
+  std::optional<std::pair<size_t, size_t>> GetPages(u32 address, u32 size, bool clamp) const;
+  u32 GetPageAddress(size_t page) const;
+
+  // Calls func(first, end) for each run of pages within [first, end) whose watched state is equal
+  // to watched.
+  template <typename Func>
+  void ForEachRun(size_t first, size_t end, bool watched, Func&& func)
+  {
+    size_t page = first;
+    while (page < end)
+    {
+      if (m_watched[page].load(std::memory_order_relaxed) != watched)
+      {
+        page++;
+        continue;
+      }
+
+      const size_t run_first = page;
+      while (page < end && m_watched[page].load(std::memory_order_relaxed) == watched)
+        page++;
+      func(run_first, page);
+    }
+  }
+
+  template <typename UnprotectFunc>
+  bool UnwatchPages(size_t first, size_t end, UnprotectFunc& unprotect)
+  {
+    bool any_watched = false;
+    u64 generation = 0;
+    ForEachRun(first, end, true, [&](size_t run_first, size_t run_end) {
+      if (!any_watched)
+        generation = m_generation.fetch_add(1) + 1;
+      any_watched = true;
+
+      for (size_t page = run_first; page < run_end; page++)
+      {
+        m_last_write[page].store(generation);
+        m_watched[page].store(false);
+      }
+      m_watched_pages.fetch_sub(static_cast<u32>(run_end - run_first));
+      unprotect(GetPageAddress(run_first), static_cast<u32>((run_end - run_first) << PAGE_SHIFT));
+    });
+    return any_watched;
+  }
+
+  std::unique_ptr<std::atomic<u64>[]> m_last_write;
+  std::unique_ptr<std::atomic<bool>[]> m_watched;
+  size_t m_mem1_pages = 0;
+  size_t m_mem2_pages = 0;
+
+  std::atomic<u64> m_generation = 0;
+  std::atomic<u32> m_watched_pages = 0;
+};
+}  // namespace Memory
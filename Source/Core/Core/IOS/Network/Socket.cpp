@@ -540,6 +540,7 @@ void WiiSocket::Update(bool read, bool write, bool except)
 
             if (ret >= 0)
             {
+              memory.RecordWrite(BufferIn2, ret);
               system.GetPowerPC().GetDebugInterface().NetworkLogger()->LogSSLRead(
                   memory.GetPointerForRange(BufferIn2, ret), ret, ssl->hostfd);
               // Return bytes read or SSL_ERR_ZERO if none
@@ -682,7 +683,10 @@ void WiiSocket::Update(bool read, bool write, bool except)
           ReturnValue = m_socket_manager.GetNetErrorCode(
               ret, BufferOutSize2 ? "SO_RECVFROM" : "SO_RECV", true);
           if (ret > 0)
+          {
+            memory.RecordWrite(BufferOut, ret);
             system.GetPowerPC().GetDebugInterface().NetworkLogger()->LogRead(data, ret, fd, from);
+          }
 
           INFO_LOG_FMT(IOS_NET,
                        "{}({}, {}) Socket: {:08X}, Flags: {:08X}, "
@@ -289,6 +289,7 @@ s32 SDIOSlot0Device::ExecuteCommand(const Request& request, u32 buffer_in, u32 b
 
       if (m_card.ReadBytes(memory.GetPointerForRange(req.addr, size), size))
       {
+        memory.RecordWrite(req.addr, size);
         DEBUG_LOG_FMT(IOS_SD, "Outbuffer size {} got {}", rw_buffer_size, size);
       }
       else
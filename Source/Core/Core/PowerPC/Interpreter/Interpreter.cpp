@@ -196,6 +196,18 @@ int Interpreter::SingleStepInner()
   return opinfo->num_cycles;
 }
 
+int Interpreter::RunBlock()
+{
+  m_end_block = false;
+
+  int cycles = 0;
+  while (!m_end_block)
+  {
+    cycles += SingleStepInner();
+  }
+  return cycles;
+}
+
 void Interpreter::SingleStep()
 {
   auto& core_timing = m_system.GetCoreTiming();
@@ -272,16 +284,7 @@ void Interpreter::Run()
     {
       // "fast" version of inner loop. well, it's not so fast.
       while (m_ppc_state.downcount > 0)
-      {
-        m_end_block = false;
-
-        int cycles = 0;
-        while (!m_end_block)
-        {
-          cycles += SingleStepInner();
-        }
-        m_ppc_state.downcount -= cycles;
-      }
+        m_ppc_state.downcount -= RunBlock();
     }
   }
 }
@@ -36,6 +36,8 @@ public:
   void Shutdown() override;
   void SingleStep() override;
   int SingleStepInner();
+  // Executes instructions until the end of the current block and returns the cycles taken.
+  int RunBlock();
 
   void Run() override;
   void ClearCache() override;
@@ -303,6 +303,7 @@ void Jit64::Init()
 
 void Jit64::ClearCache()
 {
+  m_cold_block_run_counts.clear();
   blocks.Clear();
   blocks.ClearRangesToFree();
   trampolines.ClearCodeSpace();
@@ -543,7 +544,21 @@ void Jit64::MSRUpdated(const OpArg& msr, X64Reg scratch_reg)
   }
 }
 
-void Jit64::WriteExit(u32 destination, bool bl, u32 after)
+BitSet32 Jit64::FlushGPRsForLink(u32 destination)
+{
+  BitSet32 preloaded_gprs;
+  if (m_enable_preloaded_entry_points && jo.enableBlocklink && !IsDebuggingEnabled())
+  {
+    const JitBlock* dest = blocks.GetBlockFromStartAddress(destination, m_ppc_state.feature_flags);
+    if (dest && dest->preloadedEntry)
+      preloaded_gprs = dest->preloaded_gprs;
+  }
+
+  gpr.FlushForLink(preloaded_gprs);
+  return preloaded_gprs;
+}
+
+void Jit64::WriteExit(u32 destination, bool bl, u32 after, BitSet32 preloaded_gprs)
 {
   if (!m_enable_blr_optimization)
     bl = false;
@@ -558,10 +573,10 @@ void Jit64::WriteExit(u32 destination, bool bl, u32 after)
 
   SUB(32, PPCSTATE(downcount), Imm32(js.downcountAmount));
 
-  JustWriteExit(destination, bl, after);
+  JustWriteExit(destination, bl, after, preloaded_gprs);
 }
 
-void Jit64::JustWriteExit(u32 destination, bool bl, u32 after)
+void Jit64::JustWriteExit(u32 destination, bool bl, u32 after, BitSet32 preloaded_gprs)
 {
   // If nobody has taken care of this yet (this can be removed when all branches are done)
   JitBlock* b = js.curBlock;
@@ -569,6 +584,7 @@ void Jit64::JustWriteExit(u32 destination, bool bl, u32 after)
   linkData.exitAddress = destination;
   linkData.linkStatus = false;
   linkData.call = bl;
+  linkData.preloaded_gprs = preloaded_gprs;
 
   MOV(32, PPCSTATE(pc), Imm32(destination));
 
@@ -837,6 +853,8 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
 #ifdef JIT_LOG_GENERATED_CODE
       LogGeneratedCode();
 #endif
+
+      blocks.WarmUpPersistentBlocks(b->physicalAddress);
       return;
     }
   }
@@ -952,9 +970,35 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
     }
   }
 
+  bool has_speculative_constants = false;
   if (!js.noSpeculativeConstantsAddresses.contains(js.blockStart))
   {
-    IntializeSpeculativeConstants();
+    has_speculative_constants = IntializeSpeculativeConstants();
+  }
+
+  // Linked predecessors which already hold the first few inputs of this block in the right host
+  // registers can enter after these loads. Anything specialized above has to be checked on every
+  // entry, so such blocks only get the normal entry point.
+  if (m_enable_preloaded_entry_points && jo.enableBlocklink && !IsDebuggingEnabled() &&
+      !IsProfilingEnabled() && !m_im_here_debug && !js.constantGqrValid &&
+      !has_speculative_constants)
+  {
+    BitSet32 preloaded_gprs;
+    for (const int preg : code_block.m_gpr_inputs)
+    {
+      if (preloaded_gprs.Count() == GPRRegCache::MAX_LINK_REGISTERS)
+        break;
+      preloaded_gprs[preg] = true;
+    }
+
+    if (preloaded_gprs)
+    {
+      // With no other registers bound, these end up at the start of the allocation order, which is
+      // where GPRRegCache::FlushForLink puts them.
+      gpr.PreloadRegisters(preloaded_gprs);
+      b->preloadedEntry = GetWritableCodePtr();
+      b->preloaded_gprs = preloaded_gprs;
+    }
   }
 
   // Translate instructions
@@ -1187,9 +1231,9 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
 
   if (code_block.m_broken)
   {
-    gpr.Flush();
+    const BitSet32 preloaded_gprs = FlushGPRsForLink(nextPC);
     fpr.Flush();
-    WriteExit(nextPC);
+    WriteExit(nextPC, false, 0, preloaded_gprs);
   }
 
   // When linking to an entry point immediately following it in memory, a JIT block's furthest
@@ -1259,7 +1303,7 @@ void Jit64::EnableOptimization()
   analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW);
 }
 
-void Jit64::IntializeSpeculativeConstants()
+bool Jit64::IntializeSpeculativeConstants()
 {
   // If the block depends on an input register which looks like a gather pipe or MMIO related
   // constant, guess that it is actually a constant input, and specialize the block based on this
@@ -1292,6 +1336,7 @@ void Jit64::IntializeSpeculativeConstants()
       gpr.SetImmediate32(i, compileTimeValue, false);
     }
   }
+  return target != nullptr;
 }
 
 bool Jit64::HandleFunctionHooking(u32 address)
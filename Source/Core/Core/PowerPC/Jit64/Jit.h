@@ -79,12 +79,13 @@ public:
   BitSet32 CallerSavedRegistersInUse() const;
   BitSet8 ComputeStaticGQRs(const PPCAnalyst::CodeBlock&) const;
 
-  void IntializeSpeculativeConstants();
+  bool IntializeSpeculativeConstants();
 
   JitBlockCache* GetBlockCache() override { return &blocks; }
   void Trace();
 
   void ClearCache() override;
+  bool CanInterpretColdBlocks() const override { return true; }
 
   const CommonAsmRoutines* GetAsmRoutines() override { return &asm_routines; }
   const char* GetName() const override { return "JIT64"; }
@@ -97,8 +98,12 @@ public:
   void EmitUpdateMembase();
   void MSRUpdated(const Gen::OpArg& msr, Gen::X64Reg scratch_reg);
   void FakeBLCall(u32 after);
-  void WriteExit(u32 destination, bool bl = false, u32 after = 0);
-  void JustWriteExit(u32 destination, bool bl, u32 after);
+  // Flushes all GPRs for an exit to destination. If the destination block has a preloaded entry
+  // point, the registers it expects are left in host registers and returned, to be passed on to
+  // WriteExit so that the link can use that entry point.
+  BitSet32 FlushGPRsForLink(u32 destination);
+  void WriteExit(u32 destination, bool bl = false, u32 after = 0, BitSet32 preloaded_gprs = {});
+  void JustWriteExit(u32 destination, bool bl, u32 after, BitSet32 preloaded_gprs = {});
   void WriteExitDestInRSCRATCH(bool bl = false, u32 after = 0);
   void WriteBLRExit();
   void WriteExceptionExit();
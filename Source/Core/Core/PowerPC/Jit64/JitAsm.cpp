@@ -218,9 +218,16 @@ void Jit64AsmRoutineManager::Generate()
   // If jitting triggered an ISI exception, MSR.DR may have changed
   MOV(64, R(RMEM), PPCSTATE(mem_ptr));
 
+  // With tiered compilation, JitTrampoline may have run a cold block in the interpreter, which
+  // consumes downcount. This is checked regardless of the setting so that toggling it doesn't
+  // require regenerating this code, and it's only reached when no compiled block was found.
+  CMP(32, PPCSTATE(downcount), Imm8(0));
+  FixupBranch interpreted_bail = J_CC(CC_LE, Jump::Near);
+
   JMP(dispatcher_no_check, Jump::Near);
 
   SetJumpTarget(bail);
+  SetJumpTarget(interpreted_bail);
   do_timing = GetCodePtr();
 
   // make sure npc contains the next pc (needed for exception checking in CoreTiming::Advance)
@@ -159,7 +159,11 @@ void Jit64::bx(UGeckoInstruction inst)
     return;
   }
 
-  gpr.Flush();
+  BitSet32 preloaded_gprs;
+  if (js.op->branchIsIdleLoop)
+    gpr.Flush();
+  else
+    preloaded_gprs = FlushGPRsForLink(js.op->branchTo);
   fpr.Flush();
 
   if (IsDebuggingEnabled())
@@ -177,7 +181,7 @@ void Jit64::bx(UGeckoInstruction inst)
   }
   else
   {
-    WriteExit(js.op->branchTo, inst.LK, js.compilerPC + 4);
+    WriteExit(js.op->branchTo, inst.LK, js.compilerPC + 4, preloaded_gprs);
   }
 }
 
@@ -235,7 +239,11 @@ void Jit64::bcx(UGeckoInstruction inst)
   {
     RCForkGuard gpr_guard = gpr.Fork();
     RCForkGuard fpr_guard = fpr.Fork();
-    gpr.Flush();
+    BitSet32 preloaded_gprs;
+    if (js.op->branchIsIdleLoop)
+      gpr.Flush();
+    else
+      preloaded_gprs = FlushGPRsForLink(js.op->branchTo);
     fpr.Flush();
 
     if (IsDebuggingEnabled())
@@ -249,7 +257,7 @@ void Jit64::bcx(UGeckoInstruction inst)
     }
     else
     {
-      WriteExit(js.op->branchTo, inst.LK, js.compilerPC + 4);
+      WriteExit(js.op->branchTo, inst.LK, js.compilerPC + 4, preloaded_gprs);
     }
   }
 
@@ -3,6 +3,10 @@
 
 #include "Core/PowerPC/Jit64/RegCache/GPRRegCache.h"
 
+#include <algorithm>
+#include <array>
+#include <span>
+
 #include "Common/x64Reg.h"
 #include "Core/PowerPC/Jit64/Jit.h"
 #include "Core/PowerPC/Jit64Common/Jit64PowerPCState.h"
@@ -44,6 +48,70 @@ std::span<const X64Reg> GPRRegCache::GetAllocationOrder() const
   return allocation_order;
 }
 
+void GPRRegCache::FlushForLink(BitSet32 pregs)
+{
+  ASSERT(static_cast<size_t>(pregs.Count()) <= MAX_LINK_REGISTERS);
+
+  struct Move
+  {
+    X64Reg dest;
+    X64Reg source;
+    preg_t preg;
+  };
+  std::array<Move, MAX_LINK_REGISTERS> moves;
+  size_t num_moves = 0;
+
+  // Flushing keeps the contents of the host registers intact, so note where each value currently
+  // lives before flushing.
+  const auto order = GetAllocationOrder();
+  for (preg_t preg : pregs)
+  {
+    const X64Reg source = m_regs[preg].IsBound() ? RX(preg) : INVALID_REG;
+    moves[num_moves] = {order[num_moves], source, preg};
+    num_moves++;
+  }
+
+  Flush();
+
+  // Everything is in PPCSTATE now, so a move whose source has been overwritten (or was never in a
+  // host register) can always fall back to loading from memory. This also breaks cycles.
+  while (num_moves > 0)
+  {
+    size_t next = 0;
+    for (; next < num_moves; next++)
+    {
+      const X64Reg dest = moves[next].dest;
+      const bool blocked =
+          std::ranges::any_of(std::span(moves.data(), num_moves), [&](const Move& m) {
+            return &m != &moves[next] && m.source == dest;
+          });
+      if (!blocked)
+        break;
+    }
+
+    if (next == num_moves)
+    {
+      // Only cycles are left. Any move that reads the destination we are about to overwrite has to
+      // load its value from memory instead.
+      next = 0;
+      for (size_t i = 1; i < num_moves; i++)
+      {
+        if (moves[i].source == moves[next].dest)
+          moves[i].source = INVALID_REG;
+      }
+    }
+
+    const Move& move = moves[next];
+    if (move.source == INVALID_REG)
+      m_emitter->MOV(32, ::Gen::R(move.dest), GetDefaultLocation(move.preg));
+    else if (move.source != move.dest)
+      m_emitter->MOV(32, ::Gen::R(move.dest), ::Gen::R(move.source));
+
+    moves[next] = moves[num_moves - 1];
+    num_moves--;
+  }
+}
+
 void GPRRegCache::SetImmediate32(preg_t preg, u32 imm_value, bool dirty)
 {
   // "dirty" can be false to avoid redundantly flushing an immediate when
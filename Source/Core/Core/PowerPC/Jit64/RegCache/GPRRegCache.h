@@ -13,6 +13,15 @@ public:
   explicit GPRRegCache(Jit64& jit);
   void SetImmediate32(preg_t preg, u32 imm_value, bool dirty = true);
 
+  // Maximum number of registers a block can receive in host registers from a linked predecessor.
+  // They are placed in the first entries of the allocation order, which are callee-saved on all
+  // supported ABIs and therefore survive the calls made by exit and entry sequences.
+  static constexpr size_t MAX_LINK_REGISTERS = 4;
+
+  // Flushes all registers, then leaves the values of pregs in the host registers that the preloaded
+  // entry point of a linked block expects them in (see Jit64::DoJit).
+  void FlushForLink(BitSet32 pregs);
+
 protected:
   Gen::OpArg GetDefaultLocation(preg_t preg) const override;
   void StoreRegister(preg_t preg, const Gen::OpArg& new_loc) override;
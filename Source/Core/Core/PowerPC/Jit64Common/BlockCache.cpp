@@ -14,7 +14,15 @@ JitBlockCache::JitBlockCache(JitBase& jit) : JitBaseBlockCache{jit}
 void JitBlockCache::WriteLinkBlock(const JitBlock::LinkData& source, const JitBlock* dest)
 {
   u8* location = source.exitPtrs;
-  const u8* address = dest ? dest->normalEntry : m_jit.GetAsmRoutines()->dispatcher_no_timing_check;
+  const u8* address = m_jit.GetAsmRoutines()->dispatcher_no_timing_check;
+  bool use_preloaded_entry = false;
+  if (dest)
+  {
+    // Exits that already hold the destination's expected registers can skip its loads.
+    use_preloaded_entry = dest->preloadedEntry && source.preloaded_gprs &&
+                          source.preloaded_gprs == dest->preloaded_gprs;
+    address = use_preloaded_entry ? dest->preloadedEntry : dest->normalEntry;
+  }
   if (source.call)
   {
     Gen::XEmitter emit(location, location + 5);
@@ -25,8 +33,9 @@ void JitBlockCache::WriteLinkBlock(const JitBlock::LinkData& source, const JitBl
     // If we're going to link with the next block, there is no need
     // to emit JMP. So just NOP out the gap to the next block.
     // Support up to 3 additional bytes because of alignment.
+    // The gap before a preloaded entry contains the loads of the normal entry, which must be kept.
     s64 offset = address - location;
-    if (offset > 0 && offset <= 5 + 3)
+    if (!use_preloaded_entry && offset > 0 && offset <= 5 + 3)
     {
       Gen::XEmitter emit(location, location + offset);
       emit.NOP(offset);
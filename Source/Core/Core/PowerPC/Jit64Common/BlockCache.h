@@ -23,8 +23,10 @@ public:
 
   void ClearRangesToFree();
 
-private:
+protected:
   void WriteLinkBlock(const JitBlock::LinkData& source, const JitBlock* dest) override;
+
+private:
   void WriteDestroyBlock(const JitBlock& block) override;
 
   std::vector<std::pair<u8*, u8*>> m_ranges_to_free_on_next_codegen_near;
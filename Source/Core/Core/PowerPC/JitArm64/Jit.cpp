@@ -7,6 +7,7 @@
 #include <optional>
 #include <span>
 #include <sstream>
+#include <vector>
 
 #include <fmt/format.h>
 #include <fmt/ostream.h>
@@ -1028,6 +1029,8 @@ void JitArm64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
 #ifdef JIT_LOG_GENERATED_CODE
       LogGeneratedCode();
 #endif
+
+      blocks.WarmUpPersistentBlocks(b->physicalAddress);
       return;
     }
   }
@@ -1125,7 +1128,6 @@ bool JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
 
   js.isLastInstruction = false;
   js.firstFPInstructionFound = false;
-  js.assumeNoPairedQuantize = false;
   js.blockStart = em_address;
   js.fifoBytesSinceCheck = 0;
   js.mustCheckFifo = false;
@@ -1135,6 +1137,7 @@ bool JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   js.carryFlag = CarryFlag::InPPCState;
   js.numLoadStoreInst = 0;
   js.numFloatingPointInst = 0;
+  js.constantGqrValid = BitSet8();
 
   b->normalEntry = GetWritableCodePtr();
 
@@ -1142,24 +1145,49 @@ bool JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   if (IsProfilingEnabled())
     ABI_CallFunction(&JitBlock::ProfileData::BeginProfiling, b->profile_data.get());
 
-  if (code_block.m_gqr_used.Count() == 1 && !js.pairedQuantizeAddresses.contains(js.blockStart))
+  // Assume that GQR values don't change often at runtime. Many paired-heavy games use largely float
+  // loads and stores, which can then use fastmem directly, and the other types can be dequantized
+  // inline with a constant scale instead of going through the asm routines.
+  if (!js.pairedQuantizeAddresses.contains(js.blockStart))
   {
-    int gqr = *code_block.m_gqr_used.begin();
-    if (!code_block.m_gqr_modified[gqr] && !GQR(m_ppc_state, gqr))
+    // If there are GQRs used but not set, we'll treat those as constant and optimize them
+    const BitSet8 gqr_static = code_block.m_gqr_used & ~code_block.m_gqr_modified;
+    if (gqr_static)
     {
-      LDR(IndexType::Unsigned, ARM64Reg::W0, PPC_REG, PPCSTATE_OFF_SPR(SPR_GQR0 + gqr));
-      FixupBranch no_fail = CBZ(ARM64Reg::W0);
-      FixupBranch fail = B();
+      std::vector<FixupBranch> fails;
+      for (int gqr : gqr_static)
+      {
+        const u32 value = GQR(m_ppc_state, gqr);
+        js.constantGqr[gqr] = value;
+
+        // Insert a check that the GQRs are still the value we expect at
+        // the start of the block in case our guess turns out wrong.
+        LDR(IndexType::Unsigned, ARM64Reg::W0, PPC_REG, PPCSTATE_OFF_SPR(SPR_GQR0 + gqr));
+        FixupBranch no_fail;
+        if (value == 0)
+        {
+          no_fail = CBZ(ARM64Reg::W0);
+        }
+        else
+        {
+          CMPI2R(ARM64Reg::W0, value, ARM64Reg::W1);
+          no_fail = B(CC_EQ);
+        }
+        fails.push_back(B());
+        SetJumpTarget(no_fail);
+      }
+
       SwitchToFarCode();
-      SetJumpTarget(fail);
+      for (const FixupBranch& fail : fails)
+        SetJumpTarget(fail);
       MOVI2R(DISPATCHER_PC, js.blockStart);
       STR(IndexType::Unsigned, DISPATCHER_PC, PPC_REG, PPCSTATE_OFF(pc));
       ABI_CallFunction(&JitInterface::CompileExceptionCheckFromJIT, &m_system.GetJitInterface(),
                        static_cast<u32>(JitInterface::ExceptionType::PairedQuantize));
       B(dispatcher_no_check);
       SwitchToNearCode();
-      SetJumpTarget(no_fail);
-      js.assumeNoPairedQuantize = true;
+
+      js.constantGqrValid = gqr_static;
     }
   }
 
@@ -321,6 +321,20 @@ protected:
   void GenerateQuantizedLoads();
   void GenerateQuantizedStores();
 
+  // Paired quantization helpers, shared by the asm routines above and by psq_l/psq_st when the
+  // GQR is known at compile time. A negative scale means that the scale is read from scale_reg
+  // (which gets clobbered) at runtime. Only the low 64 bits of the registers are used.
+  static u32 GetQuantizedSizeFlag(EQuantizeType type);
+  void EmitQuantizeScale(Arm64Gen::ARM64Reg dest, Arm64Gen::ARM64Reg src, const float* table,
+                         int scale, Arm64Gen::ARM64Reg scale_reg, Arm64Gen::ARM64Reg temp_gpr,
+                         Arm64Gen::ARM64Reg temp_fpr);
+  void EmitDequantize(Arm64Gen::ARM64Reg dest, Arm64Gen::ARM64Reg src, EQuantizeType type,
+                      int scale, Arm64Gen::ARM64Reg scale_reg, Arm64Gen::ARM64Reg temp_gpr,
+                      Arm64Gen::ARM64Reg temp_fpr);
+  void EmitQuantize(Arm64Gen::ARM64Reg dest, Arm64Gen::ARM64Reg src, EQuantizeType type, int scale,
+                    Arm64Gen::ARM64Reg scale_reg, Arm64Gen::ARM64Reg temp_gpr,
+                    Arm64Gen::ARM64Reg temp_fpr);
+
   void EmitUpdateMembase();
   void MSRUpdated(u32 msr);
   void MSRUpdated(Arm64Gen::ARM64Reg msr);
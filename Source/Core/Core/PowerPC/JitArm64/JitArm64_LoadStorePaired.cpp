@@ -22,9 +22,21 @@ void JitArm64::psq_lXX(UGeckoInstruction inst)
   INSTRUCTION_START
   JITDISABLE(bJITLoadStorePairedOff);
 
+  const s32 offset = inst.SIMM_12;
+  const bool indexed = inst.OPCD == 4;
+  const bool update = inst.OPCD == 57 || (inst.OPCD == 4 && !!(inst.SUBOP6 & 32));
+  const int i = indexed ? inst.Ix : inst.I;
+  const int w = indexed ? inst.Wx : inst.W;
+
+  // With a GQR that is known at compile time, the load is emitted inline and dequantized with a
+  // constant scale, rather than going through the asm routines.
+  const UGQR gqr(js.constantGqrValid[i] ? js.constantGqr[i] : 0);
+  const EQuantizeType type = gqr.ld_type;
+  const bool constant_gqr =
+      js.constantGqrValid[i] && (type == QUANTIZE_FLOAT || type >= QUANTIZE_U8);
+
   // If fastmem is enabled, the asm routines assume address translation is on.
-  FALLBACK_IF(!js.assumeNoPairedQuantize && jo.fastmem &&
-              !(m_ppc_state.feature_flags & FEATURE_FLAG_MSR_DR));
+  FALLBACK_IF(!constant_gqr && jo.fastmem && !(m_ppc_state.feature_flags & FEATURE_FLAG_MSR_DR));
 
   // X30 is LR
   // X0 is a temporary
@@ -32,15 +44,10 @@ void JitArm64::psq_lXX(UGeckoInstruction inst)
   // X2 is the scale
   // Q0 is the return register
   // Q1 is a temporary
-  const s32 offset = inst.SIMM_12;
-  const bool indexed = inst.OPCD == 4;
-  const bool update = inst.OPCD == 57 || (inst.OPCD == 4 && !!(inst.SUBOP6 & 32));
-  const int i = indexed ? inst.Ix : inst.I;
-  const int w = indexed ? inst.Wx : inst.W;
 
   gpr.Lock(ARM64Reg::W1, ARM64Reg::W30);
   fpr.Lock(ARM64Reg::Q0);
-  if (!js.assumeNoPairedQuantize)
+  if (!constant_gqr)
   {
     gpr.Lock(ARM64Reg::W0, ARM64Reg::W2, ARM64Reg::W3);
     fpr.Lock(ARM64Reg::Q1);
@@ -77,7 +84,7 @@ void JitArm64::psq_lXX(UGeckoInstruction inst)
     MOV(gpr.R(inst.RA), addr_reg);
   }
 
-  if (js.assumeNoPairedQuantize)
+  if (constant_gqr)
   {
     BitSet32 gprs_in_use = gpr.GetCallerSavedUsed();
     BitSet32 fprs_in_use = fpr.GetCallerSavedUsed();
@@ -91,12 +98,20 @@ void JitArm64::psq_lXX(UGeckoInstruction inst)
     if (!jo.memcheck)
       fprs_in_use[DecodeReg(VS)] = false;
 
-    u32 flags = BackPatchInfo::FLAG_LOAD | BackPatchInfo::FLAG_FLOAT | BackPatchInfo::FLAG_SIZE_32;
+    u32 flags = BackPatchInfo::FLAG_LOAD | BackPatchInfo::FLAG_FLOAT | GetQuantizedSizeFlag(type);
     if (!w)
       flags |= BackPatchInfo::FLAG_PAIR;
 
     EmitBackpatchRoutine(flags, MemAccessMode::Auto, VS, EncodeRegTo64(addr_reg), gprs_in_use,
                          fprs_in_use);
+
+    if (type != QUANTIZE_FLOAT)
+    {
+      auto temp_gpr = gpr.GetScopedReg();
+      auto temp_fpr = fpr.GetScopedReg();
+      EmitDequantize(VS, VS, type, gqr.ld_scale, ARM64Reg::INVALID_REG, EncodeRegTo64(temp_gpr),
+                     temp_fpr);
+    }
   }
   else
   {
@@ -135,7 +150,7 @@ void JitArm64::psq_lXX(UGeckoInstruction inst)
 
   gpr.Unlock(ARM64Reg::W1, ARM64Reg::W30);
   fpr.Unlock(ARM64Reg::Q0);
-  if (!js.assumeNoPairedQuantize)
+  if (!constant_gqr)
   {
     gpr.Unlock(ARM64Reg::W0, ARM64Reg::W2, ARM64Reg::W3);
     fpr.Unlock(ARM64Reg::Q1);
@@ -151,9 +166,21 @@ void JitArm64::psq_stXX(UGeckoInstruction inst)
   INSTRUCTION_START
   JITDISABLE(bJITLoadStorePairedOff);
 
+  const s32 offset = inst.SIMM_12;
+  const bool indexed = inst.OPCD == 4;
+  const bool update = inst.OPCD == 61 || (inst.OPCD == 4 && !!(inst.SUBOP6 & 32));
+  const int i = indexed ? inst.Ix : inst.I;
+  const int w = indexed ? inst.Wx : inst.W;
+
+  // With a GQR that is known at compile time, the value is quantized inline with a constant
+  // scale and stored directly, rather than going through the asm routines.
+  const UGQR gqr(js.constantGqrValid[i] ? js.constantGqr[i] : 0);
+  const EQuantizeType type = gqr.st_type;
+  const bool constant_gqr =
+      js.constantGqrValid[i] && (type == QUANTIZE_FLOAT || type >= QUANTIZE_U8);
+
   // If fastmem is enabled, the asm routines assume address translation is on.
-  FALLBACK_IF(!js.assumeNoPairedQuantize && jo.fastmem &&
-              !(m_ppc_state.feature_flags & FEATURE_FLAG_MSR_DR));
+  FALLBACK_IF(!constant_gqr && jo.fastmem && !(m_ppc_state.feature_flags & FEATURE_FLAG_MSR_DR));
 
   // X30 is LR
   // X0 is a temporary
@@ -161,14 +188,8 @@ void JitArm64::psq_stXX(UGeckoInstruction inst)
   // X2 is the address
   // Q0 is the store register
 
-  const s32 offset = inst.SIMM_12;
-  const bool indexed = inst.OPCD == 4;
-  const bool update = inst.OPCD == 61 || (inst.OPCD == 4 && !!(inst.SUBOP6 & 32));
-  const int i = indexed ? inst.Ix : inst.I;
-  const int w = indexed ? inst.Wx : inst.W;
-
   fpr.Lock(ARM64Reg::Q0);
-  if (!js.assumeNoPairedQuantize)
+  if (!constant_gqr)
     fpr.Lock(ARM64Reg::Q1);
 
   const bool have_single = fpr.IsSingle(inst.RS);
@@ -176,7 +197,7 @@ void JitArm64::psq_stXX(UGeckoInstruction inst)
   Arm64FPRCache::ScopedARM64Reg VS =
       fpr.R(inst.RS, have_single ? RegType::Single : RegType::Register);
 
-  if (js.assumeNoPairedQuantize)
+  if (constant_gqr)
   {
     if (!have_single)
     {
@@ -189,6 +210,26 @@ void JitArm64::psq_stXX(UGeckoInstruction inst)
 
       VS = std::move(single_reg);
     }
+
+    if (type != QUANTIZE_FLOAT)
+    {
+      auto temp_gpr = gpr.GetScopedReg();
+      auto temp_fpr = fpr.GetScopedReg();
+
+      if (have_single)
+      {
+        // Don't clobber the guest register.
+        auto quantized_reg = fpr.GetScopedReg();
+        EmitQuantize(quantized_reg, VS, type, gqr.st_scale, ARM64Reg::INVALID_REG,
+                     EncodeRegTo64(temp_gpr), temp_fpr);
+        VS = std::move(quantized_reg);
+      }
+      else
+      {
+        EmitQuantize(VS, VS, type, gqr.st_scale, ARM64Reg::INVALID_REG, EncodeRegTo64(temp_gpr),
+                     temp_fpr);
+      }
+    }
   }
   else
   {
@@ -206,9 +247,9 @@ void JitArm64::psq_stXX(UGeckoInstruction inst)
   }
 
   gpr.Lock(ARM64Reg::W1, ARM64Reg::W2, ARM64Reg::W30);
-  if (!js.assumeNoPairedQuantize || !jo.fastmem)
+  if (!constant_gqr || !jo.fastmem)
     gpr.Lock(ARM64Reg::W0);
-  if (!js.assumeNoPairedQuantize && !jo.fastmem)
+  if (!constant_gqr && !jo.fastmem)
     gpr.Lock(ARM64Reg::W3);
 
   constexpr ARM64Reg type_reg = ARM64Reg::W0;
@@ -237,7 +278,7 @@ void JitArm64::psq_stXX(UGeckoInstruction inst)
     MOV(gpr.R(inst.RA), addr_reg);
   }
 
-  if (js.assumeNoPairedQuantize)
+  if (constant_gqr)
   {
     BitSet32 gprs_in_use = gpr.GetCallerSavedUsed();
     BitSet32 fprs_in_use = fpr.GetCallerSavedUsed();
@@ -249,7 +290,8 @@ void JitArm64::psq_stXX(UGeckoInstruction inst)
     if (!jo.fastmem)
       gprs_in_use[DecodeReg(ARM64Reg::W0)] = false;
 
-    u32 flags = BackPatchInfo::FLAG_STORE | BackPatchInfo::FLAG_FLOAT | BackPatchInfo::FLAG_SIZE_32;
+    u32 flags =
+        BackPatchInfo::FLAG_STORE | BackPatchInfo::FLAG_FLOAT | GetQuantizedSizeFlag(type);
     if (!w)
       flags |= BackPatchInfo::FLAG_PAIR;
 
@@ -282,10 +324,10 @@ void JitArm64::psq_stXX(UGeckoInstruction inst)
 
   gpr.Unlock(ARM64Reg::W1, ARM64Reg::W2, ARM64Reg::W30);
   fpr.Unlock(ARM64Reg::Q0);
-  if (!js.assumeNoPairedQuantize || !jo.fastmem)
+  if (!constant_gqr || !jo.fastmem)
     gpr.Unlock(ARM64Reg::W0);
-  if (!js.assumeNoPairedQuantize && !jo.fastmem)
+  if (!constant_gqr && !jo.fastmem)
     gpr.Unlock(ARM64Reg::W3);
-  if (!js.assumeNoPairedQuantize)
+  if (!constant_gqr)
     fpr.Unlock(ARM64Reg::Q1);
 }
@@ -3,10 +3,13 @@
 
 #include "Core/PowerPC/JitArm64/Jit.h"
 
+#include <algorithm>
+#include <array>
 #include <bit>
 #include <limits>
 
 #include "Common/Arm64Emitter.h"
+#include "Common/Assert.h"
 #include "Common/CommonTypes.h"
 #include "Common/Config/Config.h"
 #include "Common/EnumUtils.h"
@@ -514,214 +517,175 @@ void JitArm64::GenerateFPRF(bool single)
   B(write_fprf_and_ret);
 }
 
-void JitArm64::GenerateQuantizedLoads()
+u32 JitArm64::GetQuantizedSizeFlag(EQuantizeType type)
 {
-  // X0 is a temporary
-  // X1 is the address
-  // X2 is the scale
-  // X3 is a temporary (used in EmitBackpatchRoutine)
-  // X30 is LR
-  // Q0 is the return
-  // Q1 is a temporary
-  ARM64Reg temp_reg = ARM64Reg::X0;
-  ARM64Reg addr_reg = ARM64Reg::X1;
-  ARM64Reg scale_reg = ARM64Reg::X2;
-  BitSet32 gprs_to_push = CALLER_SAVED_GPRS & ~BitSet32{0, 3};
-  if (!jo.memcheck)
-    gprs_to_push &= ~BitSet32{1};
-  BitSet32 fprs_to_push = BitSet32(0xFFFFFFFF) & ~BitSet32{0, 1};
-  ARM64FloatEmitter float_emit(this);
-
-  const u8* start = GetCodePtr();
-  const u8* loadPairedIllegal = GetCodePtr();
-  BRK(100);
-  const u8* loadPairedFloatTwo = GetCodePtr();
+  switch (type)
   {
-    constexpr u32 flags = BackPatchInfo::FLAG_LOAD | BackPatchInfo::FLAG_FLOAT |
-                          BackPatchInfo::FLAG_PAIR | BackPatchInfo::FLAG_SIZE_32;
-
-    EmitBackpatchRoutine(flags, MemAccessMode::Auto, ARM64Reg::D0, addr_reg,
-                         gprs_to_push & ~BitSet32{DecodeReg(scale_reg)}, fprs_to_push, true);
-
-    RET(ARM64Reg::X30);
+  case QUANTIZE_U8:
+  case QUANTIZE_S8:
+    return BackPatchInfo::FLAG_SIZE_8;
+  case QUANTIZE_U16:
+  case QUANTIZE_S16:
+    return BackPatchInfo::FLAG_SIZE_16;
+  default:
+    return BackPatchInfo::FLAG_SIZE_32;
   }
-  const u8* loadPairedU8Two = GetCodePtr();
-  {
-    constexpr u32 flags = BackPatchInfo::FLAG_LOAD | BackPatchInfo::FLAG_FLOAT |
-                          BackPatchInfo::FLAG_PAIR | BackPatchInfo::FLAG_SIZE_8;
-
-    EmitBackpatchRoutine(flags, MemAccessMode::Auto, ARM64Reg::D0, addr_reg, gprs_to_push,
-                         fprs_to_push, true);
-
-    float_emit.UXTL(8, ARM64Reg::D0, ARM64Reg::D0);
-    float_emit.UXTL(16, ARM64Reg::D0, ARM64Reg::D0);
-    float_emit.UCVTF(32, ARM64Reg::D0, ARM64Reg::D0);
+}
 
-    const s32 load_offset = MOVPage2R(ARM64Reg::X0, &m_dequantizeTableS);
-    ADD(scale_reg, ARM64Reg::X0, scale_reg, ArithOption(scale_reg, ShiftType::LSL, 3));
-    float_emit.LDR(32, IndexType::Unsigned, ARM64Reg::D1, scale_reg, load_offset);
-    float_emit.FMUL(32, ARM64Reg::D0, ARM64Reg::D0, ARM64Reg::D1, 0);
-    RET(ARM64Reg::X30);
-  }
-  const u8* loadPairedS8Two = GetCodePtr();
+void JitArm64::EmitQuantizeScale(ARM64Reg dest, ARM64Reg src, const float* table, int scale,
+                                 ARM64Reg scale_reg, ARM64Reg temp_gpr, ARM64Reg temp_fpr)
+{
+  // Both tables start with 1.0, so a constant scale of 0 needs no multiplication.
+  if (scale == 0)
   {
-    constexpr u32 flags = BackPatchInfo::FLAG_LOAD | BackPatchInfo::FLAG_FLOAT |
-                          BackPatchInfo::FLAG_PAIR | BackPatchInfo::FLAG_SIZE_8;
-
-    EmitBackpatchRoutine(flags, MemAccessMode::Auto, ARM64Reg::D0, addr_reg, gprs_to_push,
-                         fprs_to_push, true);
-
-    float_emit.SXTL(8, ARM64Reg::D0, ARM64Reg::D0);
-    float_emit.SXTL(16, ARM64Reg::D0, ARM64Reg::D0);
-    float_emit.SCVTF(32, ARM64Reg::D0, ARM64Reg::D0);
+    if (dest != src)
+      m_float_emit.ORR(EncodeRegToDouble(dest), EncodeRegToDouble(src), EncodeRegToDouble(src));
+    return;
+  }
 
-    const s32 load_offset = MOVPage2R(temp_reg, &m_dequantizeTableS);
-    ADD(scale_reg, temp_reg, scale_reg, ArithOption(scale_reg, ShiftType::LSL, 3));
-    float_emit.LDR(32, IndexType::Unsigned, ARM64Reg::D1, scale_reg, load_offset);
-    float_emit.FMUL(32, ARM64Reg::D0, ARM64Reg::D0, ARM64Reg::D1, 0);
-    RET(ARM64Reg::X30);
+  if (scale < 0)
+  {
+    const s32 load_offset = MOVPage2R(temp_gpr, table);
+    ADD(scale_reg, temp_gpr, scale_reg, ArithOption(scale_reg, ShiftType::LSL, 3));
+    m_float_emit.LDR(32, IndexType::Unsigned, EncodeRegToDouble(temp_fpr), scale_reg, load_offset);
   }
-  const u8* loadPairedU16Two = GetCodePtr();
+  else
   {
-    constexpr u32 flags = BackPatchInfo::FLAG_LOAD | BackPatchInfo::FLAG_FLOAT |
-                          BackPatchInfo::FLAG_PAIR | BackPatchInfo::FLAG_SIZE_16;
-
-    EmitBackpatchRoutine(flags, MemAccessMode::Auto, ARM64Reg::D0, addr_reg, gprs_to_push,
-                         fprs_to_push, true);
+    const s32 load_offset = MOVPage2R(temp_gpr, &table[scale * 2]);
+    m_float_emit.LDR(32, IndexType::Unsigned, EncodeRegToDouble(temp_fpr), temp_gpr, load_offset);
+  }
+  m_float_emit.FMUL(32, EncodeRegToDouble(dest), EncodeRegToDouble(src),
+                    EncodeRegToDouble(temp_fpr), 0);
+}
 
-    float_emit.UXTL(16, ARM64Reg::D0, ARM64Reg::D0);
-    float_emit.UCVTF(32, ARM64Reg::D0, ARM64Reg::D0);
+void JitArm64::EmitDequantize(ARM64Reg dest, ARM64Reg src, EQuantizeType type, int scale,
+                              ARM64Reg scale_reg, ARM64Reg temp_gpr, ARM64Reg temp_fpr)
+{
+  const ARM64Reg dest_reg = EncodeRegToDouble(dest);
+  const ARM64Reg src_reg = EncodeRegToDouble(src);
 
-    const s32 load_offset = MOVPage2R(temp_reg, &m_dequantizeTableS);
-    ADD(scale_reg, temp_reg, scale_reg, ArithOption(scale_reg, ShiftType::LSL, 3));
-    float_emit.LDR(32, IndexType::Unsigned, ARM64Reg::D1, scale_reg, load_offset);
-    float_emit.FMUL(32, ARM64Reg::D0, ARM64Reg::D0, ARM64Reg::D1, 0);
-    RET(ARM64Reg::X30);
-  }
-  const u8* loadPairedS16Two = GetCodePtr();
+  switch (type)
   {
-    constexpr u32 flags = BackPatchInfo::FLAG_LOAD | BackPatchInfo::FLAG_FLOAT |
-                          BackPatchInfo::FLAG_PAIR | BackPatchInfo::FLAG_SIZE_16;
+  case QUANTIZE_U8:
+    m_float_emit.UXTL(8, dest_reg, src_reg);
+    m_float_emit.UXTL(16, dest_reg, dest_reg);
+    m_float_emit.UCVTF(32, dest_reg, dest_reg);
+    break;
+  case QUANTIZE_S8:
+    m_float_emit.SXTL(8, dest_reg, src_reg);
+    m_float_emit.SXTL(16, dest_reg, dest_reg);
+    m_float_emit.SCVTF(32, dest_reg, dest_reg);
+    break;
+  case QUANTIZE_U16:
+    m_float_emit.UXTL(16, dest_reg, src_reg);
+    m_float_emit.UCVTF(32, dest_reg, dest_reg);
+    break;
+  case QUANTIZE_S16:
+    m_float_emit.SXTL(16, dest_reg, src_reg);
+    m_float_emit.SCVTF(32, dest_reg, dest_reg);
+    break;
+  default:
+    ASSERT_MSG(DYNA_REC, false, "Invalid dequantization type {}", Common::ToUnderlying(type));
+    return;
+  }
 
-    EmitBackpatchRoutine(flags, MemAccessMode::Auto, ARM64Reg::D0, addr_reg, gprs_to_push,
-                         fprs_to_push, true);
+  EmitQuantizeScale(dest_reg, dest_reg, m_dequantizeTableS, scale, scale_reg, temp_gpr, temp_fpr);
+}
 
-    float_emit.SXTL(16, ARM64Reg::D0, ARM64Reg::D0);
-    float_emit.SCVTF(32, ARM64Reg::D0, ARM64Reg::D0);
+void JitArm64::EmitQuantize(ARM64Reg dest, ARM64Reg src, EQuantizeType type, int scale,
+                            ARM64Reg scale_reg, ARM64Reg temp_gpr, ARM64Reg temp_fpr)
+{
+  const ARM64Reg dest_reg = EncodeRegToDouble(dest);
 
-    const s32 load_offset = MOVPage2R(temp_reg, &m_dequantizeTableS);
-    ADD(scale_reg, temp_reg, scale_reg, ArithOption(scale_reg, ShiftType::LSL, 3));
-    float_emit.LDR(32, IndexType::Unsigned, ARM64Reg::D1, scale_reg, load_offset);
-    float_emit.FMUL(32, ARM64Reg::D0, ARM64Reg::D0, ARM64Reg::D1, 0);
-    RET(ARM64Reg::X30);
-  }
+  EmitQuantizeScale(dest_reg, src, m_quantizeTableS, scale, scale_reg, temp_gpr, temp_fpr);
 
-  const u8* loadPairedFloatOne = GetCodePtr();
+  switch (type)
   {
-    constexpr u32 flags =
-        BackPatchInfo::FLAG_LOAD | BackPatchInfo::FLAG_FLOAT | BackPatchInfo::FLAG_SIZE_32;
-
-    EmitBackpatchRoutine(flags, MemAccessMode::Auto, ARM64Reg::D0, addr_reg,
-                         gprs_to_push & ~BitSet32{DecodeReg(scale_reg)}, fprs_to_push, true);
-
-    RET(ARM64Reg::X30);
+  case QUANTIZE_U8:
+    m_float_emit.FCVTZU(32, dest_reg, dest_reg);
+    m_float_emit.UQXTN(16, dest_reg, dest_reg);
+    m_float_emit.UQXTN(8, dest_reg, dest_reg);
+    break;
+  case QUANTIZE_S8:
+    m_float_emit.FCVTZS(32, dest_reg, dest_reg);
+    m_float_emit.SQXTN(16, dest_reg, dest_reg);
+    m_float_emit.SQXTN(8, dest_reg, dest_reg);
+    break;
+  case QUANTIZE_U16:
+    m_float_emit.FCVTZU(32, dest_reg, dest_reg);
+    m_float_emit.UQXTN(16, dest_reg, dest_reg);
+    break;
+  case QUANTIZE_S16:
+    m_float_emit.FCVTZS(32, dest_reg, dest_reg);
+    m_float_emit.SQXTN(16, dest_reg, dest_reg);
+    break;
+  default:
+    ASSERT_MSG(DYNA_REC, false, "Invalid quantization type {}", Common::ToUnderlying(type));
+    break;
   }
-  const u8* loadPairedU8One = GetCodePtr();
-  {
-    constexpr u32 flags =
-        BackPatchInfo::FLAG_LOAD | BackPatchInfo::FLAG_FLOAT | BackPatchInfo::FLAG_SIZE_8;
-
-    EmitBackpatchRoutine(flags, MemAccessMode::Auto, ARM64Reg::D0, addr_reg, gprs_to_push,
-                         fprs_to_push, true);
-
-    float_emit.UXTL(8, ARM64Reg::D0, ARM64Reg::D0);
-    float_emit.UXTL(16, ARM64Reg::D0, ARM64Reg::D0);
-    float_emit.UCVTF(32, ARM64Reg::D0, ARM64Reg::D0);
+}
 
-    const s32 load_offset = MOVPage2R(temp_reg, &m_dequantizeTableS);
-    ADD(scale_reg, temp_reg, scale_reg, ArithOption(scale_reg, ShiftType::LSL, 3));
-    float_emit.LDR(32, IndexType::Unsigned, ARM64Reg::D1, scale_reg, load_offset);
-    float_emit.FMUL(32, ARM64Reg::D0, ARM64Reg::D0, ARM64Reg::D1, 0);
-    RET(ARM64Reg::X30);
-  }
-  const u8* loadPairedS8One = GetCodePtr();
-  {
-    constexpr u32 flags =
-        BackPatchInfo::FLAG_LOAD | BackPatchInfo::FLAG_FLOAT | BackPatchInfo::FLAG_SIZE_8;
+void JitArm64::GenerateQuantizedLoads()
+{
+  // X0 is a temporary
+  // X1 is the address
+  // X2 is the scale
+  // X3 is a temporary (used in EmitBackpatchRoutine)
+  // X30 is LR
+  // Q0 is the return
+  // Q1 is a temporary
+  ARM64Reg temp_reg = ARM64Reg::X0;
+  ARM64Reg addr_reg = ARM64Reg::X1;
+  ARM64Reg scale_reg = ARM64Reg::X2;
+  BitSet32 gprs_to_push = CALLER_SAVED_GPRS & ~BitSet32{0, 3};
+  if (!jo.memcheck)
+    gprs_to_push &= ~BitSet32{1};
+  BitSet32 fprs_to_push = BitSet32(0xFFFFFFFF) & ~BitSet32{0, 1};
 
-    EmitBackpatchRoutine(flags, MemAccessMode::Auto, ARM64Reg::D0, addr_reg, gprs_to_push,
-                         fprs_to_push, true);
+  const u8* start = GetCodePtr();
+  const u8* load_illegal = GetCodePtr();
+  BRK(100);
 
-    float_emit.SXTL(8, ARM64Reg::D0, ARM64Reg::D0);
-    float_emit.SXTL(16, ARM64Reg::D0, ARM64Reg::D0);
-    float_emit.SCVTF(32, ARM64Reg::D0, ARM64Reg::D0);
+  std::array<const u8*, 8> paired_routines;
+  std::array<const u8*, 8> single_routines;
+  paired_routines.fill(load_illegal);
+  single_routines.fill(load_illegal);
 
-    const s32 load_offset = MOVPage2R(temp_reg, &m_dequantizeTableS);
-    ADD(scale_reg, temp_reg, scale_reg, ArithOption(scale_reg, ShiftType::LSL, 3));
-    float_emit.LDR(32, IndexType::Unsigned, ARM64Reg::D1, scale_reg, load_offset);
-    float_emit.FMUL(32, ARM64Reg::D0, ARM64Reg::D0, ARM64Reg::D1, 0);
-    RET(ARM64Reg::X30);
-  }
-  const u8* loadPairedU16One = GetCodePtr();
+  for (const EQuantizeType type :
+       {QUANTIZE_FLOAT, QUANTIZE_U8, QUANTIZE_U16, QUANTIZE_S8, QUANTIZE_S16})
   {
-    constexpr u32 flags =
-        BackPatchInfo::FLAG_LOAD | BackPatchInfo::FLAG_FLOAT | BackPatchInfo::FLAG_SIZE_16;
-
-    EmitBackpatchRoutine(flags, MemAccessMode::Auto, ARM64Reg::D0, addr_reg, gprs_to_push,
-                         fprs_to_push, true);
-
-    float_emit.UXTL(16, ARM64Reg::D0, ARM64Reg::D0);
-    float_emit.UCVTF(32, ARM64Reg::D0, ARM64Reg::D0);
+    for (const bool single : {false, true})
+    {
+      (single ? single_routines : paired_routines)[type] = GetCodePtr();
 
-    const s32 load_offset = MOVPage2R(temp_reg, &m_dequantizeTableS);
-    ADD(scale_reg, temp_reg, scale_reg, ArithOption(scale_reg, ShiftType::LSL, 3));
-    float_emit.LDR(32, IndexType::Unsigned, ARM64Reg::D1, scale_reg, load_offset);
-    float_emit.FMUL(32, ARM64Reg::D0, ARM64Reg::D0, ARM64Reg::D1, 0);
-    RET(ARM64Reg::X30);
-  }
-  const u8* loadPairedS16One = GetCodePtr();
-  {
-    constexpr u32 flags =
-        BackPatchInfo::FLAG_LOAD | BackPatchInfo::FLAG_FLOAT | BackPatchInfo::FLAG_SIZE_16;
+      u32 flags =
+          BackPatchInfo::FLAG_LOAD | BackPatchInfo::FLAG_FLOAT | GetQuantizedSizeFlag(type);
+      if (!single)
+        flags |= BackPatchInfo::FLAG_PAIR;
 
-    EmitBackpatchRoutine(flags, MemAccessMode::Auto, ARM64Reg::D0, addr_reg, gprs_to_push,
-                         fprs_to_push, true);
+      // Float loads don't need the scale afterwards, so it doesn't have to be preserved.
+      const BitSet32 gprs = type == QUANTIZE_FLOAT ?
+                                gprs_to_push & ~BitSet32{DecodeReg(scale_reg)} :
+                                gprs_to_push;
+      EmitBackpatchRoutine(flags, MemAccessMode::Auto, ARM64Reg::D0, addr_reg, gprs, fprs_to_push,
+                           true);
 
-    float_emit.SXTL(16, ARM64Reg::D0, ARM64Reg::D0);
-    float_emit.SCVTF(32, ARM64Reg::D0, ARM64Reg::D0);
+      if (type != QUANTIZE_FLOAT)
+        EmitDequantize(ARM64Reg::D0, ARM64Reg::D0, type, -1, scale_reg, temp_reg, ARM64Reg::D1);
 
-    const s32 load_offset = MOVPage2R(temp_reg, &m_dequantizeTableS);
-    ADD(scale_reg, temp_reg, scale_reg, ArithOption(scale_reg, ShiftType::LSL, 3));
-    float_emit.LDR(32, IndexType::Unsigned, ARM64Reg::D1, scale_reg, load_offset);
-    float_emit.FMUL(32, ARM64Reg::D0, ARM64Reg::D0, ARM64Reg::D1, 0);
-    RET(ARM64Reg::X30);
+      RET(ARM64Reg::X30);
+    }
   }
 
   Common::JitRegister::Register(start, GetCodePtr(), "JIT_QuantizedLoad");
 
   paired_load_quantized = reinterpret_cast<const u8**>(AlignCode16());
   ReserveCodeSpace(8 * sizeof(u8*));
-
-  paired_load_quantized[0] = loadPairedFloatTwo;
-  paired_load_quantized[1] = loadPairedIllegal;
-  paired_load_quantized[2] = loadPairedIllegal;
-  paired_load_quantized[3] = loadPairedIllegal;
-  paired_load_quantized[4] = loadPairedU8Two;
-  paired_load_quantized[5] = loadPairedU16Two;
-  paired_load_quantized[6] = loadPairedS8Two;
-  paired_load_quantized[7] = loadPairedS16Two;
+  std::ranges::copy(paired_routines, paired_load_quantized);
 
   single_load_quantized = reinterpret_cast<const u8**>(AlignCode16());
   ReserveCodeSpace(8 * sizeof(u8*));
-
-  single_load_quantized[0] = loadPairedFloatOne;
-  single_load_quantized[1] = loadPairedIllegal;
-  single_load_quantized[2] = loadPairedIllegal;
-  single_load_quantized[3] = loadPairedIllegal;
-  single_load_quantized[4] = loadPairedU8One;
-  single_load_quantized[5] = loadPairedU16One;
-  single_load_quantized[6] = loadPairedS8One;
-  single_load_quantized[7] = loadPairedS16One;
+  std::ranges::copy(single_routines, single_load_quantized);
 }
 
 void JitArm64::GenerateQuantizedStores()
@@ -742,204 +706,45 @@ void JitArm64::GenerateQuantizedStores()
   if (!jo.fastmem)
     gprs_to_push &= ~BitSet32{3};
   BitSet32 fprs_to_push = BitSet32(0xFFFFFFFF) & ~BitSet32{0, 1};
-  ARM64FloatEmitter float_emit(this);
 
   const u8* start = GetCodePtr();
-  const u8* storePairedIllegal = GetCodePtr();
+  const u8* store_illegal = GetCodePtr();
   BRK(0x101);
-  const u8* storePairedFloat = GetCodePtr();
-  {
-    constexpr u32 flags = BackPatchInfo::FLAG_STORE | BackPatchInfo::FLAG_FLOAT |
-                          BackPatchInfo::FLAG_PAIR | BackPatchInfo::FLAG_SIZE_32;
-
-    EmitBackpatchRoutine(flags, MemAccessMode::Auto, ARM64Reg::D0, addr_reg, gprs_to_push,
-                         fprs_to_push, true);
-
-    RET(ARM64Reg::X30);
-  }
-  const u8* storePairedU8 = GetCodePtr();
-  {
-    const s32 load_offset = MOVPage2R(temp_reg, &m_quantizeTableS);
-    ADD(scale_reg, temp_reg, scale_reg, ArithOption(scale_reg, ShiftType::LSL, 3));
-    float_emit.LDR(32, IndexType::Unsigned, ARM64Reg::D1, scale_reg, load_offset);
-    float_emit.FMUL(32, ARM64Reg::D0, ARM64Reg::D0, ARM64Reg::D1, 0);
-
-    float_emit.FCVTZU(32, ARM64Reg::D0, ARM64Reg::D0);
-    float_emit.UQXTN(16, ARM64Reg::D0, ARM64Reg::D0);
-    float_emit.UQXTN(8, ARM64Reg::D0, ARM64Reg::D0);
 
-    constexpr u32 flags = BackPatchInfo::FLAG_STORE | BackPatchInfo::FLAG_FLOAT |
-                          BackPatchInfo::FLAG_PAIR | BackPatchInfo::FLAG_SIZE_8;
+  std::array<const u8*, 8> paired_routines;
+  std::array<const u8*, 8> single_routines;
+  paired_routines.fill(store_illegal);
+  single_routines.fill(store_illegal);
 
-    EmitBackpatchRoutine(flags, MemAccessMode::Auto, ARM64Reg::D0, addr_reg, gprs_to_push,
-                         fprs_to_push, true);
-
-    RET(ARM64Reg::X30);
-  }
-  const u8* storePairedS8 = GetCodePtr();
-  {
-    const s32 load_offset = MOVPage2R(temp_reg, &m_quantizeTableS);
-    ADD(scale_reg, temp_reg, scale_reg, ArithOption(scale_reg, ShiftType::LSL, 3));
-    float_emit.LDR(32, IndexType::Unsigned, ARM64Reg::D1, scale_reg, load_offset);
-    float_emit.FMUL(32, ARM64Reg::D0, ARM64Reg::D0, ARM64Reg::D1, 0);
-
-    float_emit.FCVTZS(32, ARM64Reg::D0, ARM64Reg::D0);
-    float_emit.SQXTN(16, ARM64Reg::D0, ARM64Reg::D0);
-    float_emit.SQXTN(8, ARM64Reg::D0, ARM64Reg::D0);
-
-    constexpr u32 flags = BackPatchInfo::FLAG_STORE | BackPatchInfo::FLAG_FLOAT |
-                          BackPatchInfo::FLAG_PAIR | BackPatchInfo::FLAG_SIZE_8;
-
-    EmitBackpatchRoutine(flags, MemAccessMode::Auto, ARM64Reg::D0, addr_reg, gprs_to_push,
-                         fprs_to_push, true);
-
-    RET(ARM64Reg::X30);
-  }
-  const u8* storePairedU16 = GetCodePtr();
+  for (const EQuantizeType type :
+       {QUANTIZE_FLOAT, QUANTIZE_U8, QUANTIZE_U16, QUANTIZE_S8, QUANTIZE_S16})
   {
-    const s32 load_offset = MOVPage2R(temp_reg, &m_quantizeTableS);
-    ADD(scale_reg, temp_reg, scale_reg, ArithOption(scale_reg, ShiftType::LSL, 3));
-    float_emit.LDR(32, IndexType::Unsigned, ARM64Reg::D1, scale_reg, load_offset);
-    float_emit.FMUL(32, ARM64Reg::D0, ARM64Reg::D0, ARM64Reg::D1, 0);
-
-    float_emit.FCVTZU(32, ARM64Reg::D0, ARM64Reg::D0);
-    float_emit.UQXTN(16, ARM64Reg::D0, ARM64Reg::D0);
-
-    constexpr u32 flags = BackPatchInfo::FLAG_STORE | BackPatchInfo::FLAG_FLOAT |
-                          BackPatchInfo::FLAG_PAIR | BackPatchInfo::FLAG_SIZE_16;
-
-    EmitBackpatchRoutine(flags, MemAccessMode::Auto, ARM64Reg::D0, addr_reg, gprs_to_push,
-                         fprs_to_push, true);
-
-    RET(ARM64Reg::X30);
-  }
-  const u8* storePairedS16 = GetCodePtr();  // Used by Viewtiful Joe's intro movie
-  {
-    const s32 load_offset = MOVPage2R(temp_reg, &m_quantizeTableS);
-    ADD(scale_reg, temp_reg, scale_reg, ArithOption(scale_reg, ShiftType::LSL, 3));
-    float_emit.LDR(32, IndexType::Unsigned, ARM64Reg::D1, scale_reg, load_offset);
-    float_emit.FMUL(32, ARM64Reg::D0, ARM64Reg::D0, ARM64Reg::D1, 0);
-
-    float_emit.FCVTZS(32, ARM64Reg::D0, ARM64Reg::D0);
-    float_emit.SQXTN(16, ARM64Reg::D0, ARM64Reg::D0);
-
-    constexpr u32 flags = BackPatchInfo::FLAG_STORE | BackPatchInfo::FLAG_FLOAT |
-                          BackPatchInfo::FLAG_PAIR | BackPatchInfo::FLAG_SIZE_16;
-
-    EmitBackpatchRoutine(flags, MemAccessMode::Auto, ARM64Reg::D0, addr_reg, gprs_to_push,
-                         fprs_to_push, true);
-
-    RET(ARM64Reg::X30);
-  }
-
-  const u8* storeSingleFloat = GetCodePtr();
-  {
-    constexpr u32 flags =
-        BackPatchInfo::FLAG_STORE | BackPatchInfo::FLAG_FLOAT | BackPatchInfo::FLAG_SIZE_32;
-
-    EmitBackpatchRoutine(flags, MemAccessMode::Auto, ARM64Reg::D0, addr_reg, gprs_to_push,
-                         fprs_to_push, true);
-
-    RET(ARM64Reg::X30);
-  }
-  const u8* storeSingleU8 = GetCodePtr();  // Used by MKWii
-  {
-    const s32 load_offset = MOVPage2R(temp_reg, &m_quantizeTableS);
-    ADD(scale_reg, temp_reg, scale_reg, ArithOption(scale_reg, ShiftType::LSL, 3));
-    float_emit.LDR(32, IndexType::Unsigned, ARM64Reg::D1, scale_reg, load_offset);
-    float_emit.FMUL(32, ARM64Reg::D0, ARM64Reg::D0, ARM64Reg::D1);
-
-    float_emit.FCVTZU(32, ARM64Reg::D0, ARM64Reg::D0);
-    float_emit.UQXTN(16, ARM64Reg::D0, ARM64Reg::D0);
-    float_emit.UQXTN(8, ARM64Reg::D0, ARM64Reg::D0);
-
-    constexpr u32 flags =
-        BackPatchInfo::FLAG_STORE | BackPatchInfo::FLAG_FLOAT | BackPatchInfo::FLAG_SIZE_8;
-
-    EmitBackpatchRoutine(flags, MemAccessMode::Auto, ARM64Reg::D0, addr_reg, gprs_to_push,
-                         fprs_to_push, true);
-
-    RET(ARM64Reg::X30);
-  }
-  const u8* storeSingleS8 = GetCodePtr();
-  {
-    const s32 load_offset = MOVPage2R(temp_reg, &m_quantizeTableS);
-    ADD(scale_reg, temp_reg, scale_reg, ArithOption(scale_reg, ShiftType::LSL, 3));
-    float_emit.LDR(32, IndexType::Unsigned, ARM64Reg::D1, scale_reg, load_offset);
-    float_emit.FMUL(32, ARM64Reg::D0, ARM64Reg::D0, ARM64Reg::D1);
-
-    float_emit.FCVTZS(32, ARM64Reg::D0, ARM64Reg::D0);
-    float_emit.SQXTN(16, ARM64Reg::D0, ARM64Reg::D0);
-    float_emit.SQXTN(8, ARM64Reg::D0, ARM64Reg::D0);
-
-    constexpr u32 flags =
-        BackPatchInfo::FLAG_STORE | BackPatchInfo::FLAG_FLOAT | BackPatchInfo::FLAG_SIZE_8;
-
-    EmitBackpatchRoutine(flags, MemAccessMode::Auto, ARM64Reg::D0, addr_reg, gprs_to_push,
-                         fprs_to_push, true);
-
-    RET(ARM64Reg::X30);
-  }
-  const u8* storeSingleU16 = GetCodePtr();  // Used by MKWii
-  {
-    const s32 load_offset = MOVPage2R(temp_reg, &m_quantizeTableS);
-    ADD(scale_reg, temp_reg, scale_reg, ArithOption(scale_reg, ShiftType::LSL, 3));
-    float_emit.LDR(32, IndexType::Unsigned, ARM64Reg::D1, scale_reg, load_offset);
-    float_emit.FMUL(32, ARM64Reg::D0, ARM64Reg::D0, ARM64Reg::D1);
-
-    float_emit.FCVTZU(32, ARM64Reg::D0, ARM64Reg::D0);
-    float_emit.UQXTN(16, ARM64Reg::D0, ARM64Reg::D0);
-
-    constexpr u32 flags =
-        BackPatchInfo::FLAG_STORE | BackPatchInfo::FLAG_FLOAT | BackPatchInfo::FLAG_SIZE_16;
-
-    EmitBackpatchRoutine(flags, MemAccessMode::Auto, ARM64Reg::D0, addr_reg, gprs_to_push,
-                         fprs_to_push, true);
-
-    RET(ARM64Reg::X30);
-  }
-  const u8* storeSingleS16 = GetCodePtr();
-  {
-    const s32 load_offset = MOVPage2R(temp_reg, &m_quantizeTableS);
-    ADD(scale_reg, temp_reg, scale_reg, ArithOption(scale_reg, ShiftType::LSL, 3));
-    float_emit.LDR(32, IndexType::Unsigned, ARM64Reg::D1, scale_reg, load_offset);
-    float_emit.FMUL(32, ARM64Reg::D0, ARM64Reg::D0, ARM64Reg::D1);
+    for (const bool single : {false, true})
+    {
+      (single ? single_routines : paired_routines)[type] = GetCodePtr();
 
-    float_emit.FCVTZS(32, ARM64Reg::D0, ARM64Reg::D0);
-    float_emit.SQXTN(16, ARM64Reg::D0, ARM64Reg::D0);
+      if (type != QUANTIZE_FLOAT)
+        EmitQuantize(ARM64Reg::D0, ARM64Reg::D0, type, -1, scale_reg, temp_reg, ARM64Reg::D1);
 
-    constexpr u32 flags =
-        BackPatchInfo::FLAG_STORE | BackPatchInfo::FLAG_FLOAT | BackPatchInfo::FLAG_SIZE_16;
+      u32 flags =
+          BackPatchInfo::FLAG_STORE | BackPatchInfo::FLAG_FLOAT | GetQuantizedSizeFlag(type);
+      if (!single)
+        flags |= BackPatchInfo::FLAG_PAIR;
 
-    EmitBackpatchRoutine(flags, MemAccessMode::Auto, ARM64Reg::D0, addr_reg, gprs_to_push,
-                         fprs_to_push, true);
+      EmitBackpatchRoutine(flags, MemAccessMode::Auto, ARM64Reg::D0, addr_reg, gprs_to_push,
+                           fprs_to_push, true);
 
-    RET(ARM64Reg::X30);
+      RET(ARM64Reg::X30);
+    }
   }
 
   Common::JitRegister::Register(start, GetCodePtr(), "JIT_QuantizedStore");
 
   paired_store_quantized = reinterpret_cast<const u8**>(AlignCode16());
   ReserveCodeSpace(8 * sizeof(u8*));
-
-  paired_store_quantized[0] = storePairedFloat;
-  paired_store_quantized[1] = storePairedIllegal;
-  paired_store_quantized[2] = storePairedIllegal;
-  paired_store_quantized[3] = storePairedIllegal;
-  paired_store_quantized[4] = storePairedU8;
-  paired_store_quantized[5] = storePairedU16;
-  paired_store_quantized[6] = storePairedS8;
-  paired_store_quantized[7] = storePairedS16;
+  std::ranges::copy(paired_routines, paired_store_quantized);
 
   single_store_quantized = reinterpret_cast<const u8**>(AlignCode16());
   ReserveCodeSpace(8 * sizeof(u8*));
-
-  single_store_quantized[0] = storeSingleFloat;
-  single_store_quantized[1] = storePairedIllegal;
-  single_store_quantized[2] = storePairedIllegal;
-  single_store_quantized[3] = storePairedIllegal;
-  single_store_quantized[4] = storeSingleU8;
-  single_store_quantized[5] = storeSingleU16;
-  single_store_quantized[6] = storeSingleS8;
-  single_store_quantized[7] = storeSingleS16;
+  std::ranges::copy(single_routines, single_store_quantized);
 }
@@ -19,6 +19,7 @@
 #include "Core/CoreTiming.h"
 #include "Core/HW/CPU.h"
 #include "Core/MemTools.h"
+#include "Core/PowerPC/Interpreter/Interpreter.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
@@ -57,7 +58,7 @@
 // After resetting the stack to the top, we call _resetstkoflw() to restore
 // the guard page at the 256kb mark.
 
-const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 23> JitBase::JIT_SETTINGS{{
+const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 26> JitBase::JIT_SETTINGS{{
     {&JitBase::bJITOff, &Config::MAIN_DEBUG_JIT_OFF},
     {&JitBase::bJITLoadStoreOff, &Config::MAIN_DEBUG_JIT_LOAD_STORE_OFF},
     {&JitBase::bJITLoadStorelXzOff, &Config::MAIN_DEBUG_JIT_LOAD_STORE_LXZ_OFF},
@@ -81,6 +82,9 @@ const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 23> JitB
     {&JitBase::m_accurate_nans, &Config::MAIN_ACCURATE_NANS},
     {&JitBase::m_fastmem_enabled, &Config::MAIN_FASTMEM},
     {&JitBase::m_accurate_cpu_cache_enabled, &Config::MAIN_ACCURATE_CPU_CACHE},
+    {&JitBase::m_enable_tiered_compilation, &Config::MAIN_JIT_TIERED_COMPILATION},
+    {&JitBase::m_enable_trace_compilation, &Config::MAIN_JIT_TRACE_COMPILATION},
+    {&JitBase::m_enable_preloaded_entry_points, &Config::MAIN_JIT_PRELOADED_ENTRY_POINTS},
 }};
 
 const u8* JitBase::Dispatch(JitBase& jit)
@@ -90,7 +94,58 @@ const u8* JitBase::Dispatch(JitBase& jit)
 
 void JitTrampoline(JitBase& jit, u32 em_address)
 {
+  if (jit.InterpretColdBlock(em_address))
+    return;
+
   jit.Jit(em_address);
+  jit.GetBlockCache()->CompileQueuedPersistentBlocks();
+}
+
+bool JitBase::InterpretColdBlock(u32 em_address)
+{
+  if (!m_enable_tiered_compilation || m_enable_debugging || !CanInterpretColdBlocks())
+    return false;
+
+  const u64 key = (u64{m_ppc_state.feature_flags} << 32) | em_address;
+  // Forgetting the counts only means that some blocks are interpreted a few more times.
+  if (m_cold_block_run_counts.size() >= MAX_COLD_BLOCKS && !m_cold_block_run_counts.contains(key))
+    m_cold_block_run_counts.clear();
+  u32& run_count = m_cold_block_run_counts[key];
+  if (run_count >= TIER_UP_THRESHOLD)
+    return false;
+
+  ++run_count;
+  m_ppc_state.downcount -= m_system.GetInterpreter().RunBlock();
+  return true;
+}
+
+bool JitBase::IsHotBranchTarget(u32 address)
+{
+  const CPUEmuFeatureFlags feature_flags = m_ppc_state.feature_flags;
+  if (const JitBlock* block = GetBlockCache()->GetBlockFromStartAddress(address, feature_flags))
+  {
+    // Without profiling data, the best we know is that the target has been executed before.
+    const JitBlock::ProfileData* profile_data = block->profile_data.get();
+    return !profile_data ||
+           profile_data->run_count + profile_data->interpreted_run_count >= TRACE_HOT_RUN_COUNT;
+  }
+
+  const auto it = m_cold_block_run_counts.find((u64{feature_flags} << 32) | address);
+  return it != m_cold_block_run_counts.end() && it->second >= TRACE_HOT_RUN_COUNT;
+}
+
+u32 JitBase::TakeColdBlockRunCount(u32 em_address, CPUEmuFeatureFlags feature_flags)
+{
+  if (m_cold_block_run_counts.empty())
+    return 0;
+
+  const auto it = m_cold_block_run_counts.find((u64{feature_flags} << 32) | em_address);
+  if (it == m_cold_block_run_counts.end())
+    return 0;
+
+  const u32 run_count = it->second;
+  m_cold_block_run_counts.erase(it);
+  return run_count;
 }
 
 JitBase::JitBase(Core::System& system)
@@ -101,6 +156,8 @@ JitBase::JitBase(Core::System& system)
   m_registered_config_callback_id = CPUThreadConfigCallback::AddConfigChangedCallback([this] {
     if (DoesConfigNeedRefresh())
       ClearCache();
+    // Changing the running title also changes the config.
+    GetBlockCache()->RefreshPersistentCache();
   });
   // The JIT is responsible for calling RefreshConfig on Init and ClearCache
 }
@@ -133,6 +190,15 @@ void JitBase::RefreshConfig()
   analyzer.SetBranchFollowingEnabled(m_enable_branch_following);
   analyzer.SetFloatExceptionsEnabled(m_enable_float_exceptions);
   analyzer.SetDivByZeroExceptionsEnabled(m_enable_div_by_zero_exceptions);
+  if (m_enable_trace_compilation && !m_enable_debugging)
+  {
+    analyzer.SetHotBranchTargetPredicate(
+        [this](u32 address) { return IsHotBranchTarget(address); });
+  }
+  else
+  {
+    analyzer.SetHotBranchTargetPredicate(nullptr);
+  }
 
   bool any_watchpoints = m_system.GetPowerPC().GetMemChecks().HasAny();
   jo.fastmem = m_fastmem_enabled && jo.fastmem_arena && (m_ppc_state.msr.DR || !any_watchpoints) &&
@@ -8,6 +8,7 @@
 #include <iosfwd>
 #include <map>
 #include <string_view>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -105,7 +106,6 @@ protected:
     bool fixupExceptionHandler;
     Gen::FixupBranch exceptionHandler;
 
-    bool assumeNoPairedQuantize;
     BitSet8 constantGqrValid;
     std::array<u32, 8> constantGqr;
     bool firstFPInstructionFound;
@@ -160,12 +160,30 @@ protected:
   bool m_accurate_nans = false;
   bool m_fastmem_enabled = false;
   bool m_accurate_cpu_cache_enabled = false;
+  bool m_enable_tiered_compilation = false;
+  bool m_enable_trace_compilation = false;
+  bool m_enable_preloaded_entry_points = false;
 
   bool m_enable_blr_optimization = false;
   bool m_cleanup_after_stackfault = false;
   u8* m_stack_guard = nullptr;
 
-  static const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 23> JIT_SETTINGS;
+  static const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 26> JIT_SETTINGS;
+
+  // Number of executions after which a branch target is considered hot by trace compilation.
+  static constexpr u32 TRACE_HOT_RUN_COUNT = 8;
+
+  // Number of times a block gets executed in the interpreter before it is compiled when tiered
+  // compilation is enabled.
+  static constexpr u32 TIER_UP_THRESHOLD = 16;
+
+  // Maximum number of entries in m_cold_block_run_counts. Blocks that run a few times and are never
+  // compiled would otherwise accumulate until the next cache clear.
+  static constexpr size_t MAX_COLD_BLOCKS = 0x10000;
+
+  // Interpreter executions of blocks which haven't been compiled yet,
+  // indexed by (feature_flags << 32) | effective_address.
+  std::unordered_map<u64, u32> m_cold_block_run_counts;
 
   bool DoesConfigNeedRefresh() const;
   void RefreshConfig();
@@ -189,6 +207,12 @@ protected:
 
   bool ShouldHandleFPExceptionForInstruction(const PPCAnalyst::CodeOp* op) const;
 
+  bool IsHotBranchTarget(u32 address);
+
+  // Whether the dispatcher checks downcount after JitTrampoline returns, which is required for
+  // running cold blocks in the interpreter.
+  virtual bool CanInterpretColdBlocks() const { return false; }
+
 public:
   explicit JitBase(Core::System& system);
   JitBase(const JitBase&) = delete;
@@ -205,6 +229,11 @@ public:
 
   virtual void Jit(u32 em_address) = 0;
 
+  // Tiered compilation: runs the block at em_address in the interpreter instead of compiling it if
+  // it hasn't been executed often enough yet. Returns false if the block should be compiled.
+  bool InterpretColdBlock(u32 em_address);
+  u32 TakeColdBlockRunCount(u32 em_address, CPUEmuFeatureFlags feature_flags);
+
   virtual void EraseSingleBlock(const JitBlock& block) = 0;
 
   // Memory region name, free size, and fragmentation ratio
@@ -13,15 +13,23 @@
 #include <span>
 #include <utility>
 
+#include <fmt/format.h>
+
 #include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/Hash.h"
 #include "Common/JitRegister.h"
+#include "Common/Logging/Log.h"
 #include "Core/Config/MainSettings.h"
+#include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/Host.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
+#include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PPCSymbolDB.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
 
 #ifdef _WIN32
 #include <windows.h>
@@ -64,12 +72,15 @@ void JitBaseBlockCache::Init()
 #endif
 
   Clear();
+  RefreshPersistentCache();
 }
 
 void JitBaseBlockCache::Shutdown()
 {
   Common::JitRegister::Shutdown();
 
+  ClosePersistentCache();
+
   m_entry_points_arena.Release();
 }
 
@@ -90,6 +101,7 @@ void JitBaseBlockCache::Clear()
   block_map.clear();
   links_to.clear();
   block_range_map.clear();
+  m_persistent_warm_up_queue.clear();
 
   valid_block.ClearAll();
 
@@ -160,6 +172,11 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
 
   block.physical_addresses = code_block.m_physical_addresses;
 
+  const u32 interpreted_run_count =
+      m_jit.TakeColdBlockRunCount(block.effectiveAddress, block.feature_flags);
+  if (block.profile_data)
+    block.profile_data->interpreted_run_count = interpreted_run_count;
+
   block.originalSize = code_block.m_num_instructions;
   if (m_jit.IsDebuggingEnabled())
   {
@@ -187,6 +204,17 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
     LinkBlock(block);
   }
 
+  if (m_persistent_cache_enabled)
+  {
+    if (m_persistent_warm_up_active)
+      ++m_persistent_blocks_warmed_up;
+    else
+      ++m_persistent_blocks_compiled_on_demand;
+    PublishPersistentCacheStats();
+
+    AppendPersistentBlock(block, code_buffer);
+  }
+
   const Common::Symbol* symbol = nullptr;
   if (Common::JitRegister::IsEnabled() &&
       (symbol = m_jit.m_ppc_symbol_db.GetSymbolFromAddr(block.effectiveAddress)) != nullptr)
@@ -420,6 +448,170 @@ void JitBaseBlockCache::WriteDestroyBlock(const JitBlock& block)
 {
 }
 
+void JitBaseBlockCache::WarmUpPersistentBlocks(u32 physical_address)
+{
+  if (m_persistent_blocks.empty())
+    return;
+
+  const auto page = m_persistent_blocks.find(physical_address >> PERSISTENT_PAGE_SHIFT);
+  if (page == m_persistent_blocks.end())
+    return;
+
+  // Blocks compiled with other feature flags stay in the page until the CPU runs in that mode.
+  const CPUEmuFeatureFlags feature_flags = m_jit.m_ppc_state.feature_flags;
+  std::erase_if(page->second, [&](const PersistentBlock& persistent_block) {
+    const PersistentBlockKey& key = persistent_block.key;
+    if (key.feature_flags != feature_flags)
+      return false;
+
+    // Validate lazily against guest memory: the block must still translate to the same physical
+    // address and contain the same instructions as when it was recorded.
+    const auto translated = m_jit.m_mmu.JitCache_TranslateAddress(key.effective_address);
+    if (translated.valid && translated.address == key.physical_address &&
+        HashGuestCode(persistent_block.instruction_addresses) == key.code_hash)
+    {
+      m_persistent_warm_up_queue.emplace_back(key.effective_address, feature_flags);
+    }
+    return true;
+  });
+  if (page->second.empty())
+    m_persistent_blocks.erase(page);
+}
+
+void JitBaseBlockCache::CompileQueuedPersistentBlocks()
+{
+  // Compiling a block can queue the blocks of another page, which get compiled by this loop too.
+  // Compiling can also clear the cache, which empties the queue.
+  m_persistent_warm_up_active = true;
+  while (!m_persistent_warm_up_queue.empty())
+  {
+    const auto [address, feature_flags] = m_persistent_warm_up_queue.back();
+    m_persistent_warm_up_queue.pop_back();
+    if (feature_flags == m_jit.m_ppc_state.feature_flags &&
+        !GetBlockFromStartAddress(address, feature_flags))
+    {
+      m_jit.Jit(address);
+    }
+  }
+  m_persistent_warm_up_active = false;
+}
+
+void JitBaseBlockCache::RefreshPersistentCache()
+{
+  const std::string game_id = SConfig::GetInstance().GetGameID();
+  const bool enabled = Config::Get(Config::MAIN_JIT_PERSISTENT_BLOCK_CACHE) && !game_id.empty() &&
+                       !m_jit.IsDebuggingEnabled();
+  if (game_id != m_persistent_game_id || enabled != m_persistent_cache_enabled)
+    OpenPersistentCache();
+}
+
+void JitBaseBlockCache::OpenPersistentCache()
+{
+  ClosePersistentCache();
+
+  m_persistent_game_id = SConfig::GetInstance().GetGameID();
+  m_persistent_cache_enabled = Config::Get(Config::MAIN_JIT_PERSISTENT_BLOCK_CACHE) &&
+                               !m_persistent_game_id.empty() && !m_jit.IsDebuggingEnabled();
+  if (!m_persistent_cache_enabled)
+    return;
+
+  class BlockReader : public Common::LinearDiskCacheReader<PersistentBlockKey, u32>
+  {
+  public:
+    explicit BlockReader(JitBaseBlockCache& cache) : m_cache(cache) {}
+    void Read(const PersistentBlockKey& key, const u32* value, u32 value_size) override
+    {
+      if (value_size != key.num_instructions || value_size == 0)
+        return;
+
+      m_cache.m_persistent_known_blocks.emplace(key.effective_address, key.feature_flags,
+                                                key.code_hash);
+      m_cache.m_persistent_blocks[key.physical_address >> PERSISTENT_PAGE_SHIFT].push_back(
+          {key, std::vector<u32>(value, value + value_size)});
+    }
+
+  private:
+    JitBaseBlockCache& m_cache;
+  };
+
+  const std::string cache_dir = File::GetUserPath(D_CACHE_IDX);
+  if (!File::Exists(cache_dir))
+    File::CreateDir(cache_dir);
+
+  const std::string filename = fmt::format("{}JitBlocks-{}.cache", cache_dir, m_persistent_game_id);
+  BlockReader reader(*this);
+  const u32 count = m_persistent_disk_cache.OpenAndRead(filename, reader);
+  INFO_LOG_FMT(DYNA_REC, "Loaded {} persistent JIT blocks from {}", count, filename);
+}
+
+void JitBaseBlockCache::ClosePersistentCache()
+{
+  if (m_persistent_cache_enabled)
+  {
+    INFO_LOG_FMT(DYNA_REC,
+                 "Persistent JIT block cache: {} blocks warmed up, {} blocks compiled on demand",
+                 m_persistent_blocks_warmed_up, m_persistent_blocks_compiled_on_demand);
+    m_persistent_disk_cache.Sync();
+    m_persistent_disk_cache.Close();
+  }
+
+  m_persistent_blocks.clear();
+  m_persistent_warm_up_queue.clear();
+  m_persistent_known_blocks.clear();
+  m_persistent_game_id.clear();
+  m_persistent_cache_enabled = false;
+  m_persistent_blocks_warmed_up = 0;
+  m_persistent_blocks_compiled_on_demand = 0;
+  PublishPersistentCacheStats();
+}
+
+void JitBaseBlockCache::PublishPersistentCacheStats()
+{
+  m_jit.m_system.GetJitInterface().SetPersistentBlockCacheStats(
+      m_persistent_blocks_warmed_up, m_persistent_blocks_compiled_on_demand);
+}
+
+void JitBaseBlockCache::AppendPersistentBlock(const JitBlock& block,
+                                              const PPCAnalyst::CodeBuffer& code_buffer)
+{
+  std::vector<u32> instruction_addresses(block.originalSize);
+  for (u32 i = 0; i < block.originalSize; ++i)
+    instruction_addresses[i] = code_buffer[i].address;
+
+  const u64 code_hash = HashGuestCode(instruction_addresses);
+  if (!m_persistent_known_blocks.emplace(block.effectiveAddress, block.feature_flags, code_hash)
+           .second)
+  {
+    return;
+  }
+
+  const PersistentBlockKey key{
+      .code_hash = code_hash,
+      .effective_address = block.effectiveAddress,
+      .physical_address = block.physicalAddress,
+      .feature_flags = block.feature_flags,
+      .num_instructions = block.originalSize,
+  };
+  m_persistent_disk_cache.Append(key, instruction_addresses.data(),
+                                 static_cast<u32>(instruction_addresses.size()));
+}
+
+u64 JitBaseBlockCache::HashGuestCode(std::span<const u32> instruction_addresses) const
+{
+  std::vector<u32> instructions;
+  instructions.reserve(instruction_addresses.size());
+  for (const u32 address : instruction_addresses)
+  {
+    const auto result = m_jit.m_mmu.TryReadInstruction(address);
+    if (!result.valid)
+      return 0;
+    instructions.push_back(result.hex);
+  }
+
+  return Common::GetHash64(reinterpret_cast<const u8*>(instructions.data()),
+                           static_cast<u32>(instructions.size() * sizeof(u32)), 0);
+}
+
 // Block linker
 // Make sure to have as many blocks as possible compiled before calling this
 // It's O(N), so it's fast :)
@@ -11,12 +11,17 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <span>
+#include <string>
+#include <tuple>
 #include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#include "Common/BitSet.h"
 #include "Common/CommonTypes.h"
+#include "Common/LinearDiskCache.h"
 #include "Core/HW/Memmap.h"
 #include "Core/PowerPC/Gekko.h"
 #include "Core/PowerPC/PPCAnalyst.h"
@@ -72,6 +77,8 @@ struct JitBlock : public JitBlockData
     static void EndProfiling(ProfileData* data, u32 downcount_amount);
 
     std::size_t run_count = 0;
+    // Executions in the interpreter before the block was compiled (tiered compilation).
+    std::size_t interpreted_run_count = 0;
     u64 cycles_spent = 0;
     Clock::duration time_spent = {};
 
@@ -97,9 +104,16 @@ struct JitBlock : public JitBlockData
     u32 exitAddress;
     bool linkStatus;  // is it already linked?
     bool call;
+    // Registers the exit leaves in host registers for the destination's preloaded entry point.
+    BitSet32 preloaded_gprs;
   };
   std::vector<LinkData> linkData;
 
+  // Alternative entry point which skips loading preloaded_gprs, for linked exits which already
+  // have them in the expected host registers. nullptr if the block doesn't have one.
+  u8* preloadedEntry = nullptr;
+  BitSet32 preloaded_gprs;
+
   // This set stores all physical addresses of all occupied instructions.
   std::set<u32> physical_addresses;
 
@@ -188,6 +202,17 @@ public:
 
   u32* GetBlockBitSet() const;
 
+  // Persistent block cache. Blocks compiled in previous sessions of the same title are recorded on
+  // disk by guest address, feature flags and a hash of their guest code. When a block in a physical
+  // page gets compiled, all recorded blocks of that page whose guest code is unchanged are queued
+  // and compiled right after it, so that the code of a hot page is translated in one go instead of
+  // one block at a time as execution reaches it.
+  void WarmUpPersistentBlocks(u32 physical_address);
+  // Compiles the blocks queued by WarmUpPersistentBlocks. Must not be called from within Jit.
+  void CompileQueuedPersistentBlocks();
+  // Reopens the persistent block cache if the running title or the setting has changed.
+  void RefreshPersistentCache();
+
 protected:
   virtual void DestroyBlock(JitBlock& block);
 
@@ -204,6 +229,30 @@ private:
 
   JitBlock* MoveBlockIntoFastCache(u32 em_address, CPUEmuFeatureFlags feature_flags);
 
+  // On-disk key of a persistent block. The value is the list of instruction addresses.
+  struct PersistentBlockKey
+  {
+    u64 code_hash;
+    u32 effective_address;
+    u32 physical_address;
+    CPUEmuFeatureFlags feature_flags;
+    u32 num_instructions;
+  };
+  static_assert(sizeof(PersistentBlockKey) == 24, "PersistentBlockKey must not contain padding");
+  struct PersistentBlock
+  {
+    PersistentBlockKey key;
+    // Effective addresses of all instructions in the block, in analyzer order.
+    std::vector<u32> instruction_addresses;
+  };
+  static constexpr u32 PERSISTENT_PAGE_SHIFT = 12;
+
+  void OpenPersistentCache();
+  void ClosePersistentCache();
+  void PublishPersistentCacheStats();
+  void AppendPersistentBlock(const JitBlock& block, const PPCAnalyst::CodeBuffer& code_buffer);
+  u64 HashGuestCode(std::span<const u32> instruction_addresses) const;
+
   // Fast but risky block lookup based on fast_block_map.
   size_t FastLookupIndexForAddress(u32 address, u32 msr);
 
@@ -235,4 +284,18 @@ private:
   // in case the shm memory region couldn't be allocated.
   std::array<JitBlock*, FAST_BLOCK_MAP_FALLBACK_ELEMENTS>
       m_fast_block_map_fallback{};  // start_addr & mask -> number
+
+  // Blocks recorded in previous sessions which haven't been warmed up yet, by physical page.
+  std::unordered_map<u32, std::vector<PersistentBlock>> m_persistent_blocks;
+  // Validated blocks waiting to be compiled by CompileQueuedPersistentBlocks.
+  std::vector<std::pair<u32, CPUEmuFeatureFlags>> m_persistent_warm_up_queue;
+  // Blocks which are already stored on disk, to avoid appending duplicates.
+  std::set<std::tuple<u32, u32, u64>> m_persistent_known_blocks;
+  Common::LinearDiskCache<PersistentBlockKey, u32> m_persistent_disk_cache;
+  std::string m_persistent_game_id;
+  bool m_persistent_cache_enabled = false;
+  bool m_persistent_warm_up_active = false;
+  // Blocks compiled ahead of execution from the persistent cache vs. compiled when reached.
+  std::size_t m_persistent_blocks_warmed_up = 0;
+  std::size_t m_persistent_blocks_compiled_on_demand = 0;
 };
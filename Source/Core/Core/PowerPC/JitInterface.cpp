@@ -15,6 +15,7 @@
 #include "Common/MsgHandler.h"
 
 #include "Core/Core.h"
+#include "Core/HW/Memmap.h"
 #include "Core/PowerPC/CPUCoreBase.h"
 #include "Core/PowerPC/CachedInterpreter/CachedInterpreter.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
@@ -118,7 +119,8 @@ static std::string_view GetDescription(const CPUEmuFeatureFlags flags)
 void JitInterface::JitBlockLogDump(const Core::CPUThreadGuard& guard, std::FILE* file) const
 {
   std::fputs(
-      "ppcFeatureFlags\tppcAddress\tppcSize\thostNearSize\thostFarSize\trunCount\tcyclesSpent"
+      "ppcFeatureFlags\tppcAddress\tppcSize\thostNearSize\thostFarSize\trunCount"
+      "\tinterpretedRunCount\tcyclesSpent"
       "\tcyclesAverage\tcyclesPercent\ttimeSpent(ns)\ttimeAverage(ns)\ttimePercent\tsymbol\n",
       file);
 
@@ -157,10 +159,11 @@ void JitInterface::JitBlockLogDump(const Core::CPUThreadGuard& guard, std::FILE*
       const std::size_t host_far_code_size = block.far_end - block.far_begin;
 
       fmt::println(
-          file, "{}\t{:08x}\t{}\t{}\t{}\t{}\t{}\t{:.6f}\t{:.6f}\t{}\t{:.6f}\t{:.6f}\t\"{}\"",
+          file, "{}\t{:08x}\t{}\t{}\t{}\t{}\t{}\t{}\t{:.6f}\t{:.6f}\t{}\t{:.6f}\t{:.6f}\t\"{}\"",
           GetDescription(block.feature_flags), block.effectiveAddress,
           block.originalSize * sizeof(UGeckoInstruction), host_near_code_size, host_far_code_size,
-          data->run_count, data->cycles_spent, cycles_average, cycles_percent,
+          data->run_count, data->interpreted_run_count, data->cycles_spent, cycles_average,
+          cycles_percent,
           std::chrono::duration_cast<std::chrono::nanoseconds>(data->time_spent).count(),
           time_average, time_percent, symbol ? std::string_view{symbol->name} : "");
     });
@@ -174,7 +177,7 @@ void JitInterface::JitBlockLogDump(const Core::CPUThreadGuard& guard, std::FILE*
       const std::size_t host_near_code_size = block.near_end - block.near_begin;
       const std::size_t host_far_code_size = block.far_end - block.far_begin;
 
-      fmt::println(file, "{}\t{:08x}\t{}\t{}\t{}\t-\t-\t-\t-\t-\t-\t-\t\"{}\"",
+      fmt::println(file, "{}\t{:08x}\t{}\t{}\t{}\t-\t-\t-\t-\t-\t-\t-\t-\t\"{}\"",
                    GetDescription(block.feature_flags), block.effectiveAddress,
                    block.originalSize * sizeof(UGeckoInstruction), host_near_code_size,
                    host_far_code_size, symbol ? std::string_view{symbol->name} : "");
@@ -202,6 +205,19 @@ std::size_t JitInterface::GetBlockCount() const
   return 0;
 }
 
+std::pair<std::size_t, std::size_t> JitInterface::GetPersistentBlockCacheStats() const
+{
+  return {m_persistent_blocks_warmed_up.load(std::memory_order_relaxed),
+          m_persistent_blocks_compiled_on_demand.load(std::memory_order_relaxed)};
+}
+
+void JitInterface::SetPersistentBlockCacheStats(std::size_t warmed_up,
+                                                std::size_t compiled_on_demand)
+{
+  m_persistent_blocks_warmed_up.store(warmed_up, std::memory_order_relaxed);
+  m_persistent_blocks_compiled_on_demand.store(compiled_on_demand, std::memory_order_relaxed);
+}
+
 bool JitInterface::HandleFault(uintptr_t access_address, SContext* ctx)
 {
   // Prevent nullptr dereference on a crash with no JIT present
@@ -210,6 +226,11 @@ bool JitInterface::HandleFault(uintptr_t access_address, SContext* ctx)
     return false;
   }
 
+  // Stores to RAM that is watched for writes fault without needing to be backpatched, and can be
+  // retried once the write has been recorded.
+  if (m_system.GetMemory().HandleWriteFault(reinterpret_cast<u8*>(access_address)))
+    return true;
+
   return m_jit->HandleFault(access_address, ctx);
 }
 
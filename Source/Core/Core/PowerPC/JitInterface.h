@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdio>
 #include <functional>
@@ -51,6 +52,11 @@ public:
   void RunOnBlocks(const Core::CPUThreadGuard& guard, std::function<void(const JitBlock&)> f) const;
   std::size_t GetBlockCount() const;
 
+  // Blocks warmed up from the persistent block cache vs. blocks compiled on demand. Can be called
+  // from any thread. The block cache publishes new values from the CPU thread.
+  std::pair<std::size_t, std::size_t> GetPersistentBlockCacheStats() const;
+  void SetPersistentBlockCacheStats(std::size_t warmed_up, std::size_t compiled_on_demand);
+
   // Memory Utilities
   bool HandleFault(uintptr_t access_address, SContext* ctx);
   bool HandleStackFault();
@@ -100,4 +106,7 @@ public:
 private:
   std::unique_ptr<JitBase> m_jit;
   Core::System& m_system;
+
+  std::atomic<std::size_t> m_persistent_blocks_warmed_up = 0;
+  std::atomic<std::size_t> m_persistent_blocks_compiled_on_demand = 0;
 };
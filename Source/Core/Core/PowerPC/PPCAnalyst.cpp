@@ -43,6 +43,8 @@ namespace PPCAnalyst
 {
 // 0 does not perform block merging
 constexpr u32 BRANCH_FOLLOWING_THRESHOLD = 2;
+// Maximum number of followed branches when the branch targets are hot (trace compilation)
+constexpr u32 TRACE_FOLLOWING_THRESHOLD = 8;
 
 constexpr u32 INVALID_BRANCH_TARGET = 0xFFFFFFFF;
 
@@ -829,6 +831,12 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
   u32 num_inst = 0;
 
   const bool enable_follow = m_enable_branch_following;
+  const auto can_follow = [&](u32 target) {
+    if (numFollows < BRANCH_FOLLOWING_THRESHOLD)
+      return true;
+    return numFollows < TRACE_FOLLOWING_THRESHOLD && m_is_hot_branch_target &&
+           m_is_hot_branch_target(target);
+  };
 
   auto& system = Core::System::GetInstance();
   auto& mmu = system.GetMMU();
@@ -891,7 +899,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
       {
         code[i].branchTo = code[caller].address + 4;
         if ((inst.BO & BO_DONT_DECREMENT_FLAG) && (inst.BO & BO_DONT_CHECK_CONDITION) &&
-            numFollows < BRANCH_FOLLOWING_THRESHOLD)
+            can_follow(code[i].branchTo))
         {
           // bclrx with unconditional branch = return
           // Follow it if we can propagate the LR value of the last CALL instruction.
@@ -945,7 +953,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
     code[i].branchIsIdleLoop =
         code[i].branchTo == block->m_address && IsBusyWaitLoop(block, code, i);
 
-    if (follow && numFollows < BRANCH_FOLLOWING_THRESHOLD)
+    if (follow && can_follow(code[i].branchTo))
     {
       // Follow the unconditional branch.
       numFollows++;
@@ -5,7 +5,9 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <functional>
 #include <set>
+#include <utility>
 #include <vector>
 
 #include "Common/BitSet.h"
@@ -181,6 +183,12 @@ public:
   void SetBranchFollowingEnabled(bool enabled) { m_enable_branch_following = enabled; }
   void SetFloatExceptionsEnabled(bool enabled) { m_enable_float_exceptions = enabled; }
   void SetDivByZeroExceptionsEnabled(bool enabled) { m_enable_div_by_zero_exceptions = enabled; }
+  // Trace compilation: unconditional branches to targets for which this returns true are followed
+  // beyond BRANCH_FOLLOWING_THRESHOLD, stitching hot successor blocks into one block.
+  void SetHotBranchTargetPredicate(std::function<bool(u32)> predicate)
+  {
+    m_is_hot_branch_target = std::move(predicate);
+  }
   u32 Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, std::size_t block_size) const;
 
 private:
@@ -205,6 +213,7 @@ private:
   bool m_enable_branch_following = false;
   bool m_enable_float_exceptions = false;
   bool m_enable_div_by_zero_exceptions = false;
+  std::function<bool(u32)> m_is_hot_branch_target;
 };
 
 void FindFunctions(const Core::CPUThreadGuard& guard, u32 startAddr, u32 endAddr,
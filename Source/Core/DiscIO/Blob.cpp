@@ -211,7 +211,7 @@ u32 SectorReader::ReadChunk(u8* buffer, u64 chunk_num)
   return 0;
 }
 
-std::unique_ptr<BlobReader> CreateBlobReader(const std::string& filename)
+std::unique_ptr<BlobReader> CreateBlobReader(const std::string& filename, bool map_plain_files)
 {
   File::IOFile file(filename, "rb");
   u32 magic;
@@ -248,7 +248,7 @@ std::unique_ptr<BlobReader> CreateBlobReader(const std::string& filename)
     if (auto split_blob = SplitPlainFileReader::Create(filename))
       return std::move(split_blob);
 
-    return PlainFileReader::Create(std::move(file));
+    return PlainFileReader::Create(std::move(file), map_plain_files);
   }
 }
 
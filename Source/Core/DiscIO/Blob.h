@@ -17,6 +17,7 @@
 #include <functional>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -78,6 +79,10 @@ public:
 
   // NOT thread-safe - can't call this from multiple threads.
   virtual bool Read(u64 offset, u64 size, u8* out_ptr) = 0;
+  // Returns the data without copying it if the reader has all of it in memory, or an empty span
+  // if Read has to be used instead. The data stays valid for as long as the reader exists.
+  // Thread-safe, unlike Read.
+  virtual std::span<const u8> ReadInPlace(u64 offset, u64 size) const { return {}; }
   template <typename T>
   std::optional<T> ReadSwapped(u64 offset)
   {
@@ -190,7 +195,9 @@ private:
 };
 
 // Factory function - examines the path to choose the right type of BlobReader, and returns one.
-std::unique_ptr<BlobReader> CreateBlobReader(const std::string& filename);
+// If map_plain_files is set, uncompressed disc images are mapped into memory (see PlainFileReader).
+std::unique_ptr<BlobReader> CreateBlobReader(const std::string& filename,
+                                             bool map_plain_files = false);
 
 using CompressCB = std::function<bool(const std::string& text, float percent)>;
 
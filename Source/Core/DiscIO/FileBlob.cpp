@@ -4,37 +4,63 @@
 #include "DiscIO/FileBlob.h"
 
 #include <algorithm>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#ifdef _WIN32
+#include <io.h>
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
 #include "Common/Assert.h"
+#include "Common/CommonFuncs.h"
 #include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 
 namespace DiscIO
 {
-PlainFileReader::PlainFileReader(File::IOFile file) : m_file(std::move(file))
+PlainFileReader::PlainFileReader(File::IOFile file, bool map) : m_file(std::move(file))
 {
   m_size = m_file.GetSize();
+  if (map)
+    MapFile();
+}
+
+PlainFileReader::~PlainFileReader()
+{
+  UnmapFile();
 }
 
-std::unique_ptr<PlainFileReader> PlainFileReader::Create(File::IOFile file)
+std::unique_ptr<PlainFileReader> PlainFileReader::Create(File::IOFile file, bool map)
 {
   if (file)
-    return std::unique_ptr<PlainFileReader>(new PlainFileReader(std::move(file)));
+    return std::unique_ptr<PlainFileReader>(new PlainFileReader(std::move(file), map));
 
   return nullptr;
 }
 
 std::unique_ptr<BlobReader> PlainFileReader::CopyReader() const
 {
-  return Create(m_file.Duplicate("rb"));
+  return Create(m_file.Duplicate("rb"), m_mapping != nullptr);
 }
 
 bool PlainFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
 {
+  if (m_mapping)
+  {
+    const std::span<const u8> data = ReadInPlace(offset, nbytes);
+    if (data.size() != nbytes)
+      return false;
+    std::memcpy(out_ptr, data.data(), data.size());
+    return true;
+  }
+
   if (m_file.Seek(offset, File::SeekOrigin::Begin) && m_file.ReadBytes(out_ptr, nbytes))
   {
     return true;
@@ -46,6 +72,62 @@ bool PlainFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
   }
 }
 
+std::span<const u8> PlainFileReader::ReadInPlace(u64 offset, u64 size) const
+{
+  if (!m_mapping || offset > m_size || size > m_size - offset)
+    return {};
+
+  return {m_mapping + offset, static_cast<size_t>(size)};
+}
+
+void PlainFileReader::MapFile()
+{
+  if (m_size == 0)
+    return;
+
+#ifdef _WIN32
+  const HANDLE file = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(m_file.GetHandle())));
+  const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (!mapping)
+  {
+    WARN_LOG_FMT(DISCIO, "Failed to map disc image into memory: {}", Common::GetLastErrorString());
+    return;
+  }
+
+  // The view keeps the mapping alive.
+  const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  CloseHandle(mapping);
+  if (!view)
+  {
+    WARN_LOG_FMT(DISCIO, "Failed to map disc image into memory: {}", Common::GetLastErrorString());
+    return;
+  }
+#else
+  const void* view = mmap(nullptr, static_cast<size_t>(m_size), PROT_READ, MAP_SHARED,
+                          fileno(m_file.GetHandle()), 0);
+  if (view == MAP_FAILED)
+  {
+    WARN_LOG_FMT(DISCIO, "Failed to map disc image into memory: {}", Common::LastStrerrorString());
+    return;
+  }
+#endif
+
+  m_mapping = static_cast<const u8*>(view);
+}
+
+void PlainFileReader::UnmapFile()
+{
+  if (!m_mapping)
+    return;
+
+#ifdef _WIN32
+  UnmapViewOfFile(m_mapping);
+#else
+  munmap(const_cast<u8*>(m_mapping), static_cast<size_t>(m_size));
+#endif
+  m_mapping = nullptr;
+}
+
 bool ConvertToPlain(BlobReader* infile, const std::string& infile_path,
                     const std::string& outfile_path, const CompressCB& callback)
 {
@@ -5,6 +5,7 @@
 
 #include <cstdio>
 #include <memory>
+#include <span>
 #include <string>
 
 #include "Common/CommonTypes.h"
@@ -13,10 +14,16 @@
 
 namespace DiscIO
 {
+// Reads uncompressed disc images. If map is set, the whole file is mapped into memory when
+// possible, so that reads don't need any system calls and can be done in place. Mapping is off by
+// default: if the file can't be read (an I/O error, or a file on a network share or removable
+// media that goes away), accessing the mapping crashes the process instead of failing the read.
 class PlainFileReader final : public BlobReader
 {
 public:
-  static std::unique_ptr<PlainFileReader> Create(File::IOFile file);
+  ~PlainFileReader() override;
+
+  static std::unique_ptr<PlainFileReader> Create(File::IOFile file, bool map = false);
 
   BlobType GetBlobType() const override { return BlobType::PLAIN; }
   std::unique_ptr<BlobReader> CopyReader() const override;
@@ -31,12 +38,18 @@ public:
   std::optional<int> GetCompressionLevel() const override { return std::nullopt; }
 
   bool Read(u64 offset, u64 nbytes, u8* out_ptr) override;
+  std::span<const u8> ReadInPlace(u64 offset, u64 size) const override;
 
 private:
-  PlainFileReader(File::IOFile file);
+  PlainFileReader(File::IOFile file, bool map);
+
+  void MapFile();
+  void UnmapFile();
 
   File::IOFile m_file;
   u64 m_size;
+  // nullptr if the file couldn't be mapped, in which case it's read through m_file
+  const u8* m_mapping = nullptr;
 };
 
 }  // namespace DiscIO
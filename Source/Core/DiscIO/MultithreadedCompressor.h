@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <functional>
 #include <memory>
@@ -14,6 +15,7 @@
 #include "Common/Assert.h"
 #include "Common/Event.h"
 #include "Common/Result.h"
+#include "Common/Semaphore.h"
 
 namespace DiscIO
 {
@@ -29,6 +31,16 @@ enum class ConversionResultCode
 template <typename T>
 using ConversionResult = Common::Result<ConversionResultCode, T>;
 
+// The compression threads of all compressors in the process take turns with one slot per CPU core,
+// so that converting several files at the same time doesn't compress more blocks at once than
+// there are cores to compress them on.
+inline Common::Semaphore& GetCompressionSlots()
+{
+  static const int slot_count = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+  static Common::Semaphore slots(slot_count, slot_count);
+  return slots;
+}
+
 // This class starts a number of compression threads and one output thread.
 // The set_up_compress_thread_state function is called at the start of each compression thread.
 // When CompressAndWrite is called, the compress function will be called on one of the
@@ -156,8 +168,10 @@ private:
       state->compress_done_event.Reset();
       state->compress_ready_event.Set();
 
+      GetCompressionSlots().Wait();
       ConversionResult<OutputParameters> result =
           m_compress(&compress_thread_state, std::move(parameters));
+      GetCompressionSlots().Post();
 
       if (result)
       {
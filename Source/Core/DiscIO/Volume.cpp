@@ -104,9 +104,9 @@ std::unique_ptr<VolumeDisc> CreateDisc(std::unique_ptr<BlobReader> reader)
   return TryCreateDisc(reader);
 }
 
-std::unique_ptr<VolumeDisc> CreateDisc(const std::string& path)
+std::unique_ptr<VolumeDisc> CreateDisc(const std::string& path, bool map_plain_files)
 {
-  return CreateDisc(CreateBlobReader(path));
+  return CreateDisc(CreateBlobReader(path, map_plain_files));
 }
 
 static std::unique_ptr<VolumeWAD> TryCreateWAD(std::unique_ptr<BlobReader>& reader)
@@ -147,8 +147,8 @@ std::unique_ptr<Volume> CreateVolume(std::unique_ptr<BlobReader> reader)
   return nullptr;
 }
 
-std::unique_ptr<Volume> CreateVolume(const std::string& path)
+std::unique_ptr<Volume> CreateVolume(const std::string& path, bool map_plain_files)
 {
-  return CreateVolume(CreateBlobReader(path));
+  return CreateVolume(CreateBlobReader(path, map_plain_files));
 }
 }  // namespace DiscIO
@@ -8,6 +8,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -82,7 +83,7 @@ public:
   virtual std::vector<u8> GetContent(u16 index) const { return {}; }
   virtual std::vector<u64> GetContentOffsets() const { return {}; }
   virtual bool CheckContentIntegrity(const IOS::ES::Content& content,
-                                     const std::vector<u8>& encrypted_data,
+                                     std::span<const u8> encrypted_data,
                                      const IOS::ES::TicketReader& ticket) const
   {
     return false;
@@ -175,10 +176,10 @@ protected:
 };
 
 std::unique_ptr<VolumeDisc> CreateDisc(std::unique_ptr<BlobReader> reader);
-std::unique_ptr<VolumeDisc> CreateDisc(const std::string& path);
+std::unique_ptr<VolumeDisc> CreateDisc(const std::string& path, bool map_plain_files = false);
 std::unique_ptr<VolumeWAD> CreateWAD(std::unique_ptr<BlobReader> reader);
 std::unique_ptr<VolumeWAD> CreateWAD(const std::string& path);
 std::unique_ptr<Volume> CreateVolume(std::unique_ptr<BlobReader> reader);
-std::unique_ptr<Volume> CreateVolume(const std::string& path);
+std::unique_ptr<Volume> CreateVolume(const std::string& path, bool map_plain_files = false);
 
 }  // namespace DiscIO
@@ -4,6 +4,7 @@
 #include "DiscIO/VolumeVerifier.h"
 
 #include <algorithm>
+#include <cstring>
 #include <future>
 #include <limits>
 #include <memory>
@@ -12,6 +13,7 @@
 #include <string_view>
 #include <unordered_set>
 
+#include <fmt/format.h>
 #include <mbedtls/md5.h>
 #include <mz.h>
 #include <mz_strm.h>
@@ -31,11 +33,13 @@
 #include "Common/HttpRequest.h"
 #include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
+#include "Common/MemoryUtil.h"
 #include "Common/MinizipUtil.h"
 #include "Common/MsgHandler.h"
 #include "Common/ScopeGuard.h"
 #include "Common/StringUtil.h"
 #include "Common/Swap.h"
+#include "Common/Timer.h"
 #include "Common/Version.h"
 #include "Core/IOS/Device.h"
 #include "Core/IOS/ES/ES.h"
@@ -362,6 +366,8 @@ RedumpVerifier::Result RedumpVerifier::Finish(const Hashes<std::vector<u8>>& has
 }
 
 constexpr u64 DEFAULT_READ_SIZE = 0x20000;  // Arbitrary value
+// Large enough for several Wii groups, so that reading can get ahead of the slower stages
+constexpr u64 MAX_CHUNK_MEMORY_USAGE = 0x2000000;
 
 VolumeVerifier::VolumeVerifier(const Volume& volume, bool redump_verification,
                                Hashes<bool> hashes_to_calculate)
@@ -373,6 +379,13 @@ VolumeVerifier::VolumeVerifier(const Volume& volume, bool redump_verification,
 {
   if (!m_calculating_any_hash)
     m_redump_verification = false;
+
+  m_stage_statistics[static_cast<size_t>(Stage::Read)].name = "Reading";
+  m_stage_statistics[static_cast<size_t>(Stage::CRC32)].name = "CRC32";
+  m_stage_statistics[static_cast<size_t>(Stage::MD5)].name = "MD5";
+  m_stage_statistics[static_cast<size_t>(Stage::SHA1)].name = "SHA-1";
+  m_stage_statistics[static_cast<size_t>(Stage::Content)].name = "Content checks";
+  m_stage_statistics[static_cast<size_t>(Stage::Blocks)].name = "Wii decryption and block checks";
 }
 
 VolumeVerifier::~VolumeVerifier()
@@ -1075,43 +1088,134 @@ void VolumeVerifier::SetUpHashing()
   {
     m_sha1_context = Common::SHA1::CreateContext();
   }
+
+  if (m_hashes_to_calculate.crc32)
+  {
+    StartWorker(Stage::CRC32, [this](const Chunk& chunk) {
+      m_crc32_context = Common::UpdateCRC32(m_crc32_context, chunk.data.data(),
+                                            static_cast<size_t>(chunk.byte_increment));
+      return chunk.byte_increment;
+    });
+  }
+
+  if (m_hashes_to_calculate.md5)
+  {
+    StartWorker(Stage::MD5, [this](const Chunk& chunk) {
+      mbedtls_md5_update_ret(&m_md5_context, chunk.data.data(), chunk.byte_increment);
+      return chunk.byte_increment;
+    });
+  }
+
+  if (m_hashes_to_calculate.sha1)
+  {
+    StartWorker(Stage::SHA1, [this](const Chunk& chunk) {
+      m_sha1_context->Update(chunk.data.data(), chunk.byte_increment);
+      return chunk.byte_increment;
+    });
+  }
+
+  if (!m_content_offsets.empty())
+  {
+    StartWorker(Stage::Content, [this](const Chunk& chunk) {
+      CheckContent(chunk);
+      return chunk.data.size();
+    });
+  }
+
+  if (!m_groups.empty())
+  {
+    StartWorker(Stage::Blocks, [this](const Chunk& chunk) {
+      CheckGroup(chunk);
+      return chunk.data.size();
+    });
+  }
+}
+
+void VolumeVerifier::StartWorker(Stage stage, std::function<u64(const Chunk&)> function)
+{
+  StageStatistics& statistics = m_stage_statistics[static_cast<size_t>(stage)];
+  m_workers[static_cast<size_t>(stage)] = std::make_unique<Worker>(
+      fmt::format("Verifier {}", statistics.name),
+      [&statistics, function = std::move(function)](std::shared_ptr<const Chunk> chunk) {
+        const u64 start_us = Common::Timer::NowUs();
+        statistics.bytes += function(*chunk);
+        statistics.busy_us += Common::Timer::NowUs() - start_us;
+      });
 }
 
-void VolumeVerifier::WaitForAsyncOperations() const
+void VolumeVerifier::WaitForAsyncOperations()
 {
-  if (m_crc32_future.valid())
-    m_crc32_future.wait();
-  if (m_md5_future.valid())
-    m_md5_future.wait();
-  if (m_sha1_future.valid())
-    m_sha1_future.wait();
-  if (m_content_future.valid())
-    m_content_future.wait();
-  if (m_group_future.valid())
-    m_group_future.wait();
+  for (const std::unique_ptr<Worker>& worker : m_workers)
+  {
+    if (worker)
+      worker->WaitForCompletion();
+  }
 }
 
-bool VolumeVerifier::ReadChunkAndWaitForAsyncOperations(u64 bytes_to_read)
+std::shared_ptr<VolumeVerifier::Chunk> VolumeVerifier::ReadChunk(u64 bytes_to_read)
 {
-  std::vector<u8> data(bytes_to_read);
+  // The last chunk is still needed for its excess bytes, so it doesn't count against the limit.
+  {
+    const u64 last_chunk_size = m_last_chunk ? m_last_chunk->data.size() : 0;
+    std::unique_lock lock(m_chunk_memory_lock);
+    m_chunk_memory_freed.wait(lock, [&] {
+      return m_chunk_memory_usage <= last_chunk_size ||
+             m_chunk_memory_usage + bytes_to_read <= MAX_CHUNK_MEMORY_USAGE;
+    });
+    m_chunk_memory_usage += bytes_to_read;
+  }
 
-  const u64 bytes_to_copy = std::min(m_excess_bytes, bytes_to_read);
-  if (bytes_to_copy > 0)
-    std::memcpy(data.data(), m_data.data() + m_data.size() - m_excess_bytes, bytes_to_copy);
-  bytes_to_read -= bytes_to_copy;
+  // Whichever stage finishes with the chunk last frees it.
+  const std::shared_ptr<Chunk> chunk(new Chunk, [this, bytes_to_read](Chunk* chunk_to_free) {
+    delete chunk_to_free;
+    {
+      std::lock_guard lock(m_chunk_memory_lock);
+      m_chunk_memory_usage -= bytes_to_read;
+    }
+    m_chunk_memory_freed.notify_one();
+  });
 
-  if (bytes_to_read > 0)
+  const u64 start_us = Common::Timer::NowUs();
+
+  // The excess bytes of the last chunk are at the start of this one, so a chunk that can be read
+  // in place doesn't need them.
+  chunk->data = m_volume.GetBlobReader().ReadInPlace(m_progress, bytes_to_read);
+  if (!chunk->data.empty())
+  {
+    // Mapped data is only read from the file when it's first accessed. Touch every page here, so
+    // that the I/O counts as reading instead of being charged to the first hashing stage.
+    const volatile u8* const data = chunk->data.data();
+    const size_t page_size = Common::MemPageSize();
+    for (size_t i = 0; i < chunk->data.size(); i += page_size)
+      data[i];
+  }
+  else
   {
-    if (!m_volume.Read(m_progress + bytes_to_copy, bytes_to_read, data.data() + bytes_to_copy,
-                       PARTITION_NONE))
+    chunk->buffer.resize(bytes_to_read);
+
+    const u64 bytes_to_copy = std::min(m_excess_bytes, bytes_to_read);
+    if (bytes_to_copy > 0)
     {
-      return false;
+      std::memcpy(chunk->buffer.data(),
+                  m_last_chunk->data.data() + m_last_chunk->data.size() - m_excess_bytes,
+                  bytes_to_copy);
     }
+
+    if (bytes_to_read > bytes_to_copy)
+    {
+      chunk->read_failed =
+          !m_volume.Read(m_progress + bytes_to_copy, bytes_to_read - bytes_to_copy,
+                         chunk->buffer.data() + bytes_to_copy, PARTITION_NONE);
+    }
+
+    chunk->data = chunk->buffer;
   }
 
-  WaitForAsyncOperations();
-  m_data = std::move(data);
-  return true;
+  StageStatistics& statistics = m_stage_statistics[static_cast<size_t>(Stage::Read)];
+  statistics.bytes += bytes_to_read;
+  statistics.busy_us += Common::Timer::NowUs() - start_us;
+
+  return chunk;
 }
 
 void VolumeVerifier::Process()
@@ -1185,7 +1289,8 @@ void VolumeVerifier::Process()
   }
 
   const bool is_data_needed = m_calculating_any_hash || content_read || group_read;
-  const bool read_failed = is_data_needed && !ReadChunkAndWaitForAsyncOperations(bytes_to_read);
+  std::shared_ptr<Chunk> chunk = is_data_needed ? ReadChunk(bytes_to_read) : nullptr;
+  const bool read_failed = chunk && chunk->read_failed;
 
   if (read_failed)
   {
@@ -1198,80 +1303,86 @@ void VolumeVerifier::Process()
   m_excess_bytes = excess_bytes;
   const u64 byte_increment = bytes_to_read - excess_bytes;
 
-  if (m_calculating_any_hash)
+  if (chunk)
   {
-    if (m_hashes_to_calculate.crc32)
-    {
-      m_crc32_future = std::async(std::launch::async, [this, byte_increment] {
-        m_crc32_context = Common::UpdateCRC32(m_crc32_context, m_data.data(),
-                                              static_cast<size_t>(byte_increment));
-      });
-    }
-
-    if (m_hashes_to_calculate.md5)
+    chunk->byte_increment = byte_increment;
+    if (content_read)
+      chunk->content = content;
+    if (group_read)
+      chunk->group_index = m_group_index;
+
+    const auto push = [&](Stage stage) { m_workers[static_cast<size_t>(stage)]->Push(chunk); };
+    if (m_calculating_any_hash)
     {
-      m_md5_future = std::async(std::launch::async, [this, byte_increment] {
-        mbedtls_md5_update_ret(&m_md5_context, m_data.data(), byte_increment);
-      });
-    }
-
-    if (m_hashes_to_calculate.sha1)
-    {
-      m_sha1_future = std::async(std::launch::async, [this, byte_increment] {
-        m_sha1_context->Update(m_data.data(), byte_increment);
-      });
+      if (m_hashes_to_calculate.crc32)
+        push(Stage::CRC32);
+      if (m_hashes_to_calculate.md5)
+        push(Stage::MD5);
+      if (m_hashes_to_calculate.sha1)
+        push(Stage::SHA1);
     }
+    if (content_read)
+      push(Stage::Content);
+    if (group_read)
+      push(Stage::Blocks);
   }
 
   if (content_read)
-  {
-    m_content_future = std::async(std::launch::async, [this, read_failed, content] {
-      if (read_failed || !m_volume.CheckContentIntegrity(content, m_data, m_ticket))
-      {
-        AddProblem(Severity::High, Common::FmtFormatT("Content {0:08x} is corrupt.", content.id));
-      }
-    });
-
     m_content_index++;
-  }
-
   if (group_read)
+    m_group_index++;
+
+  m_last_chunk = std::move(chunk);
+  m_progress += byte_increment;
+}
+
+void VolumeVerifier::CheckContent(const Chunk& chunk)
+{
+  const IOS::ES::Content& content = *chunk.content;
+  if (chunk.read_failed || !m_volume.CheckContentIntegrity(content, chunk.data, m_ticket))
+    AddProblem(Severity::High, Common::FmtFormatT("Content {0:08x} is corrupt.", content.id));
+}
+
+void VolumeVerifier::CheckGroup(const Chunk& chunk)
+{
+  const GroupToVerify& group = m_groups[*chunk.group_index];
+  u64 offset_in_group = 0;
+  for (u64 block_index = group.block_index_start; block_index < group.block_index_end;
+       ++block_index, offset_in_group += VolumeWii::BLOCK_TOTAL_SIZE)
   {
-    m_group_future = std::async(std::launch::async, [this, read_failed,
-                                                     group_index = m_group_index] {
-      const GroupToVerify& group = m_groups[group_index];
-      u64 offset_in_group = 0;
-      for (u64 block_index = group.block_index_start; block_index < group.block_index_end;
-           ++block_index, offset_in_group += VolumeWii::BLOCK_TOTAL_SIZE)
-      {
-        const u64 block_offset = group.offset + offset_in_group;
+    const u64 block_offset = group.offset + offset_in_group;
 
-        if (!read_failed && m_volume.CheckBlockIntegrity(
-                                block_index, m_data.data() + offset_in_group, group.partition))
-        {
-          m_biggest_verified_offset =
-              std::max(m_biggest_verified_offset, block_offset + VolumeWii::BLOCK_TOTAL_SIZE);
-        }
-        else
-        {
-          if (m_scrubber.CanBlockBeScrubbed(block_offset))
-          {
-            WARN_LOG_FMT(DISCIO, "Integrity check failed for unused block at {:#x}", block_offset);
-            m_unused_block_errors[group.partition]++;
-          }
-          else
-          {
-            WARN_LOG_FMT(DISCIO, "Integrity check failed for block at {:#x}", block_offset);
-            m_block_errors[group.partition]++;
-          }
-        }
+    const u8* block = chunk.data.data() + offset_in_group;
+    if (!chunk.read_failed && m_volume.CheckBlockIntegrity(block_index, block, group.partition))
+    {
+      m_biggest_verified_offset =
+          std::max(m_biggest_verified_offset, block_offset + VolumeWii::BLOCK_TOTAL_SIZE);
+    }
+    else
+    {
+      if (m_scrubber.CanBlockBeScrubbed(block_offset))
+      {
+        WARN_LOG_FMT(DISCIO, "Integrity check failed for unused block at {:#x}", block_offset);
+        m_unused_block_errors[group.partition]++;
       }
-    });
-
-    m_group_index++;
+      else
+      {
+        WARN_LOG_FMT(DISCIO, "Integrity check failed for block at {:#x}", block_offset);
+        m_block_errors[group.partition]++;
+      }
+    }
   }
+}
 
-  m_progress += byte_increment;
+std::vector<VolumeVerifier::StageStatistics> VolumeVerifier::GetStageStatistics() const
+{
+  std::vector<StageStatistics> statistics;
+  for (const StageStatistics& stage : m_stage_statistics)
+  {
+    if (stage.bytes != 0)
+      statistics.push_back(stage);
+  }
+  return statistics;
 }
 
 u64 VolumeVerifier::GetBytesProcessed() const
@@ -3,10 +3,15 @@
 
 #pragma once
 
+#include <array>
+#include <condition_variable>
+#include <functional>
 #include <future>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -14,6 +19,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/Crypto/SHA1.h"
+#include "Common/WorkQueueThread.h"
 #include "Core/IOS/ES/Formats.h"
 #include "DiscIO/DiscScrubber.h"
 #include "DiscIO/Volume.h"
@@ -27,7 +33,9 @@
 // verifier.Finish();
 // auto result = verifier.GetResult();
 //
-// Start, Process and Finish may take some time to run.
+// Start, Process and Finish may take some time to run. Process only reads the data. Hashing it,
+// decrypting and checking Wii partitions and checking WAD contents happen on one worker thread
+// each, so that all of them can run at the same time and none has to wait for the others.
 //
 // GetResult() can be called before the processing is finished, but the result will be incomplete.
 
@@ -124,6 +132,15 @@ public:
     RedumpVerifier::Result redump;
   };
 
+  // How much data a stage of verifying processed and how long that took, for finding out what
+  // limits the speed. The hashing stages don't count data that wasn't hashed.
+  struct StageStatistics
+  {
+    std::string name;
+    u64 bytes = 0;
+    u64 busy_us = 0;
+  };
+
   VolumeVerifier(const Volume& volume, bool redump_verification, Hashes<bool> hashes_to_calculate);
   ~VolumeVerifier();
 
@@ -134,8 +151,34 @@ public:
   u64 GetTotalBytes() const;
   void Finish();
   const Result& GetResult() const;
+  // Only complete once Finish has been called.
+  std::vector<StageStatistics> GetStageStatistics() const;
 
 private:
+  enum class Stage
+  {
+    Read,
+    CRC32,
+    MD5,
+    SHA1,
+    Content,
+    Blocks,
+    Count,
+  };
+
+  // A chunk of the volume, which the stages process in the order in which the chunks were read.
+  struct Chunk
+  {
+    // Points into buffer, or directly into the disc image if it's in memory
+    std::span<const u8> data;
+    std::vector<u8> buffer;
+    // The data after this is also at the start of the next chunk.
+    u64 byte_increment = 0;
+    bool read_failed = false;
+    std::optional<IOS::ES::Content> content;
+    std::optional<size_t> group_index;
+  };
+
   struct GroupToVerify
   {
     Partition partition;
@@ -156,8 +199,12 @@ private:
   void CheckMisc();
   void CheckSuperPaperMario();
   void SetUpHashing();
-  void WaitForAsyncOperations() const;
-  bool ReadChunkAndWaitForAsyncOperations(u64 bytes_to_read);
+  // The function returns how many bytes of the chunk it processed.
+  void StartWorker(Stage stage, std::function<u64(const Chunk&)> function);
+  void WaitForAsyncOperations();
+  std::shared_ptr<Chunk> ReadChunk(u64 bytes_to_read);
+  void CheckContent(const Chunk& chunk);
+  void CheckGroup(const Chunk& chunk);
 
   void AddProblem(Severity severity, std::string text);
 
@@ -180,12 +227,18 @@ private:
   std::unique_ptr<Common::SHA1::Context> m_sha1_context;
 
   u64 m_excess_bytes = 0;
-  std::vector<u8> m_data;
-  std::future<void> m_crc32_future;
-  std::future<void> m_md5_future;
-  std::future<void> m_sha1_future;
-  std::future<void> m_content_future;
-  std::future<void> m_group_future;
+
+  // Size of the chunks that have been read but not processed by all stages yet, which is limited
+  // so that reading doesn't get too far ahead of the slowest stage.
+  std::mutex m_chunk_memory_lock;
+  std::condition_variable m_chunk_memory_freed;
+  u64 m_chunk_memory_usage = 0;
+  std::shared_ptr<const Chunk> m_last_chunk;
+
+  using Worker = Common::WorkQueueThreadSP<std::shared_ptr<const Chunk>>;
+  // Indexed by Stage, nullptr for stages that aren't needed. Reading has no worker.
+  std::array<std::unique_ptr<Worker>, static_cast<size_t>(Stage::Count)> m_workers;
+  std::array<StageStatistics, static_cast<size_t>(Stage::Count)> m_stage_statistics;
 
   DiscScrubber m_scrubber;
   IOS::ES::TicketReader m_ticket;
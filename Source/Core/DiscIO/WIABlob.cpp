@@ -5,12 +5,15 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstring>
 #include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <span>
+#include <thread>
 #include <type_traits>
 #include <utility>
 
@@ -40,6 +43,11 @@
 
 namespace DiscIO
 {
+// Reads seldom span enough chunks to keep more threads than this busy.
+static constexpr u32 MAX_DECOMPRESSION_THREADS = 4;
+
+static std::atomic<u64> s_chunk_cache_size = 16 * 1024 * 1024;
+
 static void PushBack(std::vector<u8>* vector, const u8* begin, const u8* end)
 {
   const size_t offset_in_vector = vector->size();
@@ -56,6 +64,11 @@ static void PushBack(std::vector<u8>* vector, const T& x)
   PushBack(vector, x_ptr, x_ptr + sizeof(T));
 }
 
+void SetWIARVZChunkCacheSize(u64 bytes)
+{
+  s_chunk_cache_size.store(bytes, std::memory_order_relaxed);
+}
+
 std::pair<int, int> GetAllowedCompressionLevels(WIARVZCompressionType compression_type, bool gui)
 {
   switch (compression_type)
@@ -500,8 +513,11 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
   data_offset -= skipped_data;
   data_size += skipped_data;
 
-  const u64 start_group_index = (*offset - data_offset) / chunk_size;
-  for (u64 i = start_group_index; i < number_of_groups && (*size) > 0; ++i)
+  std::vector<GroupRead> reads;
+  u64 offset_in_data = *offset - data_offset;
+  u64 size_left = *size;
+  const u64 start_group_index = offset_in_data / chunk_size;
+  for (u64 i = start_group_index; i < number_of_groups && size_left > 0; ++i)
   {
     const u64 total_group_index = group_index + i;
     if (total_group_index >= m_group_entries.size())
@@ -509,11 +525,11 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
 
     const GroupEntry group = m_group_entries[total_group_index];
     const u64 group_offset_in_data = i * chunk_size;
-    const u64 offset_in_group = *offset - group_offset_in_data - data_offset;
+    const u64 offset_in_group = offset_in_data - group_offset_in_data;
 
     chunk_size = std::min(chunk_size, data_size - group_offset_in_data);
 
-    const u64 bytes_to_read = std::min(chunk_size - offset_in_group, *size);
+    const u64 bytes_to_read = std::min(chunk_size - offset_in_group, size_left);
     u32 group_data_size = Common::swap32(group.data_size);
 
     WIARVZCompressionType compression_type = m_compression_type;
@@ -528,43 +544,153 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
       rvz_packed_size = Common::swap32(group.rvz_packed_size);
     }
 
-    if (group_data_size == 0)
+    const u64 group_offset_in_file = static_cast<u64>(Common::swap32(group.data_offset)) << 2;
+    reads.push_back({total_group_index, group_offset_in_data, offset_in_group, bytes_to_read,
+                     chunk_size, group_offset_in_file, group_data_size, rvz_packed_size,
+                     compression_type});
+
+    offset_in_data += bytes_to_read;
+    size_left -= bytes_to_read;
+  }
+
+  if (reads.size() > 1)
+    DecompressInParallel(reads, *out_ptr, exception_lists);
+
+  for (const GroupRead& read : reads)
+  {
+    if (read.group_data_size == 0)
     {
-      std::memset(*out_ptr, 0, bytes_to_read);
+      std::memset(*out_ptr, 0, read.bytes_to_read);
     }
     else
     {
-      const u64 group_offset_in_file = static_cast<u64>(Common::swap32(group.data_offset)) << 2;
+      Chunk& chunk = ReadCompressedData(read.offset_in_file, read.group_data_size,
+                                        read.chunk_size, read.compression_type, exception_lists,
+                                        read.rvz_packed_size, read.group_offset_in_data);
 
-      Chunk& chunk =
-          ReadCompressedData(group_offset_in_file, group_data_size, chunk_size, compression_type,
-                             exception_lists, rvz_packed_size, group_offset_in_data);
-
-      if (!chunk.Read(offset_in_group, bytes_to_read, *out_ptr))
+      if (!read.decompressed && !chunk.Read(read.offset_in_group, read.bytes_to_read, *out_ptr))
       {
-        m_cached_chunk_offset = std::numeric_limits<u64>::max();  // Invalidate the cache
+        InvalidateChunk(read.offset_in_file);
         return false;
       }
 
-      if (m_write_to_exception_list && m_exception_list_last_group_index != total_group_index)
+      if (m_write_to_exception_list && m_exception_list_last_group_index != read.total_group_index)
       {
-        const u64 exception_list_index = offset_in_group / VolumeWii::GROUP_DATA_SIZE;
+        const u64 exception_list_index = read.offset_in_group / VolumeWii::GROUP_DATA_SIZE;
         const u16 additional_offset =
-            static_cast<u16>(group_offset_in_data % VolumeWii::GROUP_DATA_SIZE /
+            static_cast<u16>(read.group_offset_in_data % VolumeWii::GROUP_DATA_SIZE /
                              VolumeWii::BLOCK_DATA_SIZE * VolumeWii::BLOCK_HEADER_SIZE);
         chunk.GetHashExceptions(&m_exception_list, exception_list_index, additional_offset);
-        m_exception_list_last_group_index = total_group_index;
+        m_exception_list_last_group_index = read.total_group_index;
       }
     }
 
-    *offset += bytes_to_read;
-    *size -= bytes_to_read;
-    *out_ptr += bytes_to_read;
+    *offset += read.bytes_to_read;
+    *size -= read.bytes_to_read;
+    *out_ptr += read.bytes_to_read;
   }
 
   return true;
 }
 
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::DecompressInParallel(std::span<GroupRead> reads, u8* out_ptr,
+                                                 u32 exception_lists)
+{
+  // Only chunks that aren't cached yet need to be decompressed. ReadFromGroups still has to get
+  // the decompressed chunks and the cached ones before them from the cache afterwards, for
+  // example for their hash exceptions, so only as many chunks are handled as fit in the cache
+  // together. The cached ones are moved to the front, so that adding the new ones can't evict any
+  // of them, and ReadFromGroups doesn't add any chunks before it has gone past all of them.
+  m_decompression_jobs.clear();
+  const size_t cache_size = s_chunk_cache_size.load(std::memory_order_relaxed);
+  size_t memory_usage = 0;
+  for (GroupRead& read : reads)
+  {
+    u8* const read_out_ptr = out_ptr;
+    out_ptr += read.bytes_to_read;
+    if (read.group_data_size == 0)
+      continue;
+
+    const auto it = m_chunk_cache_map.find(read.offset_in_file);
+    if (it != m_chunk_cache_map.end())
+    {
+      memory_usage += it->second->chunk.GetMemoryUsage();
+      if (memory_usage > cache_size)
+        break;
+      m_chunk_cache.splice(m_chunk_cache.begin(), m_chunk_cache, it->second);
+      continue;
+    }
+
+    Chunk chunk =
+        CreateChunk(read.offset_in_file, read.group_data_size, read.chunk_size,
+                    read.compression_type, exception_lists, read.rvz_packed_size,
+                    read.group_offset_in_data);
+    memory_usage += chunk.GetMemoryUsage();
+    if (memory_usage > cache_size)
+      break;
+
+    Chunk& cached_chunk = InsertChunk(read.offset_in_file, std::move(chunk));
+    m_decompression_jobs.push_back({&cached_chunk, &read, read_out_ptr});
+  }
+
+  if (m_decompression_jobs.size() < 2)
+    return;
+
+  if (m_decompression_threads.empty())
+  {
+    const u32 thread_count =
+        std::clamp<u32>(std::thread::hardware_concurrency(), 1, MAX_DECOMPRESSION_THREADS);
+    for (u32 i = 1; i < thread_count; i++)
+    {
+      m_decompression_files.push_back(m_file.Duplicate("rb"));
+      if (!m_decompression_files.back())
+      {
+        m_decompression_files.pop_back();
+        break;
+      }
+    }
+    for (size_t i = 0; i < m_decompression_files.size(); i++)
+    {
+      m_decompression_threads.push_back(std::make_unique<Common::WorkQueueThreadSP<u32>>(
+          fmt::format("{} Decompressor {}", RVZ ? "RVZ" : "WIA", i + 1),
+          [this, file = &m_decompression_files[i]](u32) { RunDecompressionJobs(file); }));
+    }
+  }
+
+  const size_t num_workers =
+      std::min(m_decompression_threads.size(), m_decompression_jobs.size() - 1);
+  m_next_decompression_job.store(0, std::memory_order_relaxed);
+  for (size_t i = 0; i < num_workers; i++)
+    m_decompression_threads[i]->Push(0);
+  RunDecompressionJobs(&m_file);
+  for (size_t i = 0; i < num_workers; i++)
+    m_decompression_threads[i]->WaitForCompletion();
+
+  // Chunks that failed are read again by ReadFromGroups, which then reports the error.
+  for (const DecompressionJob& job : m_decompression_jobs)
+  {
+    if (!job.read->decompressed)
+      InvalidateChunk(job.read->offset_in_file);
+  }
+  m_decompression_jobs.clear();
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::RunDecompressionJobs(File::IOFile* file)
+{
+  for (size_t i = m_next_decompression_job.fetch_add(1, std::memory_order_relaxed);
+       i < m_decompression_jobs.size();
+       i = m_next_decompression_job.fetch_add(1, std::memory_order_relaxed))
+  {
+    const DecompressionJob& job = m_decompression_jobs[i];
+    job.chunk->SetFile(file);
+    job.read->decompressed =
+        job.chunk->Read(job.read->offset_in_group, job.read->bytes_to_read, job.out_ptr);
+    job.chunk->SetFile(&m_file);
+  }
+}
+
 template <bool RVZ>
 typename WIARVZFileReader<RVZ>::Chunk&
 WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_size,
@@ -572,9 +698,24 @@ WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_siz
                                           WIARVZCompressionType compression_type,
                                           u32 exception_lists, u32 rvz_packed_size, u64 data_offset)
 {
-  if (offset_in_file == m_cached_chunk_offset)
-    return m_cached_chunk;
+  const auto it = m_chunk_cache_map.find(offset_in_file);
+  if (it != m_chunk_cache_map.end())
+  {
+    m_chunk_cache.splice(m_chunk_cache.begin(), m_chunk_cache, it->second);
+    return it->second->chunk;
+  }
+
+  return InsertChunk(offset_in_file,
+                     CreateChunk(offset_in_file, compressed_size, decompressed_size,
+                                 compression_type, exception_lists, rvz_packed_size, data_offset));
+}
 
+template <bool RVZ>
+typename WIARVZFileReader<RVZ>::Chunk
+WIARVZFileReader<RVZ>::CreateChunk(u64 offset_in_file, u64 compressed_size, u64 decompressed_size,
+                                   WIARVZCompressionType compression_type, u32 exception_lists,
+                                   u32 rvz_packed_size, u64 data_offset)
+{
   std::unique_ptr<Decompressor> decompressor;
   switch (compression_type)
   {
@@ -603,11 +744,37 @@ WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_siz
 
   const bool compressed_exception_lists = compression_type > WIARVZCompressionType::Purge;
 
-  m_cached_chunk =
-      Chunk(&m_file, offset_in_file, compressed_size, decompressed_size, exception_lists,
-            compressed_exception_lists, rvz_packed_size, data_offset, std::move(decompressor));
-  m_cached_chunk_offset = offset_in_file;
-  return m_cached_chunk;
+  return Chunk(&m_file, offset_in_file, compressed_size, decompressed_size, exception_lists,
+               compressed_exception_lists, rvz_packed_size, data_offset, std::move(decompressor));
+}
+
+template <bool RVZ>
+typename WIARVZFileReader<RVZ>::Chunk& WIARVZFileReader<RVZ>::InsertChunk(u64 offset_in_file,
+                                                                          Chunk chunk)
+{
+  InvalidateChunk(offset_in_file);
+
+  m_chunk_cache_memory_usage += chunk.GetMemoryUsage();
+  m_chunk_cache.push_front({offset_in_file, std::move(chunk)});
+  m_chunk_cache_map.emplace(offset_in_file, m_chunk_cache.begin());
+
+  const size_t cache_size = s_chunk_cache_size.load(std::memory_order_relaxed);
+  while (m_chunk_cache_memory_usage > cache_size && m_chunk_cache.size() > 1)
+    InvalidateChunk(m_chunk_cache.back().offset_in_file);
+
+  return m_chunk_cache.front().chunk;
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::InvalidateChunk(u64 offset_in_file)
+{
+  const auto it = m_chunk_cache_map.find(offset_in_file);
+  if (it == m_chunk_cache_map.end())
+    return;
+
+  m_chunk_cache_memory_usage -= it->second->chunk.GetMemoryUsage();
+  m_chunk_cache.erase(it->second);
+  m_chunk_cache_map.erase(it);
 }
 
 template <bool RVZ>
@@ -4,17 +4,23 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <limits>
+#include <list>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <span>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/Crypto/SHA1.h"
 #include "Common/IOFile.h"
 #include "Common/Swap.h"
+#include "Common/WorkQueueThread.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/MultithreadedCompressor.h"
 #include "DiscIO/WIACompression.h"
@@ -37,6 +43,10 @@ enum class WIARVZCompressionType : u32
 
 std::pair<int, int> GetAllowedCompressionLevels(WIARVZCompressionType compression_type, bool gui);
 
+// Sets how much memory each WIA/RVZ reader may use for keeping decompressed chunks around.
+// The most recently used chunk is always kept, even if it alone is larger than this.
+void SetWIARVZChunkCacheSize(u64 bytes);
+
 constexpr u32 WIA_MAGIC = 0x01414957;  // "WIA\x1" (byteswapped to little endian)
 constexpr u32 RVZ_MAGIC = 0x015A5652;  // "RVZ\x1" (byteswapped to little endian)
 
@@ -194,6 +204,11 @@ private:
 
     bool Read(u64 offset, u64 size, u8* out_ptr);
 
+    // Changes which file the compressed data is read from. The file must be a copy of the
+    // original one, for reading the chunk on another thread.
+    void SetFile(File::IOFile* file) { m_file = file; }
+    size_t GetMemoryUsage() const { return m_in.data.size() + m_out.data.size(); }
+
     // This can only be called once at least one byte of data has been read
     void GetHashExceptions(std::vector<HashExceptionEntry>* exception_list,
                            u64 exception_list_index, u16 additional_offset) const;
@@ -234,12 +249,53 @@ private:
 
   const PartitionEntry* GetPartition(u64 partition_data_offset, u32* partition_first_sector) const;
 
+  // The part of a group that a read from ReadFromGroups covers.
+  struct GroupRead
+  {
+    u64 total_group_index;
+    u64 group_offset_in_data;
+    u64 offset_in_group;
+    u64 bytes_to_read;
+    u64 chunk_size;
+    u64 offset_in_file;
+    // 0 if the group only contains zeroes
+    u32 group_data_size;
+    u32 rvz_packed_size;
+    WIARVZCompressionType compression_type;
+    // Whether DecompressInParallel already read the data into the output.
+    bool decompressed = false;
+  };
+
+  struct DecompressionJob
+  {
+    Chunk* chunk;
+    GroupRead* read;
+    u8* out_ptr;
+  };
+
+  struct CachedChunk
+  {
+    u64 offset_in_file;
+    Chunk chunk;
+  };
+
   bool ReadFromGroups(u64* offset, u64* size, u8** out_ptr, u64 chunk_size, u32 sector_size,
                       u64 data_offset, u64 data_size, u32 group_index, u32 number_of_groups,
                       u32 exception_lists);
+  // Reads the chunks of a read that spans several groups on multiple threads.
+  void DecompressInParallel(std::span<GroupRead> reads, u8* out_ptr, u32 exception_lists);
+  void RunDecompressionJobs(File::IOFile* file);
+
+  // The returned chunk stays valid until the next call.
   Chunk& ReadCompressedData(u64 offset_in_file, u64 compressed_size, u64 decompressed_size,
                             WIARVZCompressionType compression_type, u32 exception_lists = 0,
                             u32 rvz_packed_size = 0, u64 data_offset = 0);
+  Chunk CreateChunk(u64 offset_in_file, u64 compressed_size, u64 decompressed_size,
+                    WIARVZCompressionType compression_type, u32 exception_lists,
+                    u32 rvz_packed_size, u64 data_offset);
+  // Adds a chunk to the cache and evicts the least recently used ones that no longer fit.
+  Chunk& InsertChunk(u64 offset_in_file, Chunk chunk);
+  void InvalidateChunk(u64 offset_in_file);
 
   static bool ApplyHashExceptions(const std::vector<HashExceptionEntry>& exception_list,
                                   VolumeWii::HashBlock hash_blocks[VolumeWii::BLOCKS_PER_GROUP]);
@@ -367,8 +423,10 @@ private:
 
   File::IOFile m_file;
   std::string m_path;
-  Chunk m_cached_chunk;
-  u64 m_cached_chunk_offset = std::numeric_limits<u64>::max();
+  // Most recently used first
+  std::list<CachedChunk> m_chunk_cache;
+  std::unordered_map<u64, typename std::list<CachedChunk>::iterator> m_chunk_cache_map;
+  size_t m_chunk_cache_memory_usage = 0;
   WiiEncryptionCache m_encryption_cache;
 
   std::vector<HashExceptionEntry> m_exception_list;
@@ -383,6 +441,12 @@ private:
 
   std::map<u64, DataEntry> m_data_entries;
 
+  // Copies of m_file for the decompression threads, which are only started once needed.
+  std::vector<File::IOFile> m_decompression_files;
+  std::vector<std::unique_ptr<Common::WorkQueueThreadSP<u32>>> m_decompression_threads;
+  std::vector<DecompressionJob> m_decompression_jobs;
+  std::atomic<size_t> m_next_decompression_job = 0;
+
   // Perhaps we could set WIA_VERSION_WRITE_COMPATIBLE to 0.9, but WIA version 0.9 was never in
   // any official release of wit, and interim versions (either source or binaries) are hard to find.
   // Since we've been unable to check if we're write compatible with 0.9, we set it 1.0 to be safe.
@@ -4,6 +4,7 @@
 #include "DolphinNoGUI/Platform.h"
 
 #include <OptionParser.h>
+#include <chrono>
 #include <csignal>
 #include <cstdio>
 #include <string>
@@ -15,12 +16,17 @@
 #include <Windows.h>
 #endif
 
+#include <fmt/format.h>
+
+#include "Common/Config/Config.h"
 #include "Common/ScopeGuard.h"
 #include "Common/StringUtil.h"
 #include "Core/Boot/Boot.h"
 #include "Core/BootManager.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/DolphinAnalytics.h"
+#include "Core/FifoPlayer/FifoPlayer.h"
 #include "Core/Host.h"
 #include "Core/System.h"
 
@@ -183,6 +189,33 @@ static std::unique_ptr<Platform> GetPlatform(const optparse::Values& options)
   return nullptr;
 }
 
+// Plays back a fifolog as fast as possible, looping it if needed, and prints the average frame rate
+// once the given number of frames has been written. Used to benchmark the video backends, in
+// particular the software renderer.
+static void SetUpFifoBenchmark(u32 frames)
+{
+  Config::SetCurrent(Config::MAIN_FIFOPLAYER_LOOP_REPLAY, true);
+  Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 0.0f);
+
+  using Clock = std::chrono::steady_clock;
+  Core::System::GetInstance().GetFifoPlayer().SetFrameWrittenCallback(
+      [frames, count = u32(0), start = Clock::time_point()]() mutable {
+        // The clock starts with the first frame so that booting isn't measured.
+        if (count == 0)
+        {
+          start = Clock::now();
+        }
+        else if (count == frames)
+        {
+          const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+          fmt::print("{} frames in {:.3f} s: {:.2f} FPS\n", frames, seconds, frames / seconds);
+          std::fflush(stdout);
+          s_platform->Stop();
+        }
+        ++count;
+      });
+}
+
 #ifdef _WIN32
 #define main app_main
 #endif
@@ -215,6 +248,13 @@ int main(const int argc, char* argv[])
 #endif
       });
 
+  parser->add_option("--fifo_benchmark")
+      .action("store")
+      .metavar("<frames>")
+      .type("int")
+      .help("Play back the given fifolog for this many frames as fast as possible, then print the "
+            "frame rate and exit");
+
   optparse::Values& options = CommandLineParse::ParseArguments(parser.get(), argc, argv);
   std::vector<std::string> args = parser->args();
 
@@ -288,6 +328,17 @@ int main(const int argc, char* argv[])
     return 1;
   }
 
+  if (options.is_set("fifo_benchmark"))
+  {
+    const int frames = options.get("fifo_benchmark");
+    if (frames <= 0)
+    {
+      fprintf(stderr, "The number of frames to benchmark must be positive.\n");
+      return 1;
+    }
+    SetUpFifoBenchmark(static_cast<u32>(frames));
+  }
+
   Core::AddOnStateChangedCallback([](const Core::State state) {
     if (state == Core::State::Uninitialized)
       s_platform->Stop();
@@ -9,6 +9,10 @@
 #include <QPushButton>
 #include <QVBoxLayout>
 
+#include "Common/Config/Config.h"
+
+#include "Core/Config/MainSettings.h"
+
 #include "DiscIO/Enums.h"
 #include "DiscIO/Volume.h"
 
@@ -66,7 +70,8 @@ PropertiesDialog::PropertiesDialog(QWidget* parent, const UICommon::GameFile& ga
 
   if (game.GetPlatform() != DiscIO::Platform::ELFOrDOL)
   {
-    std::shared_ptr<DiscIO::Volume> volume = DiscIO::CreateVolume(game.GetFilePath());
+    std::shared_ptr<DiscIO::Volume> volume =
+        DiscIO::CreateVolume(game.GetFilePath(), Config::Get(Config::MAIN_MAP_DISC_IMAGES));
     if (volume)
     {
       auto* const verify = new VerifyWidget(volume);
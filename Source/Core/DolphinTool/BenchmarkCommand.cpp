@@ -0,0 +1,253 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/BenchmarkCommand.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
+#include "Common/Timer.h"
+#include "DiscIO/Volume.h"
+#include "DiscIO/WIABlob.h"
+
+namespace DolphinTool
+{
+namespace
+{
+struct Access
+{
+  u64 offset;
+  u32 length;
+  DiscIO::Partition partition;
+};
+
+enum class ParseResult
+{
+  Access,
+  Skipped,
+  Invalid,
+};
+
+ParseResult ParseTraceLine(std::string_view line, Access* access)
+{
+  // Log lines of the DVD thread look like "... Read 0x1000 - 0x1800 partition 0xf800000 in ...".
+  // Other lines are "OFFSET LENGTH [PARTITION]".
+  const size_t log_start = line.find("Read 0x");
+  const bool is_log_line = log_start != std::string_view::npos;
+  if (is_log_line)
+    line.remove_prefix(log_start + 5);
+
+  line = StripWhitespace(line);
+  if (line.empty() || line.front() == '#')
+    return ParseResult::Skipped;
+
+  std::vector<std::string> tokens;
+  for (std::string& token : SplitString(std::string(line), ' '))
+  {
+    if (!token.empty())
+      tokens.push_back(std::move(token));
+  }
+
+  u64 start;
+  u64 end_or_length;
+  u64 partition = DiscIO::PARTITION_NONE.offset;
+  if (is_log_line)
+  {
+    if (tokens.size() < 3 || tokens[1] != "-" || !TryParse(tokens[0], &start) ||
+        !TryParse(tokens[2], &end_or_length) || end_or_length < start)
+    {
+      return ParseResult::Invalid;
+    }
+    if (tokens.size() >= 5 && tokens[3] == "partition" && !TryParse(tokens[4], &partition))
+      return ParseResult::Invalid;
+    end_or_length -= start;
+  }
+  else
+  {
+    if (tokens.size() < 2 || tokens.size() > 3 || !TryParse(tokens[0], &start) ||
+        !TryParse(tokens[1], &end_or_length) ||
+        (tokens.size() == 3 && !TryParse(tokens[2], &partition)))
+    {
+      return ParseResult::Invalid;
+    }
+  }
+
+  if (end_or_length == 0 || end_or_length > 0xFFFFFFFF)
+    return ParseResult::Invalid;
+
+  *access = {start, static_cast<u32>(end_or_length), DiscIO::Partition(partition)};
+  return ParseResult::Access;
+}
+}  // namespace
+
+int BenchmarkCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: benchmark [options]...\n\n"
+               "Replays a trace of disc reads against a disc image and reports how fast they are.\n"
+               "Each line of the trace is either \"OFFSET LENGTH [PARTITION]\" or a line that the\n"
+               "DVD thread logs for every read at the debug level of the DVDInterface log.");
+
+  parser.add_option("-i", "--input")
+      .type("string")
+      .action("store")
+      .help("Path to disc image FILE.")
+      .metavar("FILE");
+
+  parser.add_option("-t", "--trace")
+      .type("string")
+      .action("store")
+      .help("Path to the trace FILE to replay.")
+      .metavar("FILE");
+
+  parser.add_option("-c", "--cache_size")
+      .type("int")
+      .action("store")
+      .help("Optional. Memory in MiB for caching decompressed chunks of WIA/RVZ images. "
+            "Defaults to 16.")
+      .metavar("MIB");
+
+  parser.add_option("-r", "--repeat")
+      .type("int")
+      .action("store")
+      .help("Optional. Number of times to replay the trace with the same reader. Defaults to 1.")
+      .metavar("COUNT");
+
+  parser.add_option("-m", "--map")
+      .action("store_true")
+      .help("Optional. Map an uncompressed disc image into memory instead of reading it with "
+            "system calls.");
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  // Validate options
+  const std::string& input_file_path = options["input"];
+  if (input_file_path.empty())
+  {
+    fmt::print(std::cerr, "Error: No input set\n");
+    return EXIT_FAILURE;
+  }
+
+  const std::string& trace_file_path = options["trace"];
+  if (trace_file_path.empty())
+  {
+    fmt::print(std::cerr, "Error: No trace set\n");
+    return EXIT_FAILURE;
+  }
+
+  int repeat = 1;
+  if (options.is_set("repeat"))
+  {
+    repeat = static_cast<int>(options.get("repeat"));
+    if (repeat < 1)
+    {
+      fmt::print(std::cerr, "Error: Repeat count must be at least 1\n");
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (options.is_set("cache_size"))
+  {
+    const int cache_size = static_cast<int>(options.get("cache_size"));
+    if (cache_size < 0)
+    {
+      fmt::print(std::cerr, "Error: Cache size must not be negative\n");
+      return EXIT_FAILURE;
+    }
+    DiscIO::SetWIARVZChunkCacheSize(static_cast<u64>(cache_size) * 1024 * 1024);
+  }
+
+  // Read the trace
+  std::ifstream trace_file;
+  File::OpenFStream(trace_file, trace_file_path, std::ios_base::in);
+  if (!trace_file)
+  {
+    fmt::print(std::cerr, "Error: Unable to open trace\n");
+    return EXIT_FAILURE;
+  }
+
+  std::vector<Access> accesses;
+  u64 total_bytes = 0;
+  u32 max_length = 0;
+  size_t line_number = 0;
+  for (std::string line; std::getline(trace_file, line);)
+  {
+    line_number++;
+    Access access;
+    switch (ParseTraceLine(line, &access))
+    {
+    case ParseResult::Access:
+      accesses.push_back(access);
+      total_bytes += access.length;
+      max_length = std::max(max_length, access.length);
+      break;
+    case ParseResult::Skipped:
+      break;
+    case ParseResult::Invalid:
+      fmt::print(std::cerr, "Error: Invalid read on line {} of the trace\n", line_number);
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (accesses.empty())
+  {
+    fmt::print(std::cerr, "Error: The trace contains no reads\n");
+    return EXIT_FAILURE;
+  }
+
+  // Open the volume
+  const std::unique_ptr<DiscIO::Volume> volume =
+      DiscIO::CreateVolume(input_file_path, options.is_set_by_user("map"));
+  if (!volume)
+  {
+    fmt::print(std::cerr, "Error: Unable to open disc image\n");
+    return EXIT_FAILURE;
+  }
+
+  // Replay the trace. Later passes show how much the caches of the reader help.
+  std::vector<u8> buffer(max_length);
+  bool all_succeeded = true;
+  for (int pass = 1; pass <= repeat; pass++)
+  {
+    size_t failed_reads = 0;
+    u64 slowest_read_us = 0;
+    const u64 start_us = Common::Timer::NowUs();
+    for (const Access& access : accesses)
+    {
+      const u64 read_start_us = Common::Timer::NowUs();
+      if (!volume->Read(access.offset, access.length, buffer.data(), access.partition))
+        failed_reads++;
+      slowest_read_us = std::max(slowest_read_us, Common::Timer::NowUs() - read_start_us);
+    }
+    const u64 elapsed_us = std::max<u64>(Common::Timer::NowUs() - start_us, 1);
+
+    fmt::print(std::cout,
+               "Pass {}: {} reads of {:.2f} MiB in {:.3f} s: {:.2f} MiB/s, {:.1f} us per read on "
+               "average, {} us at most\n",
+               pass, accesses.size(), total_bytes / 1048576.0, elapsed_us / 1000000.0,
+               total_bytes / 1048576.0 / (elapsed_us / 1000000.0),
+               static_cast<double>(elapsed_us) / accesses.size(), slowest_read_us);
+
+    if (failed_reads != 0)
+    {
+      fmt::print(std::cerr, "Warning: {} reads failed\n", failed_reads);
+      all_succeeded = false;
+    }
+  }
+
+  return all_succeeded ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+}  // namespace DolphinTool
@@ -3,11 +3,20 @@
 
 #include "DolphinTool/ConvertCommand.h"
 
+#include <atomic>
 #include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
 #include <iostream>
 #include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <set>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <OptionParser.h>
@@ -15,12 +24,16 @@
 #include <fmt/ostream.h>
 
 #include "Common/CommonTypes.h"
+#include "Common/FileSearch.h"
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/DiscUtils.h"
 #include "DiscIO/ScrubbedBlob.h"
 #include "DiscIO/Volume.h"
 #include "DiscIO/VolumeDisc.h"
 #include "DiscIO/WIABlob.h"
+#include "DolphinTool/ReadBudget.h"
 #include "UICommon/UICommon.h"
 
 namespace DolphinTool
@@ -56,11 +69,287 @@ static std::optional<DiscIO::BlobType> ParseFormatString(const std::string& form
   return std::nullopt;
 }
 
+static std::string GetFormatExtension(DiscIO::BlobType format)
+{
+  switch (format)
+  {
+  case DiscIO::BlobType::GCZ:
+    return ".gcz";
+  case DiscIO::BlobType::WIA:
+    return ".wia";
+  case DiscIO::BlobType::RVZ:
+    return ".rvz";
+  default:
+    return ".iso";
+  }
+}
+
+// Paths to the same file compare equal after this, unless they go through links that don't exist
+// yet.
+static std::filesystem::path GetComparablePath(const std::string& path)
+{
+  std::error_code error;
+  std::filesystem::path comparable_path =
+      std::filesystem::weakly_canonical(StringToPath(path), error);
+  return error ? StringToPath(path).lexically_normal() : comparable_path;
+}
+
+namespace
+{
+struct ConvertOptions
+{
+  DiscIO::BlobType format;
+  bool scrub;
+  std::optional<int> block_size;
+  std::optional<DiscIO::WIARVZCompressionType> compression;
+  std::optional<int> compression_level;
+};
+
+struct ConvertJob
+{
+  std::string input_file_path;
+  std::string output_file_path;
+};
+}  // namespace
+
+// Reads the jobs of a batch from a directory of disc images, or from a manifest that lists one
+// input file per line, optionally followed by a tab and the output file. Outputs that aren't
+// listed are put in output_dir.
+static std::optional<std::vector<ConvertJob>> GetBatchJobs(const std::string& batch_path,
+                                                           const std::string& output_dir,
+                                                           DiscIO::BlobType format)
+{
+  std::vector<std::string> input_file_paths;
+  std::vector<std::string> output_file_paths;
+  if (File::IsDirectory(batch_path))
+  {
+    static const std::vector<std::string> disc_image_extensions = {
+        ".gcm", ".tgc", ".bin", ".iso", ".ciso", ".gcz", ".wbfs", ".wia", ".rvz", ".nfs"};
+    input_file_paths = Common::DoFileSearch({batch_path}, disc_image_extensions);
+    output_file_paths.resize(input_file_paths.size());
+  }
+  else
+  {
+    std::ifstream manifest;
+    File::OpenFStream(manifest, batch_path, std::ios_base::in);
+    if (!manifest)
+    {
+      fmt::print(std::cerr, "Error: Unable to open the batch manifest\n");
+      return std::nullopt;
+    }
+
+    for (std::string line; std::getline(manifest, line);)
+    {
+      const std::string_view entry = StripWhitespace(line);
+      if (entry.empty() || entry.starts_with('#'))
+        continue;
+
+      const size_t tab = entry.find('\t');
+      input_file_paths.emplace_back(StripWhitespace(entry.substr(0, tab)));
+      output_file_paths.emplace_back(
+          tab == std::string_view::npos ? std::string_view{} : StripWhitespace(entry.substr(tab)));
+    }
+  }
+
+  std::vector<ConvertJob> jobs;
+  for (size_t i = 0; i < input_file_paths.size(); i++)
+  {
+    std::string output_file_path = std::move(output_file_paths[i]);
+    if (output_file_path.empty())
+    {
+      if (output_dir.empty())
+      {
+        fmt::print(std::cerr, "Error: No output directory set for {}\n", input_file_paths[i]);
+        return std::nullopt;
+      }
+
+      std::string name;
+      SplitPath(input_file_paths[i], nullptr, &name, nullptr);
+      output_file_path = fmt::format("{}/{}{}", output_dir, name, GetFormatExtension(format));
+    }
+    jobs.push_back({std::move(input_file_paths[i]), std::move(output_file_path)});
+  }
+
+  // Outputs of an earlier run may be among the inputs, like when the outputs go into the batch
+  // directory, but they aren't converted again.
+  std::set<std::filesystem::path> output_paths;
+  for (const ConvertJob& job : jobs)
+    output_paths.insert(GetComparablePath(job.output_file_path));
+  std::erase_if(jobs, [&](const ConvertJob& job) {
+    return output_paths.contains(GetComparablePath(job.input_file_path));
+  });
+
+  // Jobs that write to the same output would overwrite each other, so they have to be renamed.
+  std::map<std::filesystem::path, const ConvertJob*> jobs_by_output;
+  for (const ConvertJob& job : jobs)
+  {
+    const auto [it, inserted] =
+        jobs_by_output.emplace(GetComparablePath(job.output_file_path), &job);
+    if (!inserted)
+    {
+      fmt::print(std::cerr, "Error: {} and {} would both be converted to {}\n",
+                 it->second->input_file_path, job.input_file_path, job.output_file_path);
+      return std::nullopt;
+    }
+  }
+
+  return jobs;
+}
+
+// Converts one image, passing the warnings and errors to report as they come up.
+static bool ConvertImage(const std::string& input_file_path, const std::string& output_file_path,
+                         const ConvertOptions& options, ReadBudget* budget,
+                         const std::function<void(const std::string&)>& report)
+{
+  const DiscIO::BlobType format = options.format;
+  const bool scrub = options.scrub;
+
+  // Open the blob reader
+  std::unique_ptr<DiscIO::BlobReader> blob_reader = DiscIO::CreateBlobReader(input_file_path);
+  if (!blob_reader)
+  {
+    report("Error: The input file could not be opened.");
+    return false;
+  }
+
+  // Open the volume
+  const std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateDisc(input_file_path);
+  if (!volume)
+  {
+    if (scrub)
+    {
+      report("Error: Scrubbing is only supported for GC/Wii disc images.");
+      return false;
+    }
+
+    report("Warning: The input file is not a GC/Wii disc image. Continuing anyway.");
+  }
+
+  if (scrub)
+  {
+    if (volume->IsDatelDisc())
+    {
+      report("Error: Scrubbing a Datel disc is not supported.");
+      return false;
+    }
+
+    blob_reader = DiscIO::ScrubbedBlob::Create(input_file_path);
+
+    if (!blob_reader)
+    {
+      report("Error: Unable to process disc image. Try again without --scrub.");
+      return false;
+    }
+  }
+
+  if (scrub && format == DiscIO::BlobType::RVZ)
+  {
+    report("Warning: Scrubbing an RVZ container does not offer significant space advantages. "
+           "Continuing anyway.");
+  }
+
+  if (scrub && format == DiscIO::BlobType::PLAIN)
+  {
+    report("Warning: Scrubbing does not save space when converting to ISO unless using external "
+           "compression. Continuing anyway.");
+  }
+
+  if (!scrub && format == DiscIO::BlobType::GCZ && volume &&
+      volume->GetVolumeType() == DiscIO::Platform::WiiDisc && !volume->IsDatelDisc())
+  {
+    report("Warning: Converting Wii disc images to GCZ without scrubbing may not offer space "
+           "advantages over ISO. Continuing anyway.");
+  }
+
+  if (volume && volume->IsNKit())
+    report("Warning: Converting an NKit file, output will still be NKit! Continuing anyway.");
+
+  if (format == DiscIO::BlobType::GCZ && volume &&
+      !DiscIO::IsGCZBlockSizeLegacyCompatible(options.block_size.value(), volume->GetDataSize()))
+  {
+    report("Warning: For GCZs to be compatible with Dolphin < 5.0-11893, the file size must be an "
+           "integer multiple of the block size and must not be an integer multiple of the block "
+           "size multiplied by 32. Continuing anyway.");
+  }
+
+  // Perform the conversion. The converters only report how far they are, which is turned into the
+  // amount of disc data that was read for the budget.
+  const u64 data_size = blob_reader->GetDataSize();
+  u64 bytes_read = 0;
+  const auto status_callback = [&](const std::string& text, float percent) {
+    if (budget)
+    {
+      const u64 new_bytes_read = static_cast<u64>(percent * static_cast<double>(data_size));
+      if (new_bytes_read > bytes_read)
+      {
+        budget->Spend(new_bytes_read - bytes_read);
+        bytes_read = new_bytes_read;
+      }
+    }
+    return true;
+  };
+
+  bool success = false;
+
+  switch (format)
+  {
+  case DiscIO::BlobType::PLAIN:
+  {
+    success = DiscIO::ConvertToPlain(blob_reader.get(), input_file_path, output_file_path,
+                                     status_callback);
+    break;
+  }
+
+  case DiscIO::BlobType::GCZ:
+  {
+    u32 sub_type = std::numeric_limits<u32>::max();
+    if (volume)
+    {
+      if (volume->GetVolumeType() == DiscIO::Platform::GameCubeDisc)
+        sub_type = 0;
+      else if (volume->GetVolumeType() == DiscIO::Platform::WiiDisc)
+        sub_type = 1;
+    }
+    success = DiscIO::ConvertToGCZ(blob_reader.get(), input_file_path, output_file_path, sub_type,
+                                   options.block_size.value(), status_callback);
+    break;
+  }
+
+  case DiscIO::BlobType::WIA:
+  case DiscIO::BlobType::RVZ:
+  {
+    success = DiscIO::ConvertToWIAOrRVZ(blob_reader.get(), input_file_path, output_file_path,
+                                        format == DiscIO::BlobType::RVZ,
+                                        options.compression.value(),
+                                        options.compression_level.value(),
+                                        options.block_size.value(), status_callback);
+    break;
+  }
+
+  default:
+  {
+    ASSERT(false);
+    break;
+  }
+  }
+
+  if (!success)
+  {
+    report("Error: Conversion failed");
+    return false;
+  }
+
+  return true;
+}
+
 int ConvertCommand(const std::vector<std::string>& args)
 {
   optparse::OptionParser parser;
 
-  parser.usage("usage: convert [options]... [FILE]...");
+  parser.usage("usage: convert [options]... [FILE]...\n\n"
+               "With --batch, all images of a directory or manifest are converted, several of them "
+               "at the\nsame time if --jobs is set. Outputs that already exist are skipped, so a "
+               "batch that was\ninterrupted can be resumed by running it again.");
 
   parser.add_option("-u", "--user")
       .type("string")
@@ -81,6 +370,31 @@ int ConvertCommand(const std::vector<std::string>& args)
       .help("Path to the destination FILE.")
       .metavar("FILE");
 
+  parser.add_option("--batch")
+      .type("string")
+      .action("store")
+      .help("Convert every disc image in DIR, or every image listed in a manifest with one "
+            "'INPUT[<tab>OUTPUT]' per line, instead of --input.")
+      .metavar("DIR|FILE");
+
+  parser.add_option("-d", "--output_dir")
+      .type("string")
+      .action("store")
+      .help("Directory for the outputs of --batch that the manifest doesn't name.")
+      .metavar("DIR");
+
+  parser.add_option("-j", "--jobs")
+      .type("int")
+      .action("store")
+      .help("Optional. Number of images of a batch to convert at the same time. Defaults to 1.")
+      .metavar("COUNT");
+
+  parser.add_option("--io_budget")
+      .type("int")
+      .action("store")
+      .help("Optional. Limits how many MB of disc data all images together are read per second.")
+      .metavar("MB");
+
   parser.add_option("-f", "--format")
       .type("string")
       .action("store")
@@ -119,97 +433,66 @@ int ConvertCommand(const std::vector<std::string>& args)
 
   // Validate options
 
-  // --input
-  if (!options.is_set("input"))
-  {
-    fmt::print(std::cerr, "Error: No input set\n");
-    return EXIT_FAILURE;
-  }
-  const std::string& input_file_path = options["input"];
-
-  // --output
-  if (!options.is_set("output"))
+  const bool batch = options.is_set("batch");
+  if (batch && (options.is_set("input") || options.is_set("output")))
   {
-    fmt::print(std::cerr, "Error: No output set\n");
+    fmt::print(std::cerr, "Error: --batch can't be used together with --input or --output\n");
     return EXIT_FAILURE;
   }
-  const std::string& output_file_path = options["output"];
 
-  // --format
-  const std::optional<DiscIO::BlobType> format_o = ParseFormatString(options["format"]);
-  if (!format_o.has_value())
+  // --input
+  if (!batch && !options.is_set("input"))
   {
-    fmt::print(std::cerr, "Error: No output format set\n");
+    fmt::print(std::cerr, "Error: No input set\n");
     return EXIT_FAILURE;
   }
-  const DiscIO::BlobType format = format_o.value();
 
-  // Open the blob reader
-  std::unique_ptr<DiscIO::BlobReader> blob_reader = DiscIO::CreateBlobReader(input_file_path);
-  if (!blob_reader)
+  // --output
+  if (!batch && !options.is_set("output"))
   {
-    fmt::print(std::cerr, "Error: The input file could not be opened.\n");
+    fmt::print(std::cerr, "Error: No output set\n");
     return EXIT_FAILURE;
   }
 
-  // --scrub
-  const bool scrub = static_cast<bool>(options.get("scrub"));
-
-  // Open the volume
-  const std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateDisc(input_file_path);
-  if (!volume)
+  // --jobs
+  int jobs = 1;
+  if (options.is_set("jobs"))
   {
-    if (scrub)
+    jobs = static_cast<int>(options.get("jobs"));
+    if (jobs < 1)
     {
-      fmt::print(std::cerr, "Error: Scrubbing is only supported for GC/Wii disc images.\n");
+      fmt::print(std::cerr, "Error: There must be at least 1 job\n");
       return EXIT_FAILURE;
     }
-
-    fmt::print(std::cerr,
-               "Warning: The input file is not a GC/Wii disc image. Continuing anyway.\n");
   }
 
-  if (scrub)
+  // --io_budget
+  std::unique_ptr<ReadBudget> budget;
+  if (options.is_set("io_budget"))
   {
-    if (volume->IsDatelDisc())
-    {
-      fmt::print(std::cerr, "Error: Scrubbing a Datel disc is not supported.\n");
-      return EXIT_FAILURE;
-    }
-
-    blob_reader = DiscIO::ScrubbedBlob::Create(input_file_path);
-
-    if (!blob_reader)
+    const int io_budget = static_cast<int>(options.get("io_budget"));
+    if (io_budget < 1)
     {
-      fmt::print(std::cerr, "Error: Unable to process disc image. Try again without --scrub.\n");
+      fmt::print(std::cerr, "Error: The I/O budget must be at least 1 MB per second\n");
       return EXIT_FAILURE;
     }
+    budget = std::make_unique<ReadBudget>(static_cast<u64>(io_budget) * 1000000);
   }
 
-  if (scrub && format == DiscIO::BlobType::RVZ)
-  {
-    fmt::print(std::cerr, "Warning: Scrubbing an RVZ container does not offer significant space "
-                          "advantages. Continuing anyway.\n");
-  }
-
-  if (scrub && format == DiscIO::BlobType::PLAIN)
-  {
-    fmt::print(std::cerr, "Warning: Scrubbing does not save space when converting to ISO unless "
-                          "using external compression. Continuing anyway.\n");
-  }
+  ConvertOptions convert_options{};
 
-  if (!scrub && format == DiscIO::BlobType::GCZ && volume &&
-      volume->GetVolumeType() == DiscIO::Platform::WiiDisc && !volume->IsDatelDisc())
+  // --format
+  const std::optional<DiscIO::BlobType> format_o = ParseFormatString(options["format"]);
+  if (!format_o.has_value())
   {
-    fmt::print(std::cerr, "Warning: Converting Wii disc images to GCZ without scrubbing may not "
-                          "offer space advantages over ISO. Continuing anyway.\n");
+    fmt::print(std::cerr, "Error: No output format set\n");
+    return EXIT_FAILURE;
   }
+  const DiscIO::BlobType format = format_o.value();
+  convert_options.format = format;
 
-  if (volume && volume->IsNKit())
-  {
-    fmt::print(std::cerr,
-               "Warning: Converting an NKit file, output will still be NKit! Continuing anyway.\n");
-  }
+  // --scrub
+  convert_options.scrub = static_cast<bool>(options.get("scrub"));
 
   // --block_size
   std::optional<int> block_size_o;
@@ -237,16 +520,8 @@ int ConvertCommand(const std::vector<std::string>& args)
       fmt::print(std::cerr,
                  "Warning: Block size is not ideal for performance. Continuing anyway.\n");
     }
-
-    if (format == DiscIO::BlobType::GCZ && volume &&
-        !DiscIO::IsGCZBlockSizeLegacyCompatible(block_size_o.value(), volume->GetDataSize()))
-    {
-      fmt::print(std::cerr,
-                 "Warning: For GCZs to be compatible with Dolphin < 5.0-11893, the file size "
-                 "must be an integer multiple of the block size and must not be an integer "
-                 "multiple of the block size multiplied by 32. Continuing anyway.\n");
-    }
   }
+  convert_options.block_size = block_size_o;
 
   // --compress, --compress_level
   const std::optional<DiscIO::WIARVZCompressionType> compression_o =
@@ -295,59 +570,76 @@ int ConvertCommand(const std::vector<std::string>& args)
       }
     }
   }
+  convert_options.compression = compression_o;
+  convert_options.compression_level = compression_level_o;
 
-  // Perform the conversion
-  const auto NOOP_STATUS_CALLBACK = [](const std::string& text, float percent) { return true; };
-
-  bool success = false;
-
-  switch (format)
-  {
-  case DiscIO::BlobType::PLAIN:
+  if (!batch)
   {
-    success = DiscIO::ConvertToPlain(blob_reader.get(), input_file_path, output_file_path,
-                                     NOOP_STATUS_CALLBACK);
-    break;
+    const auto report = [](const std::string& message) { fmt::print(std::cerr, "{}\n", message); };
+    return ConvertImage(options["input"], options["output"], convert_options, budget.get(),
+                        report) ?
+               EXIT_SUCCESS :
+               EXIT_FAILURE;
   }
 
-  case DiscIO::BlobType::GCZ:
-  {
-    u32 sub_type = std::numeric_limits<u32>::max();
-    if (volume)
+  const std::optional<std::vector<ConvertJob>> batch_jobs =
+      GetBatchJobs(options["batch"], options["output_dir"], format);
+  if (!batch_jobs)
+    return EXIT_FAILURE;
+
+  // Convert the images on as many threads as there are jobs. The compression threads of all
+  // conversions share the CPU cores, see DiscIO::GetCompressionSlots.
+  std::atomic<size_t> next_job = 0;
+  std::atomic<bool> all_succeeded = true;
+  std::mutex print_lock;
+  const auto convert_images = [&] {
+    for (size_t i = next_job++; i < batch_jobs->size(); i = next_job++)
     {
-      if (volume->GetVolumeType() == DiscIO::Platform::GameCubeDisc)
-        sub_type = 0;
-      else if (volume->GetVolumeType() == DiscIO::Platform::WiiDisc)
-        sub_type = 1;
-    }
-    success = DiscIO::ConvertToGCZ(blob_reader.get(), input_file_path, output_file_path, sub_type,
-                                   block_size_o.value(), NOOP_STATUS_CALLBACK);
-    break;
-  }
+      const ConvertJob& job = (*batch_jobs)[i];
+      const auto report = [&](const std::string& message) {
+        std::lock_guard lock(print_lock);
+        fmt::print(std::cerr, "{}: {}\n", job.input_file_path, message);
+      };
+
+      // Outputs are written under a temporary name and only renamed once they are complete, so an
+      // existing output was finished by an earlier run, while a partial one is started over.
+      if (File::Exists(job.output_file_path))
+      {
+        std::lock_guard lock(print_lock);
+        fmt::print(std::cout, "{}: Skipped, {} already exists\n", job.input_file_path,
+                   job.output_file_path);
+        continue;
+      }
 
-  case DiscIO::BlobType::WIA:
-  case DiscIO::BlobType::RVZ:
-  {
-    success = DiscIO::ConvertToWIAOrRVZ(blob_reader.get(), input_file_path, output_file_path,
-                                        format == DiscIO::BlobType::RVZ, compression_o.value(),
-                                        compression_level_o.value(), block_size_o.value(),
-                                        NOOP_STATUS_CALLBACK);
-    break;
-  }
+      const std::string partial_file_path = job.output_file_path + ".part";
+      File::CreateFullPath(partial_file_path);
+      bool success = ConvertImage(job.input_file_path, partial_file_path, convert_options,
+                                  budget.get(), report);
+      if (success && !File::Rename(partial_file_path, job.output_file_path))
+      {
+        report("Error: The output could not be renamed");
+        success = false;
+      }
 
-  default:
-  {
-    ASSERT(false);
-    break;
-  }
-  }
+      if (!success)
+      {
+        File::Delete(partial_file_path, File::IfAbsentBehavior::NoConsoleWarning);
+        all_succeeded = false;
+        continue;
+      }
 
-  if (!success)
-  {
-    fmt::print(std::cerr, "Error: Conversion failed\n");
-    return EXIT_FAILURE;
-  }
+      std::lock_guard lock(print_lock);
+      fmt::print(std::cout, "{}: Converted to {}\n", job.input_file_path, job.output_file_path);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (int i = 1; i < jobs && static_cast<size_t>(i) < batch_jobs->size(); i++)
+    threads.emplace_back(convert_images);
+  convert_images();
+  for (std::thread& thread : threads)
+    thread.join();
 
-  return EXIT_SUCCESS;
+  return all_succeeded ? EXIT_SUCCESS : EXIT_FAILURE;
 }
 }  // namespace DolphinTool
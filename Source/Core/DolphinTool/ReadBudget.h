@@ -0,0 +1,44 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include "Common/CommonTypes.h"
+
+namespace DolphinTool
+{
+// Limits how fast several images that are processed at the same time are read together, counted
+// in bytes of disc data rather than bytes of the image files.
+class ReadBudget
+{
+public:
+  explicit ReadBudget(u64 bytes_per_second) : m_bytes_per_second(bytes_per_second) {}
+
+  // Waits until the bytes that were just read fit in the budget.
+  void Spend(u64 bytes)
+  {
+    using Clock = std::chrono::steady_clock;
+
+    Clock::time_point wait_until;
+    {
+      std::lock_guard lock(m_lock);
+      // Budget that went unused in the past isn't saved up.
+      m_next_read = std::max(m_next_read, Clock::now()) +
+                    std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(
+                        static_cast<double>(bytes) / m_bytes_per_second));
+      wait_until = m_next_read;
+    }
+    std::this_thread::sleep_until(wait_until);
+  }
+
+private:
+  const u64 m_bytes_per_second;
+  std::mutex m_lock;
+  std::chrono::steady_clock::time_point m_next_read{};
+};
+}  // namespace DolphinTool
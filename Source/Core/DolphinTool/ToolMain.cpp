@@ -14,16 +14,19 @@
 #include "Common/StringUtil.h"
 #include "Core/Core.h"
 
+#include "DolphinTool/BenchmarkCommand.h"
 #include "DolphinTool/ConvertCommand.h"
 #include "DolphinTool/ExtractCommand.h"
 #include "DolphinTool/HeaderCommand.h"
+#include "DolphinTool/UIDCorpusCommand.h"
 #include "DolphinTool/VerifyCommand.h"
 
 static void PrintUsage()
 {
-  fmt::print(std::cerr, "usage: dolphin-tool COMMAND -h\n"
-                        "\n"
-                        "commands supported: [convert, verify, header, extract]\n");
+  fmt::print(std::cerr,
+             "usage: dolphin-tool COMMAND -h\n"
+             "\n"
+             "commands supported: [convert, verify, header, extract, uidcorpus, benchmark]\n");
 }
 
 #ifdef _WIN32
@@ -52,6 +55,10 @@ int main(int argc, char* argv[])
     return DolphinTool::HeaderCommand(args);
   else if (command_str == "extract")
     return DolphinTool::Extract(args);
+  else if (command_str == "uidcorpus")
+    return DolphinTool::UIDCorpusCommand(args);
+  else if (command_str == "benchmark")
+    return DolphinTool::BenchmarkCommand(args);
   PrintUsage();
   return EXIT_FAILURE;
 }
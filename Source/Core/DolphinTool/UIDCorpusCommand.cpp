@@ -0,0 +1,118 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/UIDCorpusCommand.h"
+
+#include <cstdlib>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include "VideoCommon/PipelineUIDCorpus.h"
+
+namespace DolphinTool
+{
+int UIDCorpusCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: uidcorpus [options]... FILE...\n\n"
+               "Merges the pipeline UID caches (GAMEID.uidcache) of one game from several\n"
+               "machines into a corpus. Corpora can be merged as well. Put the corpus into the\n"
+               "Cache directory as GAMEID.uidcorpus to compile its shaders when the game starts.");
+
+  parser.add_option("-o", "--output")
+      .type("string")
+      .action("store")
+      .help("Path to the corpus FILE to write.")
+      .metavar("FILE");
+
+  parser.add_option("-r", "--revision")
+      .type("int")
+      .action("store")
+      .help("Optional. Revision number of the corpus. Defaults to one more than the highest "
+            "revision of the merged corpora.")
+      .metavar("NUMBER");
+
+  const optparse::Values& options = parser.parse_args(args);
+  const std::vector<std::string> input_file_paths = parser.args();
+
+  // Validate options
+  const std::string& output_file_path = options["output"];
+  if (output_file_path.empty())
+  {
+    fmt::print(std::cerr, "Error: No output set\n");
+    return EXIT_FAILURE;
+  }
+
+  if (input_file_paths.empty())
+  {
+    fmt::print(std::cerr, "Error: No input set\n");
+    return EXIT_FAILURE;
+  }
+
+  std::optional<u32> revision;
+  if (options.is_set("revision"))
+  {
+    const int revision_int = static_cast<int>(options.get("revision"));
+    if (revision_int < 0)
+    {
+      fmt::print(std::cerr, "Error: Revision must not be negative\n");
+      return EXIT_FAILURE;
+    }
+    revision = static_cast<u32>(revision_int);
+  }
+
+  // Merge the inputs
+  VideoCommon::PipelineUIDCorpus corpus;
+  u32 merged_corpora = 0;
+  for (const std::string& input_file_path : input_file_paths)
+  {
+    if (const auto input_corpus = VideoCommon::PipelineUIDCorpus::Load(input_file_path))
+    {
+      corpus.AddCorpus(*input_corpus);
+      merged_corpora++;
+    }
+    else if (const auto uids = VideoCommon::ReadPipelineUIDCache(input_file_path))
+    {
+      corpus.AddUIDCache(*uids);
+    }
+    else
+    {
+      fmt::print(std::cerr,
+                 "Warning: Skipping {}, which is not a UID cache or corpus of this version\n",
+                 input_file_path);
+    }
+  }
+
+  if (corpus.GetSourceCount() == 0)
+  {
+    fmt::print(std::cerr, "Error: No valid input\n");
+    return EXIT_FAILURE;
+  }
+
+  corpus.SetRevision(revision.value_or(merged_corpora != 0 ? corpus.GetRevision() + 1 : 1));
+
+  if (!corpus.Save(output_file_path))
+  {
+    fmt::print(std::cerr, "Error: Unable to write {}\n", output_file_path);
+    return EXIT_FAILURE;
+  }
+
+  // Print a summary
+  const std::vector<VideoCommon::PipelineUIDCorpus::Entry> entries = corpus.GetEntries();
+  size_t shared_by_all = 0;
+  for (const VideoCommon::PipelineUIDCorpus::Entry& entry : entries)
+    shared_by_all += entry.occurrences == corpus.GetSourceCount();
+
+  fmt::print(std::cout, "Merged {} UID caches into {} pipeline UIDs, {} of them in every cache\n",
+             corpus.GetSourceCount(), entries.size(), shared_by_all);
+  fmt::print(std::cout, "Wrote revision {} to {}\n", corpus.GetRevision(), output_file_path);
+
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
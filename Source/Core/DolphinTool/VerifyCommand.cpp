@@ -3,8 +3,13 @@
 
 #include "DolphinTool/VerifyCommand.h"
 
+#include <atomic>
 #include <cstdlib>
+#include <iterator>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <OptionParser.h>
@@ -15,6 +20,7 @@
 #include "Core/AchievementManager.h"
 #include "DiscIO/Volume.h"
 #include "DiscIO/VolumeVerifier.h"
+#include "DolphinTool/ReadBudget.h"
 #include "UICommon/UICommon.h"
 
 namespace DolphinTool
@@ -30,55 +36,155 @@ static std::string HashToHexString(const std::vector<u8>& hash)
   return ss.str();
 }
 
-static void PrintFullReport(const DiscIO::VolumeVerifier::Result& result)
+static std::string GetFullReport(const DiscIO::VolumeVerifier::Result& result)
 {
+  std::string report;
+  const auto out = std::back_inserter(report);
+
   if (!result.hashes.crc32.empty())
-    fmt::print(std::cout, "CRC32: {}\n", HashToHexString(result.hashes.crc32));
+    fmt::format_to(out, "CRC32: {}\n", HashToHexString(result.hashes.crc32));
   else
-    fmt::print(std::cout, "CRC32 not computed\n");
+    fmt::format_to(out, "CRC32 not computed\n");
 
   if (!result.hashes.md5.empty())
-    fmt::print(std::cout, "MD5: {}\n", HashToHexString(result.hashes.md5));
+    fmt::format_to(out, "MD5: {}\n", HashToHexString(result.hashes.md5));
   else
-    fmt::print(std::cout, "MD5 not computed\n");
+    fmt::format_to(out, "MD5 not computed\n");
 
   if (!result.hashes.sha1.empty())
-    fmt::print(std::cout, "SHA1: {}\n", HashToHexString(result.hashes.sha1));
+    fmt::format_to(out, "SHA1: {}\n", HashToHexString(result.hashes.sha1));
   else
-    fmt::print(std::cout, "SHA1 not computed\n");
+    fmt::format_to(out, "SHA1 not computed\n");
 
-  fmt::print(std::cout, "Problems Found: {}\n", result.problems.empty() ? "No" : "Yes");
+  fmt::format_to(out, "Problems Found: {}\n", result.problems.empty() ? "No" : "Yes");
 
   for (const auto& problem : result.problems)
   {
-    fmt::print(std::cout, "\nSeverity: ");
+    fmt::format_to(out, "\nSeverity: ");
     switch (problem.severity)
     {
     case DiscIO::VolumeVerifier::Severity::Low:
-      fmt::print(std::cout, "Low");
+      fmt::format_to(out, "Low");
       break;
     case DiscIO::VolumeVerifier::Severity::Medium:
-      fmt::print(std::cout, "Medium");
+      fmt::format_to(out, "Medium");
       break;
     case DiscIO::VolumeVerifier::Severity::High:
-      fmt::print(std::cout, "High");
+      fmt::format_to(out, "High");
       break;
     case DiscIO::VolumeVerifier::Severity::None:
-      fmt::print(std::cout, "None");
+      fmt::format_to(out, "None");
       break;
     default:
       ASSERT(false);
       break;
     }
-    fmt::print(std::cout, "\nSummary: {}\n\n", problem.text);
+    fmt::format_to(out, "\nSummary: {}\n\n", problem.text);
+  }
+
+  return report;
+}
+
+static std::string
+GetStageStatisticsReport(const std::vector<DiscIO::VolumeVerifier::StageStatistics>& statistics)
+{
+  std::string report;
+  for (const DiscIO::VolumeVerifier::StageStatistics& stage : statistics)
+  {
+    // Bytes per microsecond are MB/s.
+    fmt::format_to(std::back_inserter(report), "{}: {:.1f} MB/s ({:.1f} MB in {:.2f} s)\n",
+                   stage.name,
+                   stage.busy_us != 0 ? static_cast<double>(stage.bytes) / stage.busy_us : 0.0,
+                   stage.bytes / 1000000.0, stage.busy_us / 1000000.0);
+  }
+  return report;
+}
+
+namespace
+{
+struct VerifyOptions
+{
+  DiscIO::Hashes<bool> hashes_to_calculate;
+  bool rc_hash_calculate;
+  bool algorithm_is_set;
+  bool print_stage_statistics;
+  bool map_plain_files;
+};
+}  // namespace
+
+// Writes what should be printed for the image to output, or the error to error.
+static bool VerifyImage(const std::string& input_file_path, const VerifyOptions& options,
+                        ReadBudget* budget, std::string* output, std::string* error)
+{
+  // Open the volume
+  const std::unique_ptr<DiscIO::Volume> volume =
+      DiscIO::CreateVolume(input_file_path, options.map_plain_files);
+  if (!volume)
+  {
+    *error = "Unable to open input file";
+    return false;
+  }
+
+  // Verify the volume
+  DiscIO::VolumeVerifier verifier(*volume, false, options.hashes_to_calculate);
+  verifier.Start();
+  while (verifier.GetBytesProcessed() != verifier.GetTotalBytes())
+  {
+    const u64 bytes_processed = verifier.GetBytesProcessed();
+    verifier.Process();
+    if (budget)
+      budget->Spend(verifier.GetBytesProcessed() - bytes_processed);
+  }
+  verifier.Finish();
+  const DiscIO::VolumeVerifier::Result& result = verifier.GetResult();
+
+  std::string rc_hash_result = "0";
+#ifdef USE_RETRO_ACHIEVEMENTS
+  // Calculate rcheevos hash
+  if (options.rc_hash_calculate)
+  {
+    static std::mutex rc_hash_lock;
+    std::lock_guard lock(rc_hash_lock);
+    rc_hash_result = AchievementManager::CalculateHash(input_file_path);
+  }
+#endif
+
+  // Print the report
+  const DiscIO::Hashes<bool>& hashes_to_calculate = options.hashes_to_calculate;
+  if (!options.algorithm_is_set)
+  {
+    *output = GetFullReport(result);
+  }
+  else
+  {
+    if (hashes_to_calculate.crc32 && !result.hashes.crc32.empty())
+      *output = fmt::format("{}\n", HashToHexString(result.hashes.crc32));
+    else if (hashes_to_calculate.md5 && !result.hashes.md5.empty())
+      *output = fmt::format("{}\n", HashToHexString(result.hashes.md5));
+    else if (hashes_to_calculate.sha1 && !result.hashes.sha1.empty())
+      *output = fmt::format("{}\n", HashToHexString(result.hashes.sha1));
+    else if (options.rc_hash_calculate)
+      *output = fmt::format("{}\n", rc_hash_result);
+    else
+    {
+      *error = "No hash computed";
+      return false;
+    }
   }
+
+  if (options.print_stage_statistics)
+    *output += GetStageStatisticsReport(verifier.GetStageStatistics());
+
+  return true;
 }
 
 int VerifyCommand(const std::vector<std::string>& args)
 {
   optparse::OptionParser parser;
 
-  parser.usage("usage: verify [options]...");
+  parser.usage("usage: verify [options]... [FILE]...\n\n"
+               "Images that are given as arguments are verified along with the input, several of "
+               "them at\nthe same time if --jobs is set.");
 
   parser.add_option("-u", "--user")
       .type("string")
@@ -100,6 +206,27 @@ int VerifyCommand(const std::vector<std::string>& args)
             "[%choices]")
       .choices({"crc32", "md5", "sha1", "rchash"});
 
+  parser.add_option("-j", "--jobs")
+      .type("int")
+      .action("store")
+      .help("Optional. Number of images to verify at the same time. Defaults to 1.")
+      .metavar("COUNT");
+
+  parser.add_option("-b", "--io_budget")
+      .type("int")
+      .action("store")
+      .help("Optional. Limits how many MB of disc data all images together are read per second.")
+      .metavar("MB");
+
+  parser.add_option("-s", "--stage_statistics")
+      .action("store_true")
+      .help("Optional. Print how many MB per second each stage of verifying processed.");
+
+  parser.add_option("-m", "--map")
+      .action("store_true")
+      .help("Optional. Map uncompressed disc images into memory instead of reading them with "
+            "system calls.");
+
   const optparse::Values& options = parser.parse_args(args);
 
   // Initialize the dolphin user directory, required for temporary processing files
@@ -108,93 +235,116 @@ int VerifyCommand(const std::vector<std::string>& args)
   UICommon::Init();
 
   // Validate options
-  if (!options.is_set("input"))
+  std::vector<std::string> input_file_paths = parser.args();
+  if (options.is_set("input"))
+    input_file_paths.insert(input_file_paths.begin(), options["input"]);
+  if (input_file_paths.empty())
   {
     fmt::print(std::cerr, "Error: No input set\n");
     return EXIT_FAILURE;
   }
-  const std::string& input_file_path = options["input"];
 
-  bool rc_hash_calculate = false;
-  std::string rc_hash_result = "0";
+  int jobs = 1;
+  if (options.is_set("jobs"))
+  {
+    jobs = static_cast<int>(options.get("jobs"));
+    if (jobs < 1)
+    {
+      fmt::print(std::cerr, "Error: There must be at least 1 job\n");
+      return EXIT_FAILURE;
+    }
+  }
+
+  std::unique_ptr<ReadBudget> budget;
+  if (options.is_set("io_budget"))
+  {
+    const int io_budget = static_cast<int>(options.get("io_budget"));
+    if (io_budget < 1)
+    {
+      fmt::print(std::cerr, "Error: The I/O budget must be at least 1 MB per second\n");
+      return EXIT_FAILURE;
+    }
+    budget = std::make_unique<ReadBudget>(static_cast<u64>(io_budget) * 1000000);
+  }
 
-  DiscIO::Hashes<bool> hashes_to_calculate{};
-  const bool algorithm_is_set = options.is_set("algorithm");
-  if (!algorithm_is_set)
+  VerifyOptions verify_options{};
+  verify_options.print_stage_statistics = options.is_set_by_user("stage_statistics");
+  verify_options.map_plain_files = options.is_set_by_user("map");
+
+  verify_options.algorithm_is_set = options.is_set("algorithm");
+  if (!verify_options.algorithm_is_set)
   {
-    hashes_to_calculate = DiscIO::VolumeVerifier::GetDefaultHashesToCalculate();
+    verify_options.hashes_to_calculate = DiscIO::VolumeVerifier::GetDefaultHashesToCalculate();
   }
   else
   {
     const std::string& algorithm = options["algorithm"];
     if (algorithm == "crc32")
-      hashes_to_calculate.crc32 = true;
+      verify_options.hashes_to_calculate.crc32 = true;
     else if (algorithm == "md5")
-      hashes_to_calculate.md5 = true;
+      verify_options.hashes_to_calculate.md5 = true;
     else if (algorithm == "sha1")
-      hashes_to_calculate.sha1 = true;
+      verify_options.hashes_to_calculate.sha1 = true;
 #ifdef USE_RETRO_ACHIEVEMENTS
     else if (algorithm == "rchash")
-      rc_hash_calculate = true;
+      verify_options.rc_hash_calculate = true;
 #endif
   }
 
+  const DiscIO::Hashes<bool>& hashes_to_calculate = verify_options.hashes_to_calculate;
   if (!hashes_to_calculate.crc32 && !hashes_to_calculate.md5 && !hashes_to_calculate.sha1 &&
-      !rc_hash_calculate)
+      !verify_options.rc_hash_calculate)
   {
     // optparse should protect from this
     fmt::print(std::cerr, "Error: No algorithms selected for the operation\n");
     return EXIT_FAILURE;
   }
 
-  // Open the volume
-  const std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateVolume(input_file_path);
-  if (!volume)
+  if (input_file_paths.size() == 1)
   {
-    fmt::print(std::cerr, "Error: Unable to open input file\n");
-    return EXIT_FAILURE;
-  }
-
-  // Verify the volume
-  DiscIO::VolumeVerifier verifier(*volume, false, hashes_to_calculate);
-  verifier.Start();
-  while (verifier.GetBytesProcessed() != verifier.GetTotalBytes())
-  {
-    verifier.Process();
-  }
-  verifier.Finish();
-  const DiscIO::VolumeVerifier::Result& result = verifier.GetResult();
-
-#ifdef USE_RETRO_ACHIEVEMENTS
-  // Calculate rcheevos hash
-  if (rc_hash_calculate)
-  {
-    rc_hash_result = AchievementManager::CalculateHash(input_file_path);
-  }
-#endif
-
-  // Print the report
-  if (!algorithm_is_set)
-  {
-    PrintFullReport(result);
-  }
-  else
-  {
-    if (hashes_to_calculate.crc32 && !result.hashes.crc32.empty())
-      fmt::print(std::cout, "{}\n", HashToHexString(result.hashes.crc32));
-    else if (hashes_to_calculate.md5 && !result.hashes.md5.empty())
-      fmt::print(std::cout, "{}\n", HashToHexString(result.hashes.md5));
-    else if (hashes_to_calculate.sha1 && !result.hashes.sha1.empty())
-      fmt::print(std::cout, "{}\n", HashToHexString(result.hashes.sha1));
-    else if (rc_hash_calculate)
-      fmt::print(std::cout, "{}\n", rc_hash_result);
-    else
+    std::string output;
+    std::string error;
+    if (!VerifyImage(input_file_paths[0], verify_options, budget.get(), &output, &error))
     {
-      fmt::print(std::cerr, "Error: No hash computed\n");
+      fmt::print(std::cerr, "Error: {}\n", error);
       return EXIT_FAILURE;
     }
+    fmt::print(std::cout, "{}", output);
+    return EXIT_SUCCESS;
   }
 
-  return EXIT_SUCCESS;
+  // Verify the images on as many threads as there are jobs, printing each result once it's done
+  std::atomic<size_t> next_image = 0;
+  std::atomic<bool> all_succeeded = true;
+  std::mutex print_lock;
+  const auto verify_images = [&] {
+    for (size_t i = next_image++; i < input_file_paths.size(); i = next_image++)
+    {
+      const std::string& path = input_file_paths[i];
+      std::string output;
+      std::string error;
+      const bool success = VerifyImage(path, verify_options, budget.get(), &output, &error);
+
+      std::lock_guard lock(print_lock);
+      if (success)
+      {
+        fmt::print(std::cout, "{}:\n{}\n", path, output);
+      }
+      else
+      {
+        fmt::print(std::cerr, "Error: {}: {}\n", path, error);
+        all_succeeded = false;
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (int i = 1; i < jobs && static_cast<size_t>(i) < input_file_paths.size(); i++)
+    threads.emplace_back(verify_images);
+  verify_images();
+  for (std::thread& thread : threads)
+    thread.join();
+
+  return all_succeeded ? EXIT_SUCCESS : EXIT_FAILURE;
 }
 }  // namespace DolphinTool
@@ -4,24 +4,42 @@
 #include "VideoBackends/Software/Rasterizer.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstring>
+#include <memory>
 #include <vector>
 
+#include <fmt/format.h>
+
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
+#include "Common/WorkQueueThread.h"
 
 #include "VideoBackends/Software/NativeVertexFormat.h"
 #include "VideoBackends/Software/SWEfbInterface.h"
 #include "VideoBackends/Software/Tev.h"
+#include "VideoBackends/Software/TevCombiner.h"
 #include "VideoCommon/BPFunctions.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/PerfQueryBase.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VideoCommon.h"
+#include "VideoCommon/VideoConfig.h"
 
 namespace Rasterizer
 {
 static constexpr int BLOCK_SIZE = 2;
+// Blocks are shaded by the Tev as one quad.
+static_assert(BLOCK_SIZE * BLOCK_SIZE == Tev::QUAD_SIZE);
+
+// With more than one thread, triangles are binned into tiles of the EFB which are rasterized in
+// parallel. Tiles are aligned to blocks, so every pixel belongs to exactly one tile and is computed
+// exactly as it would be when drawing serially, and each tile draws its triangles in order.
+static constexpr s32 TILE_SIZE = 64;
+static_assert(TILE_SIZE % BLOCK_SIZE == 0);
+static constexpr s32 NUM_TILES_X = (EFB_WIDTH + TILE_SIZE - 1) / TILE_SIZE;
+static constexpr s32 NUM_TILES_Y = (EFB_HEIGHT + TILE_SIZE - 1) / TILE_SIZE;
 
 struct SlopeContext
 {
@@ -94,21 +112,81 @@ struct Slope
   }
 };
 
-static Slope ZSlope;
-static Slope WSlope;
-static Slope ColorSlopes[2][4];
-static Slope TexSlopes[8][3];
+// Everything needed to rasterize a triangle within one scissor rectangle.
+struct Triangle
+{
+  Slope ZSlope;
+  Slope WSlope;
+  Slope ColorSlopes[2][4];
+  Slope TexSlopes[8][3];
+
+  // Half-edge deltas and constants, in 28.4 fixed-point
+  s32 DX12, DX23, DX31;
+  s32 DY12, DY23, DY31;
+  s32 C1, C2, C3;
+
+  // Bounding rectangle, clipped to the scissor rectangle
+  s32 minx, maxx, miny, maxy;
+};
+
+// The state of one rasterizing thread.
+struct RasterContext
+{
+  Tev tev;
+  RasterBlock rasterBlock;
+};
 
-static Tev tev;
-static RasterBlock rasterBlock;
+static Slope ZSlope;
 
 static std::vector<BPFunctions::ScissorRect> scissors;
 
+// contexts[0] belongs to the video thread, the others to the worker threads.
+static std::vector<std::unique_ptr<RasterContext>> contexts;
+static std::vector<std::unique_ptr<Common::WorkQueueThreadSP<RasterContext*>>> workers;
+
+// Triangles of the current draw. Without workers, triangles are drawn as soon as they are set up.
+static Triangle serialTriangle;
+static std::vector<Triangle> triangles;
+static std::array<std::vector<u32>, NUM_TILES_X * NUM_TILES_Y> tileBins;
+static std::vector<u32> usedTiles;
+static std::atomic<u32> nextTile;
+
+static void RasterizeTiles(RasterContext& context);
+
+static void SetThreadCount(u32 count)
+{
+  count = std::clamp<u32>(count, 1, NUM_TILES_X * NUM_TILES_Y);
+  if (contexts.size() == count)
+    return;
+
+  workers.clear();
+
+  while (contexts.size() < count)
+    contexts.push_back(std::make_unique<RasterContext>());
+  contexts.resize(count);
+
+  for (u32 i = 1; i < count; i++)
+  {
+    workers.push_back(std::make_unique<Common::WorkQueueThreadSP<RasterContext*>>(
+        fmt::format("SW Rasterizer {}", i),
+        [](RasterContext* context) { RasterizeTiles(*context); }));
+  }
+}
+
 void Init()
 {
   // The other slopes are set each for each primitive drawn, but zfreeze means that the z slope
   // needs to be set to an (untested) default value.
   ZSlope = Slope();
+
+  SetThreadCount(1);
+}
+
+void Shutdown()
+{
+  workers.clear();
+  contexts.clear();
+  triangles.clear();
 }
 
 void ScissorChanged()
@@ -138,43 +216,89 @@ static inline int iround(float x)
   return t;
 }
 
-void SetTevKonstColors()
+void BeginDraw()
+{
+  SetThreadCount(g_ActiveConfig.GetSWRasterizerThreads());
+
+  // The generic combiner is the scalar reference, to compare the output of the vectorized
+  // combiners against.
+  const TevCombiner::CombineFunction combine =
+      TevCombiner::GetCombineFunction(g_ActiveConfig.bSWVectorizedTev ?
+                                          TevCombiner::GetBestImplementation() :
+                                          TevCombiner::Implementation::Generic);
+
+  for (auto& context : contexts)
+    context->tev.BeginDraw(combine);
+}
+
+void EndDraw()
 {
-  tev.SetKonstColors();
+  if (!triangles.empty())
+  {
+    for (u32 tile = 0; tile < tileBins.size(); tile++)
+    {
+      if (!tileBins[tile].empty())
+        usedTiles.push_back(tile);
+    }
+
+    // The video thread rasterizes too, so a single tile doesn't need any workers.
+    const size_t num_workers = std::min(workers.size(), usedTiles.size() - 1);
+    nextTile.store(0, std::memory_order_relaxed);
+    for (size_t i = 0; i < num_workers; i++)
+      workers[i]->Push(contexts[i + 1].get());
+    RasterizeTiles(*contexts[0]);
+    for (size_t i = 0; i < num_workers; i++)
+      workers[i]->WaitForCompletion();
+
+    for (const u32 tile : usedTiles)
+      tileBins[tile].clear();
+    usedTiles.clear();
+    triangles.clear();
+  }
+
+  for (auto& context : contexts)
+    context->tev.FlushCounters();
 }
 
-static void Draw(s32 x, s32 y, s32 xi, s32 yi)
+// Sets up one pixel of the quad in the Tev. Returns whether the pixel passed the early depth test
+// and needs to be shaded.
+static bool SetupPixel(s32 x, s32 y, s32 xi, s32 yi, const Triangle& triangle,
+                       RasterContext& context)
 {
-  INCSTAT(g_stats.this_frame.rasterized_pixels);
+  Tev& tev = context.tev;
+  RasterBlock& rasterBlock = context.rasterBlock;
 
-  s32 z = (s32)std::clamp<float>(ZSlope.GetValue(x, y), 0.0f, 16777215.0f);
+  tev.counters.rasterized_pixels++;
+
+  s32 z = (s32)std::clamp<float>(triangle.ZSlope.GetValue(x, y), 0.0f, 16777215.0f);
 
   if (bpmem.GetEmulatedZ() == EmulatedZ::Early)
   {
     // TODO: Test if perf regs are incremented even if test is disabled
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_INPUT_ZCOMPLOC);
+    tev.counters.perf_pixels[PQ_ZCOMP_INPUT_ZCOMPLOC]++;
     if (bpmem.zmode.test_enable)
     {
       // early z
       if (!EfbInterface::ZCompare(x, y, z))
-        return;
+        return false;
     }
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_OUTPUT_ZCOMPLOC);
+    tev.counters.perf_pixels[PQ_ZCOMP_OUTPUT_ZCOMPLOC]++;
   }
 
   RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
+  Tev::Pixel& tevPixel = tev.Pixels[xi + yi * BLOCK_SIZE];
 
-  tev.Position[0] = x;
-  tev.Position[1] = y;
-  tev.Position[2] = z;
+  tevPixel.Position[0] = x;
+  tevPixel.Position[1] = y;
+  tevPixel.Position[2] = z;
 
   //  colors
   for (unsigned int i = 0; i < bpmem.genMode.numcolchans; i++)
   {
     for (int comp = 0; comp < 4; comp++)
     {
-      const float color = ColorSlopes[i][comp].GetValue(x, y);
-      tev.Color[i][comp] = (u8)std::clamp<float>(color, 0.0f, 255.0f);
+      const float color = triangle.ColorSlopes[i][comp].GetValue(x, y);
+      tevPixel.Color[i][comp] = (u8)std::clamp<float>(color, 0.0f, 255.0f);
     }
   }
 
@@ -182,10 +306,22 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
   for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
   {
     // multiply by 128 because TEV stores UVs as s17.7
-    tev.Uv[i].s = (s32)(pixel.Uv[i][0] * 128);
-    tev.Uv[i].t = (s32)(pixel.Uv[i][1] * 128);
+    tevPixel.Uv[i].s = (s32)(pixel.Uv[i][0] * 128);
+    tevPixel.Uv[i].t = (s32)(pixel.Uv[i][1] * 128);
   }
 
+  return true;
+}
+
+// Shades the pixels of the current block whose bit is set in mask.
+static void DrawQuad(u32 mask, RasterContext& context)
+{
+  if (mask == 0)
+    return;
+
+  Tev& tev = context.tev;
+  const RasterBlock& rasterBlock = context.rasterBlock;
+
   for (unsigned int i = 0; i < bpmem.genMode.numindstages; i++)
   {
     tev.IndirectLod[i] = rasterBlock.IndirectLod[i];
@@ -198,10 +334,11 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
     tev.TextureLinear[i] = rasterBlock.TextureLinear[i];
   }
 
-  tev.Draw();
+  tev.Draw(mask);
 }
 
-static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoord)
+static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoord,
+                                const RasterBlock& rasterBlock)
 {
   auto texUnit = bpmem.tex.GetUnit(texmap);
 
@@ -212,9 +349,9 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
 
   float sDelta, tDelta;
 
-  float* uv00 = rasterBlock.Pixel[0][0].Uv[texcoord];
-  float* uv10 = rasterBlock.Pixel[1][0].Uv[texcoord];
-  float* uv01 = rasterBlock.Pixel[0][1].Uv[texcoord];
+  const float* uv00 = rasterBlock.Pixel[0][0].Uv[texcoord];
+  const float* uv10 = rasterBlock.Pixel[1][0].Uv[texcoord];
+  const float* uv01 = rasterBlock.Pixel[0][1].Uv[texcoord];
 
   float dudx = fabsf(uv00[0] - uv10[0]);
   float dvdx = fabsf(uv00[1] - uv10[1]);
@@ -252,8 +389,11 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
   *lodp = lod;
 }
 
-static void BuildBlock(s32 blockX, s32 blockY)
+static void BuildBlock(s32 blockX, s32 blockY, const Triangle& triangle, RasterBlock& rasterBlock)
 {
+  const Slope& WSlope = triangle.WSlope;
+  const auto& TexSlopes = triangle.TexSlopes;
+
   for (s32 yi = 0; yi < BLOCK_SIZE; yi++)
   {
     for (s32 xi = 0; xi < BLOCK_SIZE; xi++)
@@ -285,7 +425,8 @@ static void BuildBlock(s32 blockX, s32 blockY)
     u32 texmap = bpmem.tevindref.getTexMap(i);
     u32 texcoord = bpmem.tevindref.getTexCoord(i);
 
-    CalculateLOD(&rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap, texcoord);
+    CalculateLOD(&rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap, texcoord,
+                 rasterBlock);
   }
 
   for (unsigned int i = 0; i <= bpmem.genMode.numtevstages; i++)
@@ -297,7 +438,8 @@ static void BuildBlock(s32 blockX, s32 blockY)
       u32 texmap = order.getTexMap(stageOdd);
       u32 texcoord = order.getTexCoord(stageOdd);
 
-      CalculateLOD(&rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap, texcoord);
+      CalculateLOD(&rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap, texcoord,
+                   rasterBlock);
     }
   }
 }
@@ -314,34 +456,16 @@ void UpdateZSlope(const OutputVertexData* v0, const OutputVertexData* v1,
   }
 }
 
-static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
-                                  const OutputVertexData* v2,
-                                  const BPFunctions::ScissorRect& scissor)
+static void RasterizeTriangle(const Triangle& triangle, s32 clip_left, s32 clip_top,
+                              s32 clip_right, s32 clip_bottom, RasterContext& context)
 {
-  // The zslope should be updated now, even if the triangle is rejected by the scissor test, as
-  // zfreeze depends on it
-  UpdateZSlope(v0, v1, v2, scissor.x_off, scissor.y_off);
+  const s32 DX12 = triangle.DX12;
+  const s32 DX23 = triangle.DX23;
+  const s32 DX31 = triangle.DX31;
 
-  // adapted from http://devmaster.net/posts/6145/advanced-rasterization
-
-  // 28.4 fixed-point coordinates. rounded to nearest and adjusted to match hardware output
-  // could also take floor and adjust -8
-  const s32 Y1 = iround(16.0f * (v0->screenPosition.y - scissor.y_off)) - 9;
-  const s32 Y2 = iround(16.0f * (v1->screenPosition.y - scissor.y_off)) - 9;
-  const s32 Y3 = iround(16.0f * (v2->screenPosition.y - scissor.y_off)) - 9;
-
-  const s32 X1 = iround(16.0f * (v0->screenPosition.x - scissor.x_off)) - 9;
-  const s32 X2 = iround(16.0f * (v1->screenPosition.x - scissor.x_off)) - 9;
-  const s32 X3 = iround(16.0f * (v2->screenPosition.x - scissor.x_off)) - 9;
-
-  // Deltas
-  const s32 DX12 = X1 - X2;
-  const s32 DX23 = X2 - X3;
-  const s32 DX31 = X3 - X1;
-
-  const s32 DY12 = Y1 - Y2;
-  const s32 DY23 = Y2 - Y3;
-  const s32 DY31 = Y3 - Y1;
+  const s32 DY12 = triangle.DY12;
+  const s32 DY23 = triangle.DY23;
+  const s32 DY31 = triangle.DY31;
 
   // Fixed-point deltas
   const s32 FDX12 = DX12 * 16;
@@ -352,63 +476,19 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
   const s32 FDY23 = DY23 * 16;
   const s32 FDY31 = DY31 * 16;
 
-  // Bounding rectangle
-  s32 minx = (std::min(std::min(X1, X2), X3) + 0xF) >> 4;
-  s32 maxx = (std::max(std::max(X1, X2), X3) + 0xF) >> 4;
-  s32 miny = (std::min(std::min(Y1, Y2), Y3) + 0xF) >> 4;
-  s32 maxy = (std::max(std::max(Y1, Y2), Y3) + 0xF) >> 4;
-
-  // scissor
-  ASSERT(scissor.rect.left >= 0);
-  ASSERT(scissor.rect.right <= static_cast<int>(EFB_WIDTH));
-  ASSERT(scissor.rect.top >= 0);
-  ASSERT(scissor.rect.bottom <= static_cast<int>(EFB_HEIGHT));
+  const s32 C1 = triangle.C1;
+  const s32 C2 = triangle.C2;
+  const s32 C3 = triangle.C3;
 
-  minx = std::max(minx, scissor.rect.left);
-  maxx = std::min(maxx, scissor.rect.right);
-  miny = std::max(miny, scissor.rect.top);
-  maxy = std::min(maxy, scissor.rect.bottom);
+  // The clip rectangle is aligned to blocks, so clipping only skips whole blocks
+  const s32 minx = std::max(triangle.minx, clip_left);
+  const s32 maxx = std::min(triangle.maxx, clip_right);
+  const s32 miny = std::max(triangle.miny, clip_top);
+  const s32 maxy = std::min(triangle.maxy, clip_bottom);
 
   if (minx >= maxx || miny >= maxy)
     return;
 
-  // Set up the remaining slopes
-  const SlopeContext ctx(v0, v1, v2, (X1 + 0xF) >> 4, (Y1 + 0xF) >> 4, scissor.x_off,
-                         scissor.y_off);
-
-  float w[3] = {1.0f / v0->projectedPosition.w, 1.0f / v1->projectedPosition.w,
-                1.0f / v2->projectedPosition.w};
-  WSlope = Slope(w[0], w[1], w[2], ctx);
-
-  for (unsigned int i = 0; i < bpmem.genMode.numcolchans; i++)
-  {
-    for (int comp = 0; comp < 4; comp++)
-      ColorSlopes[i][comp] = Slope(v0->color[i][comp], v1->color[i][comp], v2->color[i][comp], ctx);
-  }
-
-  for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
-  {
-    TexSlopes[i][0] =
-        Slope(v0->texCoords[i].x * w[0], v1->texCoords[i].x * w[1], v2->texCoords[i].x * w[2], ctx);
-    TexSlopes[i][1] =
-        Slope(v0->texCoords[i].y * w[0], v1->texCoords[i].y * w[1], v2->texCoords[i].y * w[2], ctx);
-    TexSlopes[i][2] =
-        Slope(v0->texCoords[i].z * w[0], v1->texCoords[i].z * w[1], v2->texCoords[i].z * w[2], ctx);
-  }
-
-  // Half-edge constants
-  s32 C1 = DY12 * X1 - DX12 * Y1;
-  s32 C2 = DY23 * X2 - DX23 * Y2;
-  s32 C3 = DY31 * X3 - DX31 * Y3;
-
-  // Correct for fill convention
-  if (DY12 < 0 || (DY12 == 0 && DX12 > 0))
-    C1++;
-  if (DY23 < 0 || (DY23 == 0 && DX23 > 0))
-    C2++;
-  if (DY31 < 0 || (DY31 == 0 && DX31 > 0))
-    C3++;
-
   // Start in corner of 2x2 block
   s32 block_minx = minx & ~(BLOCK_SIZE - 1);
   s32 block_miny = miny & ~(BLOCK_SIZE - 1);
@@ -450,19 +530,22 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
       if (a == 0x0 || b == 0x0 || c == 0x0)
         continue;
 
-      BuildBlock(x, y);
+      BuildBlock(x, y, triangle, context.rasterBlock);
 
       // Accept whole block when totally covered
       // We still need to check min/max x/y because of the scissor
       if (a == 0xF && b == 0xF && c == 0xF && x >= minx && x1_ < maxx && y >= miny && y1_ < maxy)
       {
+        u32 mask = 0;
         for (s32 iy = 0; iy < BLOCK_SIZE; iy++)
         {
           for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
           {
-            Draw(x + ix, y + iy, ix, iy);
+            if (SetupPixel(x + ix, y + iy, ix, iy, triangle, context))
+              mask |= 1u << (ix + iy * BLOCK_SIZE);
           }
         }
+        DrawQuad(mask, context);
       }
       else  // Partially covered block
       {
@@ -470,6 +553,7 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
         s32 CY2 = C2 + DX23 * y0 - DY23 * x0;
         s32 CY3 = C3 + DX31 * y0 - DY31 * x0;
 
+        u32 mask = 0;
         for (s32 iy = 0; iy < BLOCK_SIZE; iy++)
         {
           s32 CX1 = CY1;
@@ -482,8 +566,11 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
             {
               // This check enforces the scissor rectangle, since it might not be aligned with the
               // blocks
-              if (x + ix >= minx && x + ix < maxx && y + iy >= miny && y + iy < maxy)
-                Draw(x + ix, y + iy, ix, iy);
+              if (x + ix >= minx && x + ix < maxx && y + iy >= miny && y + iy < maxy &&
+                  SetupPixel(x + ix, y + iy, ix, iy, triangle, context))
+              {
+                mask |= 1u << (ix + iy * BLOCK_SIZE);
+              }
             }
 
             CX1 -= FDY12;
@@ -495,11 +582,139 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
           CY2 += FDX23;
           CY3 += FDX31;
         }
+        DrawQuad(mask, context);
       }
     }
   }
 }
 
+static void RasterizeTiles(RasterContext& context)
+{
+  for (u32 i = nextTile.fetch_add(1, std::memory_order_relaxed); i < usedTiles.size();
+       i = nextTile.fetch_add(1, std::memory_order_relaxed))
+  {
+    const u32 tile = usedTiles[i];
+    const s32 left = static_cast<s32>(tile % NUM_TILES_X) * TILE_SIZE;
+    const s32 top = static_cast<s32>(tile / NUM_TILES_X) * TILE_SIZE;
+
+    for (const u32 index : tileBins[tile])
+      RasterizeTriangle(triangles[index], left, top, left + TILE_SIZE, top + TILE_SIZE, context);
+  }
+}
+
+static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
+                                  const OutputVertexData* v2,
+                                  const BPFunctions::ScissorRect& scissor)
+{
+  // The zslope should be updated now, even if the triangle is rejected by the scissor test, as
+  // zfreeze depends on it
+  UpdateZSlope(v0, v1, v2, scissor.x_off, scissor.y_off);
+
+  // adapted from http://devmaster.net/posts/6145/advanced-rasterization
+
+  // 28.4 fixed-point coordinates. rounded to nearest and adjusted to match hardware output
+  // could also take floor and adjust -8
+  const s32 Y1 = iround(16.0f * (v0->screenPosition.y - scissor.y_off)) - 9;
+  const s32 Y2 = iround(16.0f * (v1->screenPosition.y - scissor.y_off)) - 9;
+  const s32 Y3 = iround(16.0f * (v2->screenPosition.y - scissor.y_off)) - 9;
+
+  const s32 X1 = iround(16.0f * (v0->screenPosition.x - scissor.x_off)) - 9;
+  const s32 X2 = iround(16.0f * (v1->screenPosition.x - scissor.x_off)) - 9;
+  const s32 X3 = iround(16.0f * (v2->screenPosition.x - scissor.x_off)) - 9;
+
+  // Bounding rectangle
+  s32 minx = (std::min(std::min(X1, X2), X3) + 0xF) >> 4;
+  s32 maxx = (std::max(std::max(X1, X2), X3) + 0xF) >> 4;
+  s32 miny = (std::min(std::min(Y1, Y2), Y3) + 0xF) >> 4;
+  s32 maxy = (std::max(std::max(Y1, Y2), Y3) + 0xF) >> 4;
+
+  // scissor
+  ASSERT(scissor.rect.left >= 0);
+  ASSERT(scissor.rect.right <= static_cast<int>(EFB_WIDTH));
+  ASSERT(scissor.rect.top >= 0);
+  ASSERT(scissor.rect.bottom <= static_cast<int>(EFB_HEIGHT));
+
+  minx = std::max(minx, scissor.rect.left);
+  maxx = std::min(maxx, scissor.rect.right);
+  miny = std::max(miny, scissor.rect.top);
+  maxy = std::min(maxy, scissor.rect.bottom);
+
+  if (minx >= maxx || miny >= maxy)
+    return;
+
+  const bool binning = !workers.empty();
+  Triangle& triangle = binning ? triangles.emplace_back() : serialTriangle;
+
+  triangle.minx = minx;
+  triangle.maxx = maxx;
+  triangle.miny = miny;
+  triangle.maxy = maxy;
+
+  // Deltas
+  triangle.DX12 = X1 - X2;
+  triangle.DX23 = X2 - X3;
+  triangle.DX31 = X3 - X1;
+
+  triangle.DY12 = Y1 - Y2;
+  triangle.DY23 = Y2 - Y3;
+  triangle.DY31 = Y3 - Y1;
+
+  // Set up the remaining slopes
+  const SlopeContext ctx(v0, v1, v2, (X1 + 0xF) >> 4, (Y1 + 0xF) >> 4, scissor.x_off,
+                         scissor.y_off);
+
+  triangle.ZSlope = ZSlope;
+
+  float w[3] = {1.0f / v0->projectedPosition.w, 1.0f / v1->projectedPosition.w,
+                1.0f / v2->projectedPosition.w};
+  triangle.WSlope = Slope(w[0], w[1], w[2], ctx);
+
+  for (unsigned int i = 0; i < bpmem.genMode.numcolchans; i++)
+  {
+    for (int comp = 0; comp < 4; comp++)
+    {
+      triangle.ColorSlopes[i][comp] =
+          Slope(v0->color[i][comp], v1->color[i][comp], v2->color[i][comp], ctx);
+    }
+  }
+
+  for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
+  {
+    triangle.TexSlopes[i][0] =
+        Slope(v0->texCoords[i].x * w[0], v1->texCoords[i].x * w[1], v2->texCoords[i].x * w[2], ctx);
+    triangle.TexSlopes[i][1] =
+        Slope(v0->texCoords[i].y * w[0], v1->texCoords[i].y * w[1], v2->texCoords[i].y * w[2], ctx);
+    triangle.TexSlopes[i][2] =
+        Slope(v0->texCoords[i].z * w[0], v1->texCoords[i].z * w[1], v2->texCoords[i].z * w[2], ctx);
+  }
+
+  // Half-edge constants
+  triangle.C1 = triangle.DY12 * X1 - triangle.DX12 * Y1;
+  triangle.C2 = triangle.DY23 * X2 - triangle.DX23 * Y2;
+  triangle.C3 = triangle.DY31 * X3 - triangle.DX31 * Y3;
+
+  // Correct for fill convention
+  if (triangle.DY12 < 0 || (triangle.DY12 == 0 && triangle.DX12 > 0))
+    triangle.C1++;
+  if (triangle.DY23 < 0 || (triangle.DY23 == 0 && triangle.DX23 > 0))
+    triangle.C2++;
+  if (triangle.DY31 < 0 || (triangle.DY31 == 0 && triangle.DX31 > 0))
+    triangle.C3++;
+
+  if (!binning)
+  {
+    RasterizeTriangle(triangle, 0, 0, EFB_WIDTH, EFB_HEIGHT, *contexts[0]);
+    return;
+  }
+
+  const u32 index = static_cast<u32>(triangles.size() - 1);
+  for (s32 tile_y = miny / TILE_SIZE; tile_y <= (maxy - 1) / TILE_SIZE; tile_y++)
+  {
+    for (s32 tile_x = minx / TILE_SIZE; tile_x <= (maxx - 1) / TILE_SIZE; tile_x++)
+      tileBins[tile_y * NUM_TILES_X + tile_x].push_back(index);
+  }
+}
+
 void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
                            const OutputVertexData* v2)
 {
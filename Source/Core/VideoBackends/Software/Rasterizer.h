@@ -10,6 +10,7 @@ struct OutputVertexData;
 namespace Rasterizer
 {
 void Init();
+void Shutdown();
 void ScissorChanged();
 
 void UpdateZSlope(const OutputVertexData* v0, const OutputVertexData* v1,
@@ -17,7 +18,11 @@ void UpdateZSlope(const OutputVertexData* v0, const OutputVertexData* v1,
 void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
                            const OutputVertexData* v2);
 
-void SetTevKonstColors();
+// Every triangle of a draw must be drawn between BeginDraw() and EndDraw(). With several rasterizer
+// threads, triangles are only binned until EndDraw() rasterizes them, so BP state must not change
+// in between.
+void BeginDraw();
+void EndDraw();
 
 struct RasterBlockPixel
 {
@@ -66,7 +66,7 @@ void SWVertexLoader::DrawCurrentBatch(u32 base_index, u32 num_indices, u32 base_
     g_bounding_box->Flush();
 
   m_setup_unit.Init(primitive_type);
-  Rasterizer::SetTevKonstColors();
+  Rasterizer::BeginDraw();
 
   for (u32 i = 0; i < m_index_generator.GetIndexLen(); i++)
   {
@@ -90,6 +90,8 @@ void SWVertexLoader::DrawCurrentBatch(u32 base_index, u32 num_indices, u32 base_
     INCSTAT(g_stats.this_frame.num_vertices_loaded);
   }
 
+  Rasterizer::EndDraw();
+
   INCSTAT(g_stats.this_frame.num_drawn_objects);
 }
 
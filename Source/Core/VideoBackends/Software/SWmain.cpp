@@ -108,5 +108,7 @@ bool VideoSoftware::Initialize(const WindowSystemInfo& wsi)
 void VideoSoftware::Shutdown()
 {
   ShutdownShared();
+
+  Rasterizer::Shutdown();
 }
 }  // namespace SW
@@ -4,6 +4,7 @@
 #include "VideoBackends/Software/Tev.h"
 
 #include <algorithm>
+#include <bit>
 #include <cmath>
 #include <cstring>
 
@@ -31,39 +32,42 @@ static inline s16 Clamp1024(s16 in)
   return std::clamp<s16>(in, -1024, 1023);
 }
 
-void Tev::SetRasColor(RasColorChan colorChan, u32 swaptable)
+void Tev::SetRasColor(u32 pixel, RasColorChan colorChan, u32 swaptable)
 {
+  s16* const ras = &RasColor[pixel * TevCombiner::NUM_CHANNELS];
+
   switch (colorChan)
   {
   case RasColorChan::Color0:
   {
-    const u8* color = Color[0];
+    const u8* color = Pixels[pixel].Color[0];
     const auto& swap = bpmem.tevksel.GetSwapTable(swaptable);
-    RasColor.r = color[u32(swap[ColorChannel::Red])];
-    RasColor.g = color[u32(swap[ColorChannel::Green])];
-    RasColor.b = color[u32(swap[ColorChannel::Blue])];
-    RasColor.a = color[u32(swap[ColorChannel::Alpha])];
+    ras[RED_C] = color[u32(swap[ColorChannel::Red])];
+    ras[GRN_C] = color[u32(swap[ColorChannel::Green])];
+    ras[BLU_C] = color[u32(swap[ColorChannel::Blue])];
+    ras[ALP_C] = color[u32(swap[ColorChannel::Alpha])];
   }
   break;
   case RasColorChan::Color1:
   {
-    const u8* color = Color[1];
+    const u8* color = Pixels[pixel].Color[1];
     const auto& swap = bpmem.tevksel.GetSwapTable(swaptable);
-    RasColor.r = color[u32(swap[ColorChannel::Red])];
-    RasColor.g = color[u32(swap[ColorChannel::Green])];
-    RasColor.b = color[u32(swap[ColorChannel::Blue])];
-    RasColor.a = color[u32(swap[ColorChannel::Alpha])];
+    ras[RED_C] = color[u32(swap[ColorChannel::Red])];
+    ras[GRN_C] = color[u32(swap[ColorChannel::Green])];
+    ras[BLU_C] = color[u32(swap[ColorChannel::Blue])];
+    ras[ALP_C] = color[u32(swap[ColorChannel::Alpha])];
   }
   break;
   case RasColorChan::AlphaBump:
   {
-    RasColor = TevColor::All(AlphaBump);
+    std::fill_n(ras, TevCombiner::NUM_CHANNELS, PixelStates[pixel].AlphaBump);
   }
   break;
   case RasColorChan::NormalizedAlphaBump:
   {
-    const u8 normalized = AlphaBump | AlphaBump >> 5;
-    RasColor = TevColor::All(normalized);
+    const u8 alphaBump = PixelStates[pixel].AlphaBump;
+    const u8 normalized = alphaBump | alphaBump >> 5;
+    std::fill_n(ras, TevCombiner::NUM_CHANNELS, normalized);
   }
   break;
   default:
@@ -71,37 +75,24 @@ void Tev::SetRasColor(RasColorChan colorChan, u32 swaptable)
     if (colorChan != RasColorChan::Zero)
       PanicAlertFmt("Invalid ras color channel: {}", colorChan);
 
-    RasColor = TevColor::All(0);
+    std::fill_n(ras, TevCombiner::NUM_CHANNELS, 0);
   }
   break;
   }
 }
 
-void Tev::DrawColorRegular(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4])
+static s16 ClampResult(s32 result, bool clamp)
 {
-  for (int i = BLU_C; i <= RED_C; i++)
-  {
-    const InputRegType& InputReg = inputs[i];
-
-    const u16 c = InputReg.c + (InputReg.c >> 7);
-
-    s32 temp = InputReg.a * (256 - c) + (InputReg.b * c);
-    temp <<= s_ScaleLShiftLUT[cc.scale];
-    temp += (cc.scale == TevScale::Divide2) ? 0 : (cc.op == TevOp::Sub) ? 127 : 128;
-    temp >>= 8;
-    temp = cc.op == TevOp::Sub ? -temp : temp;
-
-    s32 result = ((InputReg.d + s_BiasLUT[cc.bias]) << s_ScaleLShiftLUT[cc.scale]) + temp;
-    result = result >> s_ScaleRShiftLUT[cc.scale];
-
-    Reg[cc.dest][i] = result;
-  }
+  return clamp ? Clamp255(static_cast<s16>(result)) : Clamp1024(static_cast<s16>(result));
 }
 
-void Tev::DrawColorCompare(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4])
+void Tev::DrawColorCompare(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4],
+                           u32 pixel, Lanes& result)
 {
   for (int i = BLU_C; i <= RED_C; i++)
   {
+    const u32 lane = pixel * TevCombiner::NUM_CHANNELS + i;
+
     u32 a, b;
     switch (cc.compare_mode)
     {
@@ -127,35 +118,22 @@ void Tev::DrawColorCompare(const TevStageCombiner::ColorCombiner& cc, const Inpu
 
     default:
       PanicAlertFmt("Invalid compare mode {}", cc.compare_mode);
+      result[lane] = ClampResult(Reg[cc.dest][lane], cc.clamp);
       continue;
     }
 
     if (cc.comparison == TevComparison::GT)
-      Reg[cc.dest][i] = inputs[i].d + ((a > b) ? inputs[i].c : 0);
+      result[lane] = ClampResult(inputs[i].d + ((a > b) ? inputs[i].c : 0), cc.clamp);
     else
-      Reg[cc.dest][i] = inputs[i].d + ((a == b) ? inputs[i].c : 0);
+      result[lane] = ClampResult(inputs[i].d + ((a == b) ? inputs[i].c : 0), cc.clamp);
   }
 }
 
-void Tev::DrawAlphaRegular(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4])
+void Tev::DrawAlphaCompare(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4],
+                           u32 pixel, Lanes& result)
 {
-  const InputRegType& InputReg = inputs[ALP_C];
-
-  const u16 c = InputReg.c + (InputReg.c >> 7);
+  const u32 lane = pixel * TevCombiner::NUM_CHANNELS + ALP_C;
 
-  s32 temp = InputReg.a * (256 - c) + (InputReg.b * c);
-  temp <<= s_ScaleLShiftLUT[ac.scale];
-  temp += (ac.scale == TevScale::Divide2) ? 0 : (ac.op == TevOp::Sub) ? 127 : 128;
-  temp = ac.op == TevOp::Sub ? (-temp >> 8) : (temp >> 8);
-
-  s32 result = ((InputReg.d + s_BiasLUT[ac.bias]) << s_ScaleLShiftLUT[ac.scale]) + temp;
-  result = result >> s_ScaleRShiftLUT[ac.scale];
-
-  Reg[ac.dest].a = result;
-}
-
-void Tev::DrawAlphaCompare(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4])
-{
   u32 a, b;
   switch (ac.compare_mode)
   {
@@ -181,13 +159,14 @@ void Tev::DrawAlphaCompare(const TevStageCombiner::AlphaCombiner& ac, const Inpu
 
   default:
     PanicAlertFmt("Invalid compare mode {}", ac.compare_mode);
+    result[lane] = ClampResult(Reg[ac.dest][lane], ac.clamp);
     return;
   }
 
   if (ac.comparison == TevComparison::GT)
-    Reg[ac.dest].a = inputs[ALP_C].d + ((a > b) ? inputs[ALP_C].c : 0);
+    result[lane] = ClampResult(inputs[ALP_C].d + ((a > b) ? inputs[ALP_C].c : 0), ac.clamp);
   else
-    Reg[ac.dest].a = inputs[ALP_C].d + ((a == b) ? inputs[ALP_C].c : 0);
+    result[lane] = ClampResult(inputs[ALP_C].d + ((a == b) ? inputs[ALP_C].c : 0), ac.clamp);
 }
 
 static bool AlphaCompare(int alpha, int ref, CompareMode comp)
@@ -261,10 +240,10 @@ static inline s32 WrapIndirectCoord(s32 coord, IndTexWrap wrapMode)
   }
 }
 
-void Tev::Indirect(unsigned int stageNum, s32 s, s32 t)
+void Tev::Indirect(unsigned int stageNum, s32 s, s32 t, PixelState& state)
 {
   const TevStageIndirect& indirect = bpmem.tevind[stageNum];
-  const u8* indmap = IndirectTex[indirect.bt];
+  const u8* indmap = state.IndirectTex[indirect.bt];
 
   s32 indcoord[3];
 
@@ -272,16 +251,16 @@ void Tev::Indirect(unsigned int stageNum, s32 s, s32 t)
   switch (indirect.bs)
   {
   case IndTexBumpAlpha::Off:
-    AlphaBump = 0;
+    state.AlphaBump = 0;
     break;
   case IndTexBumpAlpha::S:
-    AlphaBump = indmap[TextureSampler::ALP_SMP];
+    state.AlphaBump = indmap[TextureSampler::ALP_SMP];
     break;
   case IndTexBumpAlpha::T:
-    AlphaBump = indmap[TextureSampler::BLU_SMP];
+    state.AlphaBump = indmap[TextureSampler::BLU_SMP];
     break;
   case IndTexBumpAlpha::U:
-    AlphaBump = indmap[TextureSampler::GRN_SMP];
+    state.AlphaBump = indmap[TextureSampler::GRN_SMP];
     break;
   default:
     PanicAlertFmt("Invalid alpha bump {}", indirect.bs);
@@ -302,25 +281,25 @@ void Tev::Indirect(unsigned int stageNum, s32 s, s32 t)
     indcoord[0] = indmap[TextureSampler::ALP_SMP] + bias[0];
     indcoord[1] = indmap[TextureSampler::BLU_SMP] + bias[1];
     indcoord[2] = indmap[TextureSampler::GRN_SMP] + bias[2];
-    AlphaBump = AlphaBump & 0xf8;
+    state.AlphaBump = state.AlphaBump & 0xf8;
     break;
   case IndTexFormat::ITF_5:
     indcoord[0] = (indmap[TextureSampler::ALP_SMP] >> 3) + bias[0];
     indcoord[1] = (indmap[TextureSampler::BLU_SMP] >> 3) + bias[1];
     indcoord[2] = (indmap[TextureSampler::GRN_SMP] >> 3) + bias[2];
-    AlphaBump = AlphaBump << 5;
+    state.AlphaBump = state.AlphaBump << 5;
     break;
   case IndTexFormat::ITF_4:
     indcoord[0] = (indmap[TextureSampler::ALP_SMP] >> 4) + bias[0];
     indcoord[1] = (indmap[TextureSampler::BLU_SMP] >> 4) + bias[1];
     indcoord[2] = (indmap[TextureSampler::GRN_SMP] >> 4) + bias[2];
-    AlphaBump = AlphaBump << 4;
+    state.AlphaBump = state.AlphaBump << 4;
     break;
   case IndTexFormat::ITF_3:
     indcoord[0] = (indmap[TextureSampler::ALP_SMP] >> 5) + bias[0];
     indcoord[1] = (indmap[TextureSampler::BLU_SMP] >> 5) + bias[1];
     indcoord[2] = (indmap[TextureSampler::GRN_SMP] >> 5) + bias[2];
-    AlphaBump = AlphaBump << 3;
+    state.AlphaBump = state.AlphaBump << 3;
     break;
   default:
     PanicAlertFmt("Invalid indirect format {}", indirect.fmt);
@@ -374,34 +353,32 @@ void Tev::Indirect(unsigned int stageNum, s32 s, s32 t)
 
   if (indirect.fb_addprev)
   {
-    TexCoord.s += (int)(WrapIndirectCoord(s, indirect.sw) + indtevtrans[0]);
-    TexCoord.t += (int)(WrapIndirectCoord(t, indirect.tw) + indtevtrans[1]);
+    state.TexCoord.s += (int)(WrapIndirectCoord(s, indirect.sw) + indtevtrans[0]);
+    state.TexCoord.t += (int)(WrapIndirectCoord(t, indirect.tw) + indtevtrans[1]);
   }
   else
   {
-    TexCoord.s = (int)(WrapIndirectCoord(s, indirect.sw) + indtevtrans[0]);
-    TexCoord.t = (int)(WrapIndirectCoord(t, indirect.tw) + indtevtrans[1]);
+    state.TexCoord.s = (int)(WrapIndirectCoord(s, indirect.sw) + indtevtrans[0]);
+    state.TexCoord.t = (int)(WrapIndirectCoord(t, indirect.tw) + indtevtrans[1]);
   }
 }
 
-void Tev::Draw()
+void Tev::GatherInputs(const TevColorRef& color, const TevAlphaRef& alpha, Lanes& out)
 {
-  ASSERT(Position[0] >= 0 && Position[0] < s32(EFB_WIDTH));
-  ASSERT(Position[1] >= 0 && Position[1] < s32(EFB_HEIGHT));
-
-  INCSTAT(g_stats.this_frame.tev_pixels_in);
+  for (u32 base = 0; base < TevCombiner::NUM_LANES; base += TevCombiner::NUM_CHANNELS)
+  {
+    for (int i = BLU_C; i <= RED_C; i++)
+      out[base + i] = color.lanes[base + (color.alpha ? ALP_C : i)];
+    out[base + ALP_C] = alpha.lanes[base + ALP_C];
+  }
+}
 
-  auto& system = Core::System::GetInstance();
-  auto& pixel_shader_manager = system.GetPixelShaderManager();
+void Tev::Draw(u32 mask)
+{
+  counters.tev_pixels_in += std::popcount(mask);
 
   // initial color values
-  for (int i = 0; i < 4; i++)
-  {
-    Reg[static_cast<TevOutput>(i)].r = pixel_shader_manager.constants.colors[i][0];
-    Reg[static_cast<TevOutput>(i)].g = pixel_shader_manager.constants.colors[i][1];
-    Reg[static_cast<TevOutput>(i)].b = pixel_shader_manager.constants.colors[i][2];
-    Reg[static_cast<TevOutput>(i)].a = pixel_shader_manager.constants.colors[i][3];
-  }
+  Reg = m_InitialReg;
 
   for (unsigned int stageNum = 0; stageNum < bpmem.genMode.numindstages; stageNum++)
   {
@@ -422,9 +399,16 @@ void Tev::Draw()
     const s32 scaleS = stageOdd ? texscale.ss1 : texscale.ss0;
     const s32 scaleT = stageOdd ? texscale.ts1 : texscale.ts0;
 
-    TextureSampler::Sample(Uv[texcoordSel].s >> scaleS, Uv[texcoordSel].t >> scaleT,
-                           IndirectLod[stageNum], IndirectLinear[stageNum], texmap,
-                           IndirectTex[stageNum]);
+    for (u32 pixel = 0; pixel < QUAD_SIZE; pixel++)
+    {
+      if ((mask & (1u << pixel)) == 0)
+        continue;
+
+      const TextureCoordinateType& uv = Pixels[pixel].Uv[texcoordSel];
+      TextureSampler::Sample(uv.s >> scaleS, uv.t >> scaleT, IndirectLod[stageNum],
+                             IndirectLinear[stageNum], texmap,
+                             PixelStates[pixel].IndirectTex[stageNum]);
+    }
   }
 
   for (unsigned int stageNum = 0; stageNum <= bpmem.genMode.numtevstages; stageNum++)
@@ -445,104 +429,121 @@ void Tev::Draw()
     if (texcoordSel >= bpmem.genMode.numtexgens)
       texcoordSel = 0;
 
-    Indirect(stageNum, Uv[texcoordSel].s, Uv[texcoordSel].t);
-
-    // sample texture
-    if (order.getEnable(stageOdd))
+    for (u32 pixel = 0; pixel < QUAD_SIZE; pixel++)
     {
-      // RGBA
-      u8 texel[4];
+      if ((mask & (1u << pixel)) == 0)
+        continue;
 
-      if (bpmem.genMode.numtexgens > 0)
-      {
-        TextureSampler::Sample(TexCoord.s, TexCoord.t, TextureLod[stageNum],
-                               TextureLinear[stageNum], texmap, texel);
-      }
-      else
+      PixelState& state = PixelStates[pixel];
+      const TextureCoordinateType& uv = Pixels[pixel].Uv[texcoordSel];
+      Indirect(stageNum, uv.s, uv.t, state);
+
+      // sample texture
+      if (order.getEnable(stageOdd))
       {
-        // It seems like the result is always black when no tex coords are enabled, but further
-        // hardware testing is needed.
-        std::memset(texel, 0, 4);
+        // RGBA
+        u8 texel[4];
+
+        if (bpmem.genMode.numtexgens > 0)
+        {
+          TextureSampler::Sample(state.TexCoord.s, state.TexCoord.t, TextureLod[stageNum],
+                                 TextureLinear[stageNum], texmap, texel);
+        }
+        else
+        {
+          // It seems like the result is always black when no tex coords are enabled, but further
+          // hardware testing is needed.
+          std::memset(texel, 0, 4);
+        }
+
+        state.RawTexColor.r = texel[u32(ColorChannel::Red)];
+        state.RawTexColor.g = texel[u32(ColorChannel::Green)];
+        state.RawTexColor.b = texel[u32(ColorChannel::Blue)];
+        state.RawTexColor.a = texel[u32(ColorChannel::Alpha)];
+
+        const auto& swap = bpmem.tevksel.GetSwapTable(ac.tswap);
+        s16* const tex = &TexColor[pixel * TevCombiner::NUM_CHANNELS];
+        tex[RED_C] = texel[u32(swap[ColorChannel::Red])];
+        tex[GRN_C] = texel[u32(swap[ColorChannel::Green])];
+        tex[BLU_C] = texel[u32(swap[ColorChannel::Blue])];
+        tex[ALP_C] = texel[u32(swap[ColorChannel::Alpha])];
       }
 
-      RawTexColor.r = texel[u32(ColorChannel::Red)];
-      RawTexColor.g = texel[u32(ColorChannel::Green)];
-      RawTexColor.b = texel[u32(ColorChannel::Blue)];
-      RawTexColor.a = texel[u32(ColorChannel::Alpha)];
-
-      const auto& swap = bpmem.tevksel.GetSwapTable(ac.tswap);
-      TexColor.r = texel[u32(swap[ColorChannel::Red])];
-      TexColor.g = texel[u32(swap[ColorChannel::Green])];
-      TexColor.b = texel[u32(swap[ColorChannel::Blue])];
-      TexColor.a = texel[u32(swap[ColorChannel::Alpha])];
+      // set color
+      SetRasColor(pixel, order.getColorChan(stageOdd), ac.rswap);
     }
 
     // set konst for this stage
-    const auto kc = bpmem.tevksel.GetKonstColor(stageNum);
-    const auto ka = bpmem.tevksel.GetKonstAlpha(stageNum);
-    StageKonst.r = m_KonstLUT[kc].r;
-    StageKonst.g = m_KonstLUT[kc].g;
-    StageKonst.b = m_KonstLUT[kc].b;
-    StageKonst.a = m_KonstLUT[ka].a;
-
-    // set color
-    SetRasColor(order.getColorChan(stageOdd), ac.rswap);
+    StageKonst = m_StageKonst[stageNum];
 
     // combine inputs
-    InputRegType inputs[4];
-    inputs[BLU_C].a = m_ColorInputLUT[cc.a].b;
-    inputs[BLU_C].b = m_ColorInputLUT[cc.b].b;
-    inputs[BLU_C].c = m_ColorInputLUT[cc.c].b;
-    inputs[BLU_C].d = m_ColorInputLUT[cc.d].b;
-    inputs[GRN_C].a = m_ColorInputLUT[cc.a].g;
-    inputs[GRN_C].b = m_ColorInputLUT[cc.b].g;
-    inputs[GRN_C].c = m_ColorInputLUT[cc.c].g;
-    inputs[GRN_C].d = m_ColorInputLUT[cc.d].g;
-    inputs[RED_C].a = m_ColorInputLUT[cc.a].r;
-    inputs[RED_C].b = m_ColorInputLUT[cc.b].r;
-    inputs[RED_C].c = m_ColorInputLUT[cc.c].r;
-    inputs[RED_C].d = m_ColorInputLUT[cc.d].r;
-    inputs[ALP_C].a = m_AlphaInputLUT[ac.a].a;
-    inputs[ALP_C].b = m_AlphaInputLUT[ac.b].a;
-    inputs[ALP_C].c = m_AlphaInputLUT[ac.c].a;
-    inputs[ALP_C].d = m_AlphaInputLUT[ac.d].a;
-
-    if (cc.bias != TevBias::Compare)
-      DrawColorRegular(cc, inputs);
-    else
-      DrawColorCompare(cc, inputs);
+    TevCombiner::Inputs inputs;
+    GatherInputs(m_ColorInputLUT[cc.a], m_AlphaInputLUT[ac.a], inputs.a);
+    GatherInputs(m_ColorInputLUT[cc.b], m_AlphaInputLUT[ac.b], inputs.b);
+    GatherInputs(m_ColorInputLUT[cc.c], m_AlphaInputLUT[ac.c], inputs.c);
+    GatherInputs(m_ColorInputLUT[cc.d], m_AlphaInputLUT[ac.d], inputs.d);
+
+    Lanes result;
+    m_Combine(inputs, m_CombinerParams[stageNum], result);
 
-    if (cc.clamp)
+    // Comparisons mix the channels of a pixel, so they aren't vectorized.
+    if (cc.bias == TevBias::Compare || ac.bias == TevBias::Compare)
     {
-      Reg[cc.dest].r = Clamp255(Reg[cc.dest].r);
-      Reg[cc.dest].g = Clamp255(Reg[cc.dest].g);
-      Reg[cc.dest].b = Clamp255(Reg[cc.dest].b);
+      for (u32 pixel = 0; pixel < QUAD_SIZE; pixel++)
+      {
+        if ((mask & (1u << pixel)) == 0)
+          continue;
+
+        InputRegType regs[4];
+        for (int i = ALP_C; i <= RED_C; i++)
+        {
+          const u32 lane = pixel * TevCombiner::NUM_CHANNELS + i;
+          regs[i].a = inputs.a[lane];
+          regs[i].b = inputs.b[lane];
+          regs[i].c = inputs.c[lane];
+          regs[i].d = inputs.d[lane];
+        }
+
+        if (cc.bias == TevBias::Compare)
+          DrawColorCompare(cc, regs, pixel, result);
+        if (ac.bias == TevBias::Compare)
+          DrawAlphaCompare(ac, regs, pixel, result);
+      }
     }
-    else
+
+    Lanes& colorDest = Reg[cc.dest];
+    Lanes& alphaDest = Reg[ac.dest];
+    for (u32 base = 0; base < TevCombiner::NUM_LANES; base += TevCombiner::NUM_CHANNELS)
     {
-      Reg[cc.dest].r = Clamp1024(Reg[cc.dest].r);
-      Reg[cc.dest].g = Clamp1024(Reg[cc.dest].g);
-      Reg[cc.dest].b = Clamp1024(Reg[cc.dest].b);
+      for (int i = BLU_C; i <= RED_C; i++)
+        colorDest[base + i] = result[base + i];
+      alphaDest[base + ALP_C] = result[base + ALP_C];
     }
+  }
 
-    if (ac.bias != TevBias::Compare)
-      DrawAlphaRegular(ac, inputs);
-    else
-      DrawAlphaCompare(ac, inputs);
-
-    if (ac.clamp)
-      Reg[ac.dest].a = Clamp255(Reg[ac.dest].a);
-    else
-      Reg[ac.dest].a = Clamp1024(Reg[ac.dest].a);
+  for (u32 pixel = 0; pixel < QUAD_SIZE; pixel++)
+  {
+    if ((mask & (1u << pixel)) != 0)
+      DrawPixel(pixel);
   }
+}
+
+void Tev::DrawPixel(u32 pixel)
+{
+  s32(&Position)[3] = Pixels[pixel].Position;
+  TevColor& RawTexColor = PixelStates[pixel].RawTexColor;
+  const u32 base = pixel * TevCombiner::NUM_CHANNELS;
+
+  ASSERT(Position[0] >= 0 && Position[0] < s32(EFB_WIDTH));
+  ASSERT(Position[1] >= 0 && Position[1] < s32(EFB_HEIGHT));
 
   // convert to 8 bits per component
   // the results of the last tev stage are put onto the screen,
   // regardless of the used destination register - TODO: Verify!
   const auto& color_index = bpmem.combiners[bpmem.genMode.numtevstages].colorC.dest;
   const auto& alpha_index = bpmem.combiners[bpmem.genMode.numtevstages].alphaC.dest;
-  u8 output[4] = {(u8)Reg[alpha_index].a, (u8)Reg[color_index].b, (u8)Reg[color_index].g,
-                  (u8)Reg[color_index].r};
+  u8 output[4] = {(u8)Reg[alpha_index][base + ALP_C], (u8)Reg[color_index][base + BLU_C],
+                  (u8)Reg[color_index][base + GRN_C], (u8)Reg[color_index][base + RED_C]};
 
   if (!TevAlphaTest(output[ALP_C]))
     return;
@@ -663,30 +664,34 @@ void Tev::Draw()
   if (bpmem.GetEmulatedZ() == EmulatedZ::Late)
   {
     // TODO: Check against hw if these values get incremented even if depth testing is disabled
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_INPUT);
+    ++counters.perf_pixels[PQ_ZCOMP_INPUT];
 
     if (!EfbInterface::ZCompare(Position[0], Position[1], Position[2]))
       return;
 
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_OUTPUT);
+    ++counters.perf_pixels[PQ_ZCOMP_OUTPUT];
   }
 
   // The GC/Wii GPU rasterizes in 2x2 pixel groups, so bounding box values will be rounded to the
   // extents of these groups, rather than the exact pixel.
-  BBoxManager::Update(static_cast<u16>(Position[0] & ~1), static_cast<u16>(Position[0] | 1),
-                      static_cast<u16>(Position[1] & ~1), static_cast<u16>(Position[1] | 1));
+  counters.bbox_left = std::min(counters.bbox_left, static_cast<u16>(Position[0] & ~1));
+  counters.bbox_right = std::max(counters.bbox_right, static_cast<u16>(Position[0] | 1));
+  counters.bbox_top = std::min(counters.bbox_top, static_cast<u16>(Position[1] & ~1));
+  counters.bbox_bottom = std::max(counters.bbox_bottom, static_cast<u16>(Position[1] | 1));
 
-  INCSTAT(g_stats.this_frame.tev_pixels_out);
-  EfbInterface::IncPerfCounterQuadCount(PQ_BLEND_INPUT);
+  ++counters.tev_pixels_out;
+  ++counters.perf_pixels[PQ_BLEND_INPUT];
 
   EfbInterface::BlendTev(Position[0], Position[1], output);
 }
 
-void Tev::SetKonstColors()
+void Tev::BeginDraw(TevCombiner::CombineFunction combine)
 {
   auto& system = Core::System::GetInstance();
   auto& pixel_shader_manager = system.GetPixelShaderManager();
 
+  m_Combine = combine;
+
   for (int i = 0; i < 4; i++)
   {
     KonstantColors[i].r = pixel_shader_manager.constants.kcolors[i][0];
@@ -694,4 +699,56 @@ void Tev::SetKonstColors()
     KonstantColors[i].b = pixel_shader_manager.constants.kcolors[i][2];
     KonstantColors[i].a = pixel_shader_manager.constants.kcolors[i][3];
   }
+
+  for (u32 base = 0; base < TevCombiner::NUM_LANES; base += TevCombiner::NUM_CHANNELS)
+  {
+    for (int i = 0; i < 4; i++)
+    {
+      Lanes& reg = m_InitialReg[static_cast<TevOutput>(i)];
+      reg[base + RED_C] = pixel_shader_manager.constants.colors[i][0];
+      reg[base + GRN_C] = pixel_shader_manager.constants.colors[i][1];
+      reg[base + BLU_C] = pixel_shader_manager.constants.colors[i][2];
+      reg[base + ALP_C] = pixel_shader_manager.constants.colors[i][3];
+    }
+  }
+
+  for (u32 stageNum = 0; stageNum < m_CombinerParams.size(); stageNum++)
+  {
+    const auto kc = bpmem.tevksel.GetKonstColor(stageNum);
+    const auto ka = bpmem.tevksel.GetKonstAlpha(stageNum);
+    Lanes& konst = m_StageKonst[stageNum];
+    for (u32 base = 0; base < TevCombiner::NUM_LANES; base += TevCombiner::NUM_CHANNELS)
+    {
+      konst[base + RED_C] = m_KonstLUT[kc].r;
+      konst[base + GRN_C] = m_KonstLUT[kc].g;
+      konst[base + BLU_C] = m_KonstLUT[kc].b;
+      konst[base + ALP_C] = m_KonstLUT[ka].a;
+    }
+
+    m_CombinerParams[stageNum] = TevCombiner::MakeParams(bpmem.combiners[stageNum].colorC,
+                                                         bpmem.combiners[stageNum].alphaC);
+  }
+}
+
+void Tev::FlushCounters()
+{
+  ADDSTAT(g_stats.this_frame.rasterized_pixels, counters.rasterized_pixels);
+  ADDSTAT(g_stats.this_frame.tev_pixels_in, counters.tev_pixels_in);
+  ADDSTAT(g_stats.this_frame.tev_pixels_out, counters.tev_pixels_out);
+
+  for (u32 i = 0; i < PQ_NUM_MEMBERS; i++)
+  {
+    if (counters.perf_pixels[i] != 0)
+      EfbInterface::IncPerfCounterQuadCount(static_cast<PerfQueryType>(i), counters.perf_pixels[i]);
+  }
+
+  // Bounding box updates only take the minimum and maximum, so merging them in one go gives the
+  // same result as updating once per pixel.
+  if (counters.tev_pixels_out != 0)
+  {
+    BBoxManager::Update(counters.bbox_left, counters.bbox_right, counters.bbox_top,
+                        counters.bbox_bottom);
+  }
+
+  counters = {};
 }
@@ -5,11 +5,16 @@
 
 #include <array>
 
+#include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
+#include "VideoBackends/Software/TevCombiner.h"
 #include "VideoCommon/BPMemory.h"
+#include "VideoCommon/PerfQueryBase.h"
 
 class Tev
 {
+  using Lanes = TevCombiner::Lanes;
+
   struct TevColor
   {
     constexpr TevColor() = default;
@@ -41,31 +46,25 @@ class Tev
     }
   };
 
+  // The rgb or the alpha channel of a register, for all pixels of the quad.
   struct TevColorRef
   {
-    constexpr explicit TevColorRef(const s16& r_, const s16& g_, const s16& b_)
-        : r(r_), g(g_), b(b_)
+    constexpr explicit TevColorRef(const Lanes& lanes_, bool alpha_) : lanes(lanes_), alpha(alpha_)
     {
     }
 
-    const s16& r;
-    const s16& g;
-    const s16& b;
+    const Lanes& lanes;
+    bool alpha;
 
-    constexpr static TevColorRef Color(const TevColor& color)
-    {
-      return TevColorRef(color.r, color.g, color.b);
-    }
-    constexpr static TevColorRef All(const s16& value) { return TevColorRef(value, value, value); }
-    constexpr static TevColorRef Alpha(const TevColor& color) { return All(color.a); }
+    constexpr static TevColorRef Color(const Lanes& lanes) { return TevColorRef(lanes, false); }
+    constexpr static TevColorRef Alpha(const Lanes& lanes) { return TevColorRef(lanes, true); }
   };
 
   struct TevAlphaRef
   {
-    constexpr explicit TevAlphaRef(const TevColor& color) : a(color.a) {}
-    constexpr explicit TevAlphaRef(const s16& a_) : a(a_) {}
+    constexpr explicit TevAlphaRef(const Lanes& lanes_) : lanes(lanes_) {}
 
-    const s16& a;
+    const Lanes& lanes;
   };
 
   struct TevKonstRef
@@ -98,19 +97,36 @@ class Tev
     signed d : 11;
   };
 
+public:
   struct TextureCoordinateType
   {
     signed s : 24;
     signed t : 24;
   };
 
-  // color order: ABGR
-  Common::EnumMap<TevColor, TevOutput::Color2> Reg;
+private:
+  // State of one pixel of the quad which isn't handled by the combiners.
+  struct PixelState
+  {
+    TevColor RawTexColor;
+    u8 AlphaBump = 0;
+    u8 IndirectTex[4][4]{};
+    TextureCoordinateType TexCoord{};
+  };
+
+  // color order: ABGR, see TevCombiner for the layout of the pixels
+  Common::EnumMap<Lanes, TevOutput::Color2> Reg{};
   std::array<TevColor, 4> KonstantColors;
-  TevColor RawTexColor;
-  TevColor TexColor;
-  TevColor RasColor;
-  TevColor StageKonst;
+  Lanes TexColor{};
+  Lanes RasColor{};
+  Lanes StageKonst{};
+  std::array<PixelState, TevCombiner::NUM_PIXELS> PixelStates;
+
+  // State which is constant for a whole draw, set up in BeginDraw()
+  TevCombiner::CombineFunction m_Combine = nullptr;
+  Common::EnumMap<Lanes, TevOutput::Color2> m_InitialReg{};
+  std::array<Lanes, 16> m_StageKonst{};
+  std::array<TevCombiner::Params, 16> m_CombinerParams{};
 
   // Fixed constants, corresponding to KonstSel
   static constexpr s16 V0 = 0;
@@ -123,9 +139,9 @@ class Tev
   static constexpr s16 V7_8 = 223;
   static constexpr s16 V1 = 255;
 
-  u8 AlphaBump = 0;
-  u8 IndirectTex[4][4]{};
-  TextureCoordinateType TexCoord{};
+  static constexpr Lanes LanesV0 = Lanes::All(V0);
+  static constexpr Lanes LanesV1_2 = Lanes::All(V1_2);
+  static constexpr Lanes LanesV1 = Lanes::All(V1);
 
   const Common::EnumMap<TevColorRef, TevColorArg::Zero> m_ColorInputLUT{
       TevColorRef::Color(Reg[TevOutput::Prev]),    // prev.rgb
@@ -140,10 +156,10 @@ class Tev
       TevColorRef::Alpha(TexColor),                // tex.aaa
       TevColorRef::Color(RasColor),                // ras.rgb
       TevColorRef::Alpha(RasColor),                // ras.aaa
-      TevColorRef::All(V1),                        // one
-      TevColorRef::All(V1_2),                      // half
+      TevColorRef::Color(LanesV1),                 // one
+      TevColorRef::Color(LanesV1_2),               // half
       TevColorRef::Color(StageKonst),              // konst
-      TevColorRef::All(V0),                        // zero
+      TevColorRef::Color(LanesV0),                 // zero
   };
   const Common::EnumMap<TevAlphaRef, TevAlphaArg::Zero> m_AlphaInputLUT{
       TevAlphaRef(Reg[TevOutput::Prev]),    // prev
@@ -153,7 +169,7 @@ class Tev
       TevAlphaRef(TexColor),                // tex
       TevAlphaRef(RasColor),                // ras
       TevAlphaRef(StageKonst),              // konst
-      TevAlphaRef(V0),                      // zero
+      TevAlphaRef(LanesV0),                 // zero
   };
   const Common::EnumMap<TevKonstRef, KonstSel::K3_A> m_KonstLUT{
       TevKonstRef::Value(V1),    // 1
@@ -193,10 +209,6 @@ class Tev
       TevKonstRef::Value(KonstantColors[2].a),  // Konst 2 Alpha
       TevKonstRef::Value(KonstantColors[3].a),  // Konst 3 Alpha
   };
-  static constexpr Common::EnumMap<s16, TevBias::Compare> s_BiasLUT{0, 128, -128, 0};
-  static constexpr Common::EnumMap<u8, TevScale::Divide2> s_ScaleLShiftLUT{0, 1, 2, 0};
-  static constexpr Common::EnumMap<u8, TevScale::Divide2> s_ScaleRShiftLUT{0, 0, 0, 1};
-
   enum BufferBase
   {
     DIRECT = 0,
@@ -204,19 +216,32 @@ class Tev
     INDIRECT = 32
   };
 
-  void SetRasColor(RasColorChan colorChan, u32 swaptable);
+  void SetRasColor(u32 pixel, RasColorChan colorChan, u32 swaptable);
+
+  void DrawColorCompare(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4],
+                        u32 pixel, Lanes& result);
+  void DrawAlphaCompare(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4],
+                        u32 pixel, Lanes& result);
 
-  void DrawColorRegular(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4]);
-  void DrawColorCompare(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4]);
-  void DrawAlphaRegular(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4]);
-  void DrawAlphaCompare(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4]);
+  void Indirect(unsigned int stageNum, s32 s, s32 t, PixelState& state);
 
-  void Indirect(unsigned int stageNum, s32 s, s32 t);
+  static void GatherInputs(const TevColorRef& color, const TevAlphaRef& alpha, Lanes& out);
+
+  void DrawPixel(u32 pixel);
 
 public:
-  s32 Position[3]{};
-  u8 Color[2][4]{};  // must be RGBA for correct swap table ordering
-  TextureCoordinateType Uv[8]{};
+  static constexpr u32 QUAD_SIZE = TevCombiner::NUM_PIXELS;
+
+  // The inputs of one pixel of the quad. Pixels are numbered x + y * 2 within the quad.
+  struct Pixel
+  {
+    s32 Position[3]{};
+    u8 Color[2][4]{};  // must be RGBA for correct swap table ordering
+    TextureCoordinateType Uv[8]{};
+  };
+  std::array<Pixel, QUAD_SIZE> Pixels;
+
+  // The level of detail is computed per quad.
   s32 IndirectLod[4]{};
   bool IndirectLinear[4]{};
   s32 TextureLod[16]{};
@@ -230,6 +255,24 @@ public:
     RED_C
   };
 
-  void SetKonstColors();
-  void Draw();
+  // Statistics of the pixels drawn with this Tev. The rasterizer may draw with one Tev per thread,
+  // so these are gathered here instead of in the global counters until FlushCounters() is called.
+  struct Counters
+  {
+    u32 rasterized_pixels = 0;
+    u32 tev_pixels_in = 0;
+    u32 tev_pixels_out = 0;
+    std::array<u32, PQ_NUM_MEMBERS> perf_pixels{};
+    u16 bbox_left = 0xFFFF;
+    u16 bbox_right = 0;
+    u16 bbox_top = 0xFFFF;
+    u16 bbox_bottom = 0;
+  };
+  Counters counters;
+
+  // Loads the state which stays constant during a draw, and selects the combiner implementation.
+  void BeginDraw(TevCombiner::CombineFunction combine);
+  // Draws the pixels of the quad whose bit is set in mask.
+  void Draw(u32 mask);
+  void FlushCounters();
 };
@@ -0,0 +1,309 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoBackends/Software/TevCombiner.h"
+
+#include <algorithm>
+
+#include "Common/Assert.h"
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "Common/EnumMap.h"
+#include "Common/Intrinsics.h"
+
+#if defined(_M_X86_64)
+#include <immintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
+namespace TevCombiner
+{
+namespace
+{
+enum
+{
+  ALP_C,
+  BLU_C,
+  GRN_C,
+  RED_C
+};
+
+constexpr Common::EnumMap<s32, TevBias::Compare> s_bias_lut{0, 128, -128, 0};
+constexpr Common::EnumMap<s32, TevScale::Divide2> s_scale_lshift_lut{0, 1, 2, 0};
+
+void SetChannel(Params& params, u32 channel, TevOp op, TevBias bias, TevScale scale, bool clamp,
+                bool is_alpha)
+{
+  const bool subtract = op == TevOp::Sub;
+
+  params.bias[channel] = s_bias_lut[bias];
+  params.scale[channel] = 1 << s_scale_lshift_lut[scale];
+  params.rounding[channel] = scale == TevScale::Divide2 ? 0 : subtract ? 127 : 128;
+  // The color and alpha combiners disagree on where the subtraction happens, which makes a
+  // difference for the rounding of negative values.
+  params.negate_before_shift[channel] = subtract && is_alpha ? -1 : 0;
+  params.negate_after_shift[channel] = subtract && !is_alpha ? -1 : 0;
+  params.divide_by_2[channel] = scale == TevScale::Divide2 ? -1 : 0;
+  params.clamp_min[channel] = clamp ? 0 : -1024;
+  params.clamp_max[channel] = clamp ? 255 : 1023;
+}
+
+void CombineGeneric(const Inputs& inputs, const Params& params, Lanes& out)
+{
+  for (u32 lane = 0; lane < NUM_LANES; lane++)
+  {
+    const u32 channel = lane % NUM_CHANNELS;
+
+    const s32 a = inputs.a[lane] & 0xFF;
+    const s32 b = inputs.b[lane] & 0xFF;
+    const s32 c = (inputs.c[lane] & 0xFF) + ((inputs.c[lane] & 0xFF) >> 7);
+    // d is an 11-bit signed input
+    const s32 d = static_cast<s32>(static_cast<u32>(inputs.d[lane]) << 21) >> 21;
+
+    s32 temp = a * (256 - c) + b * c;
+    temp *= params.scale[channel];
+    temp += params.rounding[channel];
+    temp = (temp ^ params.negate_before_shift[channel]) - params.negate_before_shift[channel];
+    temp >>= 8;
+    temp = (temp ^ params.negate_after_shift[channel]) - params.negate_after_shift[channel];
+
+    s32 result = (d + params.bias[channel]) * params.scale[channel] + temp;
+    if (params.divide_by_2[channel])
+      result >>= 1;
+
+    out[lane] = static_cast<s16>(
+        std::clamp(result, params.clamp_min[channel], params.clamp_max[channel]));
+  }
+}
+
+#if defined(_M_X86_64)
+// Helpers of target specific functions can't be lambdas, as those don't inherit the target.
+FUNCTION_TARGET_SSR41
+__m128i LoadPixelSSE41(const Lanes& lanes, u32 pixel)
+{
+  return _mm_cvtepi16_epi32(
+      _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&lanes[pixel * NUM_CHANNELS])));
+}
+
+FUNCTION_TARGET_SSR41
+void CombineSSE41(const Inputs& inputs, const Params& params, Lanes& out)
+{
+  const __m128i bias = _mm_load_si128(reinterpret_cast<const __m128i*>(params.bias.data()));
+  const __m128i scale = _mm_load_si128(reinterpret_cast<const __m128i*>(params.scale.data()));
+  const __m128i rounding =
+      _mm_load_si128(reinterpret_cast<const __m128i*>(params.rounding.data()));
+  const __m128i negate_before =
+      _mm_load_si128(reinterpret_cast<const __m128i*>(params.negate_before_shift.data()));
+  const __m128i negate_after =
+      _mm_load_si128(reinterpret_cast<const __m128i*>(params.negate_after_shift.data()));
+  const __m128i divide_by_2 =
+      _mm_load_si128(reinterpret_cast<const __m128i*>(params.divide_by_2.data()));
+  const __m128i clamp_min =
+      _mm_load_si128(reinterpret_cast<const __m128i*>(params.clamp_min.data()));
+  const __m128i clamp_max =
+      _mm_load_si128(reinterpret_cast<const __m128i*>(params.clamp_max.data()));
+  const __m128i mask_8 = _mm_set1_epi32(0xFF);
+  const __m128i value_256 = _mm_set1_epi32(256);
+
+  // One pixel per iteration, stored in pairs.
+  __m128i results[NUM_PIXELS];
+  for (u32 pixel = 0; pixel < NUM_PIXELS; pixel++)
+  {
+    const __m128i a = _mm_and_si128(LoadPixelSSE41(inputs.a, pixel), mask_8);
+    const __m128i b = _mm_and_si128(LoadPixelSSE41(inputs.b, pixel), mask_8);
+    __m128i c = _mm_and_si128(LoadPixelSSE41(inputs.c, pixel), mask_8);
+    c = _mm_add_epi32(c, _mm_srli_epi32(c, 7));
+    const __m128i d = _mm_srai_epi32(_mm_slli_epi32(LoadPixelSSE41(inputs.d, pixel), 21), 21);
+
+    __m128i temp = _mm_add_epi32(_mm_mullo_epi32(a, _mm_sub_epi32(value_256, c)),
+                                 _mm_mullo_epi32(b, c));
+    temp = _mm_add_epi32(_mm_mullo_epi32(temp, scale), rounding);
+    temp = _mm_sub_epi32(_mm_xor_si128(temp, negate_before), negate_before);
+    temp = _mm_srai_epi32(temp, 8);
+    temp = _mm_sub_epi32(_mm_xor_si128(temp, negate_after), negate_after);
+
+    __m128i result = _mm_add_epi32(_mm_mullo_epi32(_mm_add_epi32(d, bias), scale), temp);
+    result = _mm_blendv_epi8(result, _mm_srai_epi32(result, 1), divide_by_2);
+    results[pixel] = _mm_min_epi32(_mm_max_epi32(result, clamp_min), clamp_max);
+  }
+
+  _mm_store_si128(reinterpret_cast<__m128i*>(&out[0]), _mm_packs_epi32(results[0], results[1]));
+  _mm_store_si128(reinterpret_cast<__m128i*>(&out[8]), _mm_packs_epi32(results[2], results[3]));
+}
+
+FUNCTION_TARGET_AVX2
+__m256i LoadParamsAVX2(const std::array<s32, NUM_CHANNELS>& values)
+{
+  return _mm256_broadcastsi128_si256(
+      _mm_load_si128(reinterpret_cast<const __m128i*>(values.data())));
+}
+
+// Loads two pixels.
+FUNCTION_TARGET_AVX2
+__m256i LoadPixelsAVX2(const Lanes& lanes, u32 pixel)
+{
+  return _mm256_cvtepi16_epi32(
+      _mm_load_si128(reinterpret_cast<const __m128i*>(&lanes[pixel * NUM_CHANNELS])));
+}
+
+FUNCTION_TARGET_AVX2
+void CombineAVX2(const Inputs& inputs, const Params& params, Lanes& out)
+{
+  const __m256i bias = LoadParamsAVX2(params.bias);
+  const __m256i scale = LoadParamsAVX2(params.scale);
+  const __m256i rounding = LoadParamsAVX2(params.rounding);
+  const __m256i negate_before = LoadParamsAVX2(params.negate_before_shift);
+  const __m256i negate_after = LoadParamsAVX2(params.negate_after_shift);
+  const __m256i divide_by_2 = LoadParamsAVX2(params.divide_by_2);
+  const __m256i clamp_min = LoadParamsAVX2(params.clamp_min);
+  const __m256i clamp_max = LoadParamsAVX2(params.clamp_max);
+  const __m256i mask_8 = _mm256_set1_epi32(0xFF);
+  const __m256i value_256 = _mm256_set1_epi32(256);
+
+  // Two pixels per iteration.
+  __m256i results[NUM_PIXELS / 2];
+  for (u32 pixel = 0; pixel < NUM_PIXELS; pixel += 2)
+  {
+    const __m256i a = _mm256_and_si256(LoadPixelsAVX2(inputs.a, pixel), mask_8);
+    const __m256i b = _mm256_and_si256(LoadPixelsAVX2(inputs.b, pixel), mask_8);
+    __m256i c = _mm256_and_si256(LoadPixelsAVX2(inputs.c, pixel), mask_8);
+    c = _mm256_add_epi32(c, _mm256_srli_epi32(c, 7));
+    const __m256i d = _mm256_srai_epi32(_mm256_slli_epi32(LoadPixelsAVX2(inputs.d, pixel), 21), 21);
+
+    __m256i temp = _mm256_add_epi32(_mm256_mullo_epi32(a, _mm256_sub_epi32(value_256, c)),
+                                    _mm256_mullo_epi32(b, c));
+    temp = _mm256_add_epi32(_mm256_mullo_epi32(temp, scale), rounding);
+    temp = _mm256_sub_epi32(_mm256_xor_si256(temp, negate_before), negate_before);
+    temp = _mm256_srai_epi32(temp, 8);
+    temp = _mm256_sub_epi32(_mm256_xor_si256(temp, negate_after), negate_after);
+
+    __m256i result =
+        _mm256_add_epi32(_mm256_mullo_epi32(_mm256_add_epi32(d, bias), scale), temp);
+    result = _mm256_blendv_epi8(result, _mm256_srai_epi32(result, 1), divide_by_2);
+    results[pixel / 2] = _mm256_min_epi32(_mm256_max_epi32(result, clamp_min), clamp_max);
+  }
+
+  // packs works within 128-bit halves, so the 64-bit blocks have to be put back in order.
+  const __m256i packed = _mm256_packs_epi32(results[0], results[1]);
+  _mm256_store_si256(reinterpret_cast<__m256i*>(&out[0]),
+                     _mm256_permute4x64_epi64(packed, 0b11'01'10'00));
+}
+#endif
+
+#if defined(_M_ARM_64)
+void CombineNEON(const Inputs& inputs, const Params& params, Lanes& out)
+{
+  const int32x4_t bias = vld1q_s32(params.bias.data());
+  const int32x4_t scale = vld1q_s32(params.scale.data());
+  const int32x4_t rounding = vld1q_s32(params.rounding.data());
+  const int32x4_t negate_before = vld1q_s32(params.negate_before_shift.data());
+  const int32x4_t negate_after = vld1q_s32(params.negate_after_shift.data());
+  const uint32x4_t divide_by_2 = vreinterpretq_u32_s32(vld1q_s32(params.divide_by_2.data()));
+  const int32x4_t clamp_min = vld1q_s32(params.clamp_min.data());
+  const int32x4_t clamp_max = vld1q_s32(params.clamp_max.data());
+  const int32x4_t mask_8 = vdupq_n_s32(0xFF);
+  const int32x4_t value_256 = vdupq_n_s32(256);
+
+  const auto load = [](const Lanes& lanes, u32 pixel) {
+    return vmovl_s16(vld1_s16(&lanes[pixel * NUM_CHANNELS]));
+  };
+
+  for (u32 pixel = 0; pixel < NUM_PIXELS; pixel++)
+  {
+    const int32x4_t a = vandq_s32(load(inputs.a, pixel), mask_8);
+    const int32x4_t b = vandq_s32(load(inputs.b, pixel), mask_8);
+    int32x4_t c = vandq_s32(load(inputs.c, pixel), mask_8);
+    c = vaddq_s32(c, vshrq_n_s32(c, 7));
+    const int32x4_t d = vshrq_n_s32(vshlq_n_s32(load(inputs.d, pixel), 21), 21);
+
+    int32x4_t temp = vmlaq_s32(vmulq_s32(b, c), a, vsubq_s32(value_256, c));
+    temp = vmlaq_s32(rounding, temp, scale);
+    temp = vsubq_s32(veorq_s32(temp, negate_before), negate_before);
+    temp = vshrq_n_s32(temp, 8);
+    temp = vsubq_s32(veorq_s32(temp, negate_after), negate_after);
+
+    int32x4_t result = vmlaq_s32(temp, vaddq_s32(d, bias), scale);
+    result = vbslq_s32(divide_by_2, vshrq_n_s32(result, 1), result);
+    result = vminq_s32(vmaxq_s32(result, clamp_min), clamp_max);
+    vst1_s16(&out[pixel * NUM_CHANNELS], vqmovn_s32(result));
+  }
+}
+#endif
+}  // namespace
+
+Params MakeParams(const TevStageCombiner::ColorCombiner& cc,
+                  const TevStageCombiner::AlphaCombiner& ac)
+{
+  Params params;
+  for (u32 channel = BLU_C; channel <= RED_C; channel++)
+    SetChannel(params, channel, cc.op, cc.bias, cc.scale, cc.clamp, false);
+  SetChannel(params, ALP_C, ac.op, ac.bias, ac.scale, ac.clamp, true);
+  return params;
+}
+
+std::string_view GetName(Implementation implementation)
+{
+  switch (implementation)
+  {
+  case Implementation::Generic:
+    return "Generic";
+  case Implementation::SSE41:
+    return "SSE4.1";
+  case Implementation::AVX2:
+    return "AVX2";
+  case Implementation::NEON:
+    return "NEON";
+  }
+  return "Unknown";
+}
+
+std::vector<Implementation> GetSupportedImplementations()
+{
+  std::vector<Implementation> implementations{Implementation::Generic};
+#if defined(_M_X86_64)
+  if (cpu_info.bSSE4_1)
+    implementations.push_back(Implementation::SSE41);
+  if (cpu_info.bAVX2)
+    implementations.push_back(Implementation::AVX2);
+#elif defined(_M_ARM_64)
+  implementations.push_back(Implementation::NEON);
+#endif
+  return implementations;
+}
+
+Implementation GetBestImplementation()
+{
+#if defined(_M_X86_64)
+  if (cpu_info.bAVX2)
+    return Implementation::AVX2;
+  if (cpu_info.bSSE4_1)
+    return Implementation::SSE41;
+#elif defined(_M_ARM_64)
+  return Implementation::NEON;
+#endif
+  return Implementation::Generic;
+}
+
+CombineFunction GetCombineFunction(Implementation implementation)
+{
+  switch (implementation)
+  {
+#if defined(_M_X86_64)
+  case Implementation::SSE41:
+    return CombineSSE41;
+  case Implementation::AVX2:
+    return CombineAVX2;
+#elif defined(_M_ARM_64)
+  case Implementation::NEON:
+    return CombineNEON;
+#endif
+  case Implementation::Generic:
+    return CombineGeneric;
+  default:
+    ASSERT_MSG(VIDEO, false, "Unsupported TEV combiner implementation {}",
+               GetName(implementation));
+    return CombineGeneric;
+  }
+}
+}  // namespace TevCombiner
@@ -0,0 +1,87 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <string_view>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/BPMemory.h"
+
+// The arithmetic of the TEV stage combiners, evaluated for a whole 2x2 pixel quad at once.
+//
+// Values are kept in "lanes": 4 pixels with 4 channels each, in the channel order of Tev (alpha,
+// blue, green, red). Every implementation produces exactly the same results as the scalar TEV.
+namespace TevCombiner
+{
+constexpr u32 NUM_PIXELS = 4;
+constexpr u32 NUM_CHANNELS = 4;
+constexpr u32 NUM_LANES = NUM_PIXELS * NUM_CHANNELS;
+
+struct alignas(32) Lanes
+{
+  std::array<s16, NUM_LANES> values;
+
+  constexpr s16& operator[](u32 lane) { return values[lane]; }
+  constexpr const s16& operator[](u32 lane) const { return values[lane]; }
+
+  constexpr static Lanes All(s16 value)
+  {
+    Lanes lanes{};
+    lanes.values.fill(value);
+    return lanes;
+  }
+};
+
+// The raw a, b, c and d inputs of a stage. They are truncated to the widths of the hardware inputs
+// by the combiner.
+struct Inputs
+{
+  Lanes a;
+  Lanes b;
+  Lanes c;
+  Lanes d;
+};
+
+// The combiner settings of a stage, per channel. Color channels use the color combiner and the
+// alpha channel uses the alpha combiner.
+struct Params
+{
+  alignas(16) std::array<s32, NUM_CHANNELS> bias;
+  alignas(16) std::array<s32, NUM_CHANNELS> scale;
+  alignas(16) std::array<s32, NUM_CHANNELS> rounding;
+  // All ones to negate the interpolated value before (alpha) or after (color) dividing by 256.
+  alignas(16) std::array<s32, NUM_CHANNELS> negate_before_shift;
+  alignas(16) std::array<s32, NUM_CHANNELS> negate_after_shift;
+  // All ones when the result is divided by 2.
+  alignas(16) std::array<s32, NUM_CHANNELS> divide_by_2;
+  alignas(16) std::array<s32, NUM_CHANNELS> clamp_min;
+  alignas(16) std::array<s32, NUM_CHANNELS> clamp_max;
+};
+
+Params MakeParams(const TevStageCombiner::ColorCombiner& cc,
+                  const TevStageCombiner::AlphaCombiner& ac);
+
+// Evaluates d + lerp(a, b, c) with bias, scale and clamping for every lane, as done by stages which
+// don't use a comparison mode.
+using CombineFunction = void (*)(const Inputs& inputs, const Params& params, Lanes& out);
+
+enum class Implementation
+{
+  Generic,
+  SSE41,
+  AVX2,
+  NEON,
+};
+
+std::string_view GetName(Implementation implementation);
+
+// Returns the implementations the host CPU can run, the generic one first.
+std::vector<Implementation> GetSupportedImplementations();
+// Returns the fastest implementation the host CPU can run.
+Implementation GetBestImplementation();
+
+CombineFunction GetCombineFunction(Implementation implementation);
+}  // namespace TevCombiner
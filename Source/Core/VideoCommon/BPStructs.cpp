@@ -37,6 +37,7 @@
 #include "VideoCommon/TMEM.h"
 #include "VideoCommon/TextureCacheBase.h"
 #include "VideoCommon/TextureDecoder.h"
+#include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoBackendBase.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
@@ -54,6 +55,43 @@ void BPInit()
   bpmem.bpMask = 0xFFFFFF;
 }
 
+bool IsDrawIndependentBPRegister(u32 address)
+{
+  switch (address)
+  {
+  case BPMEM_DISPLAYCOPYFILTER:
+  case BPMEM_DISPLAYCOPYFILTER + 1:
+  case BPMEM_DISPLAYCOPYFILTER + 2:
+  case BPMEM_DISPLAYCOPYFILTER + 3:
+  case BPMEM_COPYFILTER0:
+  case BPMEM_COPYFILTER1:
+  case BPMEM_FIELDMASK:
+  case BPMEM_FIELDMODE:
+  case BPMEM_BUSCLOCK0:
+  case BPMEM_BUSCLOCK1:
+  case BPMEM_PERF0_TRI:
+  case BPMEM_PERF0_QUAD:
+  case BPMEM_PERF1:
+  case BPMEM_EFB_TL:
+  case BPMEM_EFB_WH:
+  case BPMEM_EFB_ADDR:
+  case BPMEM_CLEAR_AR:
+  case BPMEM_CLEAR_GB:
+  case BPMEM_CLEAR_Z:
+  case BPMEM_EFB_STRIDE:
+  case BPMEM_COPYYSCALE:
+  case BPMEM_LOADTLUT0:
+  case BPMEM_IND_IMASK:
+  case BPMEM_REVBITS:
+  case BPMEM_PRELOAD_ADDR:
+  case BPMEM_PRELOAD_TMEMEVEN:
+  case BPMEM_PRELOAD_TMEMODD:
+    return true;
+  default:
+    return false;
+  }
+}
+
 static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager& xf_state_manager,
                       GeometryShaderManager& geometry_shader_manager, const BPCmd& bp,
                       int cycles_into_future)
@@ -92,7 +130,12 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
     }
   }
 
-  FlushPipeline();
+  // The queued primitives can be drawn together with the following ones if nothing they use
+  // changes.
+  if (IsDrawIndependentBPRegister(bp.address))
+    g_vertex_manager->DeferFlush();
+  else
+    FlushPipeline();
 
   ((u32*)&bpmem)[bp.address] = bp.newvalue;
 
@@ -3,5 +3,11 @@
 
 #pragma once
 
+#include "Common/CommonTypes.h"
+
 void BPInit();
 void BPReload();
+
+// Registers that only configure later EFB copies, clears and TMEM loads, or aren't emulated at
+// all. Writing them doesn't change how the queued primitives are drawn.
+bool IsDrawIndependentBPRegister(u32 address);
@@ -3,6 +3,9 @@
 
 #include "VideoCommon/CPUCull.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "Common/Assert.h"
 #include "Common/CPUDetect.h"
 #include "Common/MathUtil.h"
@@ -10,6 +13,7 @@
 #include "Core/System.h"
 
 #include "VideoCommon/CPMemory.h"
+#include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VertexShaderManager.h"
 #include "VideoCommon/VideoConfig.h"
@@ -54,10 +58,14 @@
 #include "VideoCommon/CPUCullImpl.h"
 #define USE_FMA
 #include "VideoCommon/CPUCullImpl.h"
+#define USE_AVX512
+#include "VideoCommon/CPUCullImpl.h"
 #endif
 
 #if defined(USE_SSE)
-#if defined(__AVX__) && defined(__FMA__)
+#if defined(__AVX512F__)
+static constexpr int MIN_SSE = 60;
+#elif defined(__AVX__) && defined(__FMA__)
 static constexpr int MIN_SSE = 51;
 #elif defined(__AVX__)
 static constexpr int MIN_SSE = 50;
@@ -74,7 +82,9 @@ template <bool PositionHas3Elems, bool PerVertexPosMtx>
 static CPUCull::TransformFunction GetTransformFunction()
 {
 #if defined(USE_SSE)
-  if (MIN_SSE >= 51 || (cpu_info.bAVX && cpu_info.bFMA))
+  if (MIN_SSE >= 60 || cpu_info.bAVX512F)
+    return CPUCull_AVX512::TransformVertices<PositionHas3Elems, PerVertexPosMtx>;
+  else if (MIN_SSE >= 51 || (cpu_info.bAVX && cpu_info.bFMA))
     return CPUCull_FMA::TransformVertices<PositionHas3Elems, PerVertexPosMtx>;
   else if (MIN_SSE >= 50 || cpu_info.bAVX)
     return CPUCull_AVX::TransformVertices<PositionHas3Elems, PerVertexPosMtx>;
@@ -91,6 +101,21 @@ static CPUCull::TransformFunction GetTransformFunction()
 #endif
 }
 
+template <bool PositionHas3Elems>
+static CPUCull::BoundsFunction GetBoundsFunction()
+{
+#if defined(USE_SSE)
+  if (MIN_SSE >= 50 || cpu_info.bAVX)
+    return CPUCull_AVX::TestBounds<PositionHas3Elems>;
+  else
+    return CPUCull_SSE::TestBounds<PositionHas3Elems>;
+#elif defined(USE_NEON)
+  return CPUCull_NEON::TestBounds<PositionHas3Elems>;
+#else
+  return CPUCull_Scalar::TestBounds<PositionHas3Elems>;
+#endif
+}
+
 template <OpcodeDecoder::Primitive Primitive, CullMode Mode>
 static CPUCull::CullFunction GetCullFunction0()
 {
@@ -129,6 +154,8 @@ void CPUCull::Init()
   m_transform_table[false][true] = GetTransformFunction<false, true>();
   m_transform_table[true][false] = GetTransformFunction<true, false>();
   m_transform_table[true][true] = GetTransformFunction<true, true>();
+  m_bounds_table[false] = GetBoundsFunction<false>();
+  m_bounds_table[true] = GetBoundsFunction<true>();
   using Prim = OpcodeDecoder::Primitive;
   m_cull_table[Prim::GX_DRAW_QUADS] = GetCullFunction1<Prim::GX_DRAW_QUADS>();
   m_cull_table[Prim::GX_DRAW_QUADS_2] = GetCullFunction1<Prim::GX_DRAW_QUADS>();
@@ -163,6 +190,25 @@ bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Prim
   CullMode cull_mode = bpmem.genMode.cull_mode;
   if (xfmem.viewport.ht > 0)  // See videosoftware Clipper.cpp:IsBackface
     cull_mode = cullmode_invert[cull_mode];
+
+  // Without per-vertex matrices, a batch that is entirely on one side of the frustum can be culled
+  // without transforming each vertex, and one that is entirely inside of it can't be culled unless
+  // its triangles face the wrong way. Only the batches that cross an edge need the full test.
+  if (m_bounds_test_enabled && !perVertexPosMtx && count >= MIN_BOUNDS_TEST_VERTICES)
+  {
+    const BoundsResult bounds = m_bounds_table[posHas3Elems](src, stride, count);
+    if (bounds == BoundsResult::Outside)
+    {
+      INCSTAT(g_stats.this_frame.num_cpu_cull_bounds_culled);
+      return true;
+    }
+    if (bounds == BoundsResult::Inside && cull_mode == CullMode::None)
+    {
+      INCSTAT(g_stats.this_frame.num_cpu_cull_bounds_kept);
+      return false;
+    }
+  }
+
   const TransformFunction transform = m_transform_table[posHas3Elems][perVertexPosMtx];
   transform(m_transform_buffer.get(), src, stride, count);
   const CullFunction cull = m_cull_table[primitive][cull_mode];
@@ -20,10 +20,26 @@ public:
     float x, y, z, w;
   };
 
+  // Where the bounding box of a batch lies relative to the frustum.
+  enum class BoundsResult
+  {
+    Inside,
+    Outside,
+    Intersecting,
+  };
+
   using TransformFunction = void (*)(void*, const void*, u32, int);
+  using BoundsFunction = BoundsResult (*)(const void*, u32, int);
   using CullFunction = bool (*)(const CPUCull::TransformedVertex*, int);
 
+protected:
+  // Whether large batches are tested by their bounding box before transforming each vertex
+  bool m_bounds_test_enabled = true;
+
 private:
+  // Smaller batches are faster to transform than to test the bounding box of first.
+  static constexpr u32 MIN_BOUNDS_TEST_VERTICES = 16;
+
   template <typename T>
   struct BufferDeleter
   {
@@ -32,6 +48,7 @@ private:
   std::unique_ptr<TransformedVertex[], BufferDeleter<TransformedVertex>> m_transform_buffer{};
   u32 m_transform_buffer_size = 0;
   std::array<std::array<TransformFunction, 2>, 2> m_transform_table{};
+  std::array<BoundsFunction, 2> m_bounds_table{};
   Common::EnumMap<Common::EnumMap<CullFunction, CullMode::All>,
                   OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_FAN>
       m_cull_table{};
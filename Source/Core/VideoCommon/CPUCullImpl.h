@@ -1,7 +1,9 @@
 // Copyright 2022 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
-#if defined(USE_FMA)
+#if defined(USE_AVX512)
+#define VECTOR_NAMESPACE CPUCull_AVX512
+#elif defined(USE_FMA)
 #define VECTOR_NAMESPACE CPUCull_FMA
 #elif defined(USE_AVX)
 #define VECTOR_NAMESPACE CPUCull_AVX
@@ -19,7 +21,9 @@
 #error This file is meant to be used by CPUCull.cpp only!
 #endif
 
-#if defined(__GNUC__) && defined(USE_FMA) && !(defined(__AVX__) && defined(__FMA__))
+#if defined(__GNUC__) && defined(USE_AVX512) && !defined(__AVX512F__)
+#define ATTR_TARGET __attribute__((target("avx512f,avx2,fma")))
+#elif defined(__GNUC__) && defined(USE_FMA) && !(defined(__AVX__) && defined(__FMA__))
 #define ATTR_TARGET __attribute__((target("avx,fma")))
 #elif defined(__GNUC__) && defined(USE_AVX) && !defined(__AVX__)
 #define ATTR_TARGET __attribute__((target("avx")))
@@ -236,6 +240,60 @@ LoadTransform2Vertices(const u8* v0data, const u8* v1data,                  //
 
 #endif
 
+#ifdef USE_AVX512
+template <int i>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512 vector_broadcast(__m512 v)
+{
+  return _mm512_permute_ps(v, _MM_SHUFFLE(i, i, i, i));
+}
+
+// Copies a row that is repeated in both halves of a YMM register to all four quarters of a ZMM one
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512 WidenYMM(__m256 v)
+{
+  return _mm512_castpd_ps(_mm512_broadcast_f64x4(_mm256_castps_pd(v)));
+}
+
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512 ApplyMatrixZMM(__m512 v, __m512 m0, __m512 m1,
+                                                              __m512 m2, __m512 m3)
+{
+  __m512 output = _mm512_mul_ps(vector_broadcast<0>(v), m0);
+  output = _mm512_fmadd_ps(vector_broadcast<1>(v), m1, output);
+  output = _mm512_fmadd_ps(vector_broadcast<2>(v), m2, output);
+  output = _mm512_fmadd_ps(vector_broadcast<3>(v), m3, output);
+  return output;
+}
+
+template <bool PositionHas3Elems>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m128 LoadPositionXMM(const u8* data)
+{
+  const float* fdata = reinterpret_cast<const float*>(data);
+  if constexpr (PositionHas3Elems)
+    return _mm_loadu_ps(fdata);
+  else
+    return _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(fdata));
+}
+
+// Only for vertices without a position matrix index, as all four vertices use the same matrix.
+template <bool PositionHas3Elems>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512
+LoadTransform4Vertices(const u8* data, u32 stride,                          //
+                       __m512 pos0, __m512 pos1, __m512 pos2, __m512 pos3,  //
+                       __m512 proj0, __m512 proj1, __m512 proj2, __m512 proj3)
+{
+  __m512 v0123 = _mm512_castps128_ps512(LoadPositionXMM<PositionHas3Elems>(data));
+  v0123 = _mm512_insertf32x4(v0123, LoadPositionXMM<PositionHas3Elems>(data + stride), 1);
+  v0123 = _mm512_insertf32x4(v0123, LoadPositionXMM<PositionHas3Elems>(data + stride * 2), 2);
+  v0123 = _mm512_insertf32x4(v0123, LoadPositionXMM<PositionHas3Elems>(data + stride * 3), 3);
+
+  __m512 output = pos3;  // vertex.w is always 1.0
+  output = _mm512_fmadd_ps(vector_broadcast<0>(v0123), pos0, output);
+  output = _mm512_fmadd_ps(vector_broadcast<1>(v0123), pos1, output);
+  if constexpr (PositionHas3Elems)
+    output = _mm512_fmadd_ps(vector_broadcast<2>(v0123), pos2, output);
+  return ApplyMatrixZMM(output, proj0, proj1, proj2, proj3);
+}
+#endif
+
 #ifndef USE_AVX
 // Note: Assumes 16-byte aligned source
 ATTR_TARGET DOLPHIN_FORCE_INLINE static void LoadTransposed(const void* source, Vector& o0,
@@ -517,6 +575,23 @@ ATTR_TARGET static void TransformVertices(void* output, const void* vertices, u3
   __m256 pos0, pos1, pos2, pos3;
   LoadTransposedYMM(vsmanager.constants.projection.data(), proj0, proj1, proj2, proj3);
   LoadTransposedPosYMM(&xfmem.posMatrices[idx * 4], pos0, pos1, pos2, pos3);
+#ifdef USE_AVX512
+  if constexpr (!PerVertexPosMtx)
+  {
+    const __m512 proj0z = WidenYMM(proj0), proj1z = WidenYMM(proj1);
+    const __m512 proj2z = WidenYMM(proj2), proj3z = WidenYMM(proj3);
+    const __m512 pos0z = WidenYMM(pos0), pos1z = WidenYMM(pos1);
+    const __m512 pos2z = WidenYMM(pos2), pos3z = WidenYMM(pos3);
+    for (; count >= 4; count -= 4)
+    {
+      __m512 v0123 = LoadTransform4Vertices<PositionHas3Elems>(
+          cvertices, stride, pos0z, pos1z, pos2z, pos3z, proj0z, proj1z, proj2z, proj3z);
+      _mm512_storeu_ps(reinterpret_cast<float*>(voutput), v0123);
+      cvertices += stride * 4;
+      voutput += 4;
+    }
+  }
+#endif
   for (int i = 1; i < count; i += 2)
   {
     const u8* v0data = cvertices;
@@ -551,6 +626,143 @@ ATTR_TARGET static void TransformVertices(void* output, const void* vertices, u3
 #endif
 }
 
+template <bool PositionHas3Elems>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static Vector LoadPosition(const u8* data)
+{
+  const float* fdata = reinterpret_cast<const float*>(data);
+  if constexpr (PositionHas3Elems)
+  {
+#if defined(USE_SSE)
+    return _mm_loadu_ps(fdata);
+#elif defined(USE_NEON)
+    return vld1q_f32(fdata);
+#else
+    return {fdata[0], fdata[1], fdata[2], 1.0f};
+#endif
+  }
+  else
+  {
+#if defined(USE_SSE)
+    return _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(fdata));
+#elif defined(USE_NEON)
+    return vcombine_f32(vld1_f32(fdata), vdup_n_f32(0.0f));
+#else
+    return {fdata[0], fdata[1], 0.0f, 1.0f};
+#endif
+  }
+}
+
+ATTR_TARGET DOLPHIN_FORCE_INLINE static void MinMax(Vector v, Vector& min, Vector& max)
+{
+#if defined(USE_SSE)
+  min = _mm_min_ps(min, v);
+  max = _mm_max_ps(max, v);
+#elif defined(USE_NEON)
+  min = vminq_f32(min, v);
+  max = vmaxq_f32(max, v);
+#else
+  min = {std::min(min.x, v.x), std::min(min.y, v.y), std::min(min.z, v.z), 1.0f};
+  max = {std::max(max.x, v.x), std::max(max.y, v.y), std::max(max.z, v.z), 1.0f};
+#endif
+}
+
+ATTR_TARGET DOLPHIN_FORCE_INLINE static void StoreVector(float* output, Vector v)
+{
+#if defined(USE_SSE)
+  _mm_store_ps(output, v);
+#elif defined(USE_NEON)
+  vst1q_f32(output, v);
+#else
+  output[0] = v.x;
+  output[1] = v.y;
+  output[2] = v.z;
+  output[3] = v.w;
+#endif
+}
+
+// Tests the bounding box of a batch of vertices that all use the current position matrix against
+// the frustum, which is much cheaper than transforming all of them.
+template <bool PositionHas3Elems>
+ATTR_TARGET static CPUCull::BoundsResult TestBounds(const void* vertices, u32 stride, int count)
+{
+  const VertexShaderManager& vsmanager = Core::System::GetInstance().GetVertexShaderManager();
+  const u8* cvertices = static_cast<const u8*>(vertices);
+  Vector min = LoadPosition<PositionHas3Elems>(cvertices);
+  Vector max = min;
+  for (int i = 1; i < count; i++)
+  {
+    cvertices += stride;
+    MinMax(LoadPosition<PositionHas3Elems>(cvertices), min, max);
+  }
+  alignas(16) float bounds[2][4];
+  StoreVector(bounds[0], min);
+  StoreVector(bounds[1], max);
+
+  u32 idx = g_main_cp_state.matrix_index_a.PosNormalMtxIdx & 0x3f;
+  Vector proj0, proj1, proj2, proj3;
+  Vector pos0, pos1, pos2, pos3;
+#ifdef USE_AVX
+  __m256 proj0y, proj1y, proj2y, proj3y;
+  __m256 pos0y, pos1y, pos2y, pos3y;
+  LoadTransposedYMM(vsmanager.constants.projection.data(), proj0y, proj1y, proj2y, proj3y);
+  LoadTransposedPosYMM(&xfmem.posMatrices[idx * 4], pos0y, pos1y, pos2y, pos3y);
+  proj0 = _mm256_castps256_ps128(proj0y);
+  proj1 = _mm256_castps256_ps128(proj1y);
+  proj2 = _mm256_castps256_ps128(proj2y);
+  proj3 = _mm256_castps256_ps128(proj3y);
+  pos0 = _mm256_castps256_ps128(pos0y);
+  pos1 = _mm256_castps256_ps128(pos1y);
+  pos2 = _mm256_castps256_ps128(pos2y);
+  pos3 = _mm256_castps256_ps128(pos3y);
+#else
+  LoadTransposed(vsmanager.constants.projection.data(), proj0, proj1, proj2, proj3);
+  LoadTransposedPos(&xfmem.posMatrices[idx * 4], pos0, pos1, pos2, pos3);
+#endif
+
+  // Clip space coordinates are linear in the position, so every vertex is outside of a plane of
+  // the frustum if all corners of the box are, and inside of all of them if all corners are.
+  // The corners are held to a small margin, as the vertices are transformed with other rounding.
+  static constexpr float MARGIN = 1.0f / 65536;
+  std::array<int, 4> corners_outside{};
+  int corners_inside = 0;
+  const int num_corners = PositionHas3Elems ? 8 : 4;
+  for (int corner = 0; corner < num_corners; corner++)
+  {
+    const float x = bounds[corner & 1][0];
+    const float y = bounds[(corner >> 1) & 1][1];
+    const float z = bounds[(corner >> 2) & 1][2];
+#if defined(USE_SSE)
+    const Vector position = _mm_setr_ps(x, y, z, 1.0f);
+#elif defined(USE_NEON)
+    const Vector position = vsetr_f32(x, y, z, 1.0f);
+#else
+    const Vector position = {x, y, z, 1.0f};
+#endif
+    alignas(16) float clip[4];
+    StoreVector(clip, TransformVertex<PositionHas3Elems>(position, pos0, pos1, pos2, pos3,  //
+                                                         proj0, proj1, proj2, proj3));
+
+    const float w = clip[3];
+    const float margin_x = (std::abs(clip[0]) + std::abs(w)) * MARGIN;
+    const float margin_y = (std::abs(clip[1]) + std::abs(w)) * MARGIN;
+    const bool outside[4] = {clip[0] < -w - margin_x, clip[0] > w + margin_x,
+                             clip[1] < -w - margin_y, clip[1] > w + margin_y};
+    for (size_t plane = 0; plane < corners_outside.size(); plane++)
+      corners_outside[plane] += outside[plane];
+    corners_inside += clip[0] >= -w + margin_x && clip[0] <= w - margin_x &&
+                      clip[1] >= -w + margin_y && clip[1] <= w - margin_y;
+  }
+
+  for (const int outside : corners_outside)
+  {
+    if (outside == num_corners)
+      return CPUCull::BoundsResult::Outside;
+  }
+  if (corners_inside == num_corners)
+    return CPUCull::BoundsResult::Inside;
+  return CPUCull::BoundsResult::Intersecting;
+}
+
 template <CullMode Mode>
 ATTR_TARGET DOLPHIN_FORCE_INLINE static bool CullTriangle(const CPUCull::TransformedVertex& a,
                                                           const CPUCull::TransformedVertex& b,
@@ -0,0 +1,279 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/DisplayListCache.h"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+
+#include <xxhash.h>
+
+#include "Common/Swap.h"
+#include "Core/HW/Memmap.h"
+#include "Core/System.h"
+#include "VideoCommon/VertexLoaderBase.h"
+#include "VideoCommon/VertexLoaderManager.h"
+#include "VideoCommon/VertexLoader_Color.h"
+#include "VideoCommon/VertexLoader_Normal.h"
+#include "VideoCommon/VertexLoader_Position.h"
+#include "VideoCommon/VertexLoader_TextCoord.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace
+{
+// A vertex component that is read from a vertex array.
+struct IndexedComponent
+{
+  CPArray array;
+  // Offset of the indices in the raw vertex
+  u32 offset;
+  u32 index_size;
+  // Normals with NormalIndex3 have separate indices for the normal, binormal and tangent.
+  u32 num_indices;
+  // Size of the data that an index points to
+  u32 element_size;
+};
+
+std::vector<IndexedComponent> GetIndexedComponents(const TVtxDesc& vtx_desc, const VAT& vat)
+{
+  std::vector<IndexedComponent> components;
+
+  // Each enabled TexMatIdx adds one byte, as does PosMatIdx
+  u32 offset = std::popcount(vtx_desc.low.Hex & 0x1FF);
+  const auto add = [&](CPArray array, VertexComponentFormat type, u32 size, u32 element_size) {
+    if (IsIndexed(type))
+    {
+      const u32 index_size = type == VertexComponentFormat::Index16 ? 2 : 1;
+      components.push_back({array, offset, index_size, size / index_size, element_size});
+    }
+    offset += size;
+  };
+
+  add(CPArray::Position, vtx_desc.low.Position,
+      VertexLoader_Position::GetSize(vtx_desc.low.Position, vat.g0.PosFormat, vat.g0.PosElements),
+      VertexLoader_Position::GetSize(VertexComponentFormat::Direct, vat.g0.PosFormat,
+                                     vat.g0.PosElements));
+  add(CPArray::Normal, vtx_desc.low.Normal,
+      VertexLoader_Normal::GetSize(vtx_desc.low.Normal, vat.g0.NormalFormat,
+                                   vat.g0.NormalElements, vat.g0.NormalIndex3),
+      VertexLoader_Normal::GetSize(VertexComponentFormat::Direct, vat.g0.NormalFormat,
+                                   vat.g0.NormalElements, false));
+  for (u32 i = 0; i < vtx_desc.low.Color.Size(); i++)
+  {
+    add(CPArray::Color0 + i, vtx_desc.low.Color[i],
+        VertexLoader_Color::GetSize(vtx_desc.low.Color[i], vat.GetColorFormat(i)),
+        VertexLoader_Color::GetSize(VertexComponentFormat::Direct, vat.GetColorFormat(i)));
+  }
+  for (u32 i = 0; i < vtx_desc.high.TexCoord.Size(); i++)
+  {
+    add(CPArray::TexCoord0 + i, vtx_desc.high.TexCoord[i],
+        VertexLoader_TextCoord::GetSize(vtx_desc.high.TexCoord[i], vat.GetTexFormat(i),
+                                        vat.GetTexElements(i)),
+        VertexLoader_TextCoord::GetSize(VertexComponentFormat::Direct, vat.GetTexFormat(i),
+                                        vat.GetTexElements(i)));
+  }
+
+  return components;
+}
+}  // namespace
+
+size_t DisplayListCache::KeyHash::operator()(const Key& key) const noexcept
+{
+  return std::hash<u64>{}((u64{key.address} << 32) ^ (u64{key.count} << 8) ^
+                          static_cast<u64>(key.primitive)) ^
+         std::hash<const void*>{}(key.loader);
+}
+
+const DisplayListCache::Entry* DisplayListCache::Lookup(const Key& key, const u8* src,
+                                                        const TVtxDesc& vtx_desc, const VAT& vat,
+                                                        Entry** new_entry)
+{
+  *new_entry = nullptr;
+
+  auto iter = m_entries.find(key);
+  if (iter != m_entries.end())
+  {
+    Entry& entry = iter->second;
+    if (entry.changes >= MAX_CHANGES)
+      return nullptr;
+    if (entry.stored && IsUnchanged(entry))
+      return &entry;
+
+    // The vertices couldn't be stored last time, so they won't be this time either.
+    entry.changes = entry.stored ? entry.changes + 1 : MAX_CHANGES;
+  }
+  else if (m_size >= MAX_SIZE)
+  {
+    // Draws that are no longer used are never removed, so start over once there are a lot of them.
+    Clear();
+  }
+
+  Entry& entry = m_entries[key];
+  const u32 changes = entry.changes;
+  // Only stored entries count towards m_size. Vertices loaded for an entry that was never stored
+  // are freed here.
+  if (entry.stored)
+    m_size -= GetEntrySize(entry);
+  entry = Entry{};
+  entry.changes = changes;
+  if (entry.changes >= MAX_CHANGES)
+    return nullptr;
+
+  if (!Prepare(entry, key.address, key.count, key.loader->m_vertex_size, src, vtx_desc, vat))
+  {
+    entry.changes = MAX_CHANGES;
+    return nullptr;
+  }
+
+  *new_entry = &entry;
+  return nullptr;
+}
+
+void DisplayListCache::Store(Entry* entry, u32 num_vertices, u32 stride, std::vector<u16> indices)
+{
+  entry->vertices.resize(num_vertices * stride);
+  entry->vertices.shrink_to_fit();
+  entry->indices = std::move(indices);
+  entry->num_vertices = num_vertices;
+  entry->position_cache = VertexLoaderManager::position_cache;
+  entry->position_matrix_index_cache = VertexLoaderManager::position_matrix_index_cache;
+  entry->normal_cache = VertexLoaderManager::normal_cache;
+  entry->tangent_cache = VertexLoaderManager::tangent_cache;
+  entry->binormal_cache = VertexLoaderManager::binormal_cache;
+  entry->stored = true;
+  m_size += GetEntrySize(*entry);
+}
+
+void DisplayListCache::RestoreLoaderCaches(const Entry& entry)
+{
+  VertexLoaderManager::position_cache = entry.position_cache;
+  if (entry.has_position_matrix_index)
+    VertexLoaderManager::position_matrix_index_cache = entry.position_matrix_index_cache;
+  if (entry.has_normal)
+    VertexLoaderManager::normal_cache = entry.normal_cache;
+  if (entry.has_tangents)
+  {
+    VertexLoaderManager::tangent_cache = entry.tangent_cache;
+    VertexLoaderManager::binormal_cache = entry.binormal_cache;
+  }
+}
+
+void DisplayListCache::Clear()
+{
+  m_entries.clear();
+  m_size = 0;
+}
+
+bool DisplayListCache::IsUnchanged(Entry& entry)
+{
+  for (const Entry::Array& array : entry.arrays)
+  {
+    if (g_main_cp_state.array_bases[array.array] != array.base ||
+        g_main_cp_state.array_strides[array.array] != array.stride)
+    {
+      return false;
+    }
+  }
+
+  auto& memory = Core::System::GetInstance().GetMemory();
+  if (entry.generation &&
+      std::ranges::all_of(entry.ranges, [&](const Entry::Range& range) {
+        return memory.IsUnchangedSince(range.address, range.size, *entry.generation);
+      }))
+  {
+    return true;
+  }
+
+  const std::optional<u64> generation = WatchRanges(entry.ranges);
+  for (const Entry::Range& range : entry.ranges)
+  {
+    u64 hash;
+    if (!HashRange(range, &hash) || hash != range.hash)
+      return false;
+  }
+  entry.generation = generation;
+  return true;
+}
+
+bool DisplayListCache::Prepare(Entry& entry, u32 address, u32 count, u32 vertex_size,
+                               const u8* src, const TVtxDesc& vtx_desc, const VAT& vat)
+{
+  entry.has_position_matrix_index = vtx_desc.low.PosMatIdx;
+  entry.has_normal = vtx_desc.low.Normal != VertexComponentFormat::NotPresent;
+  entry.has_tangents = entry.has_normal && vat.g0.NormalElements == NormalComponentCount::NTB;
+  entry.ranges.push_back({address, count * vertex_size, 0});
+
+  for (const IndexedComponent& component : GetIndexedComponents(vtx_desc, vat))
+  {
+    // The vertex loader skips vertices whose position index has all bits set.
+    const u32 skipped_index = component.array == CPArray::Position ?
+                                  (1u << (component.index_size * 8)) - 1 :
+                                  std::numeric_limits<u32>::max();
+    u32 min_index = std::numeric_limits<u32>::max();
+    u32 max_index = 0;
+    for (u32 i = 0; i < count; i++)
+    {
+      const u8* indices = src + i * vertex_size + component.offset;
+      for (u32 j = 0; j < component.num_indices; j++)
+      {
+        const u32 index = component.index_size == 1 ? indices[j] : Common::swap16(indices + j * 2);
+        if (index == skipped_index)
+          continue;
+        min_index = std::min(min_index, index);
+        max_index = std::max(max_index, index);
+      }
+    }
+    if (min_index > max_index)
+      continue;
+
+    const u32 base = g_main_cp_state.array_bases[component.array];
+    const u32 stride = g_main_cp_state.array_strides[component.array];
+    const u64 size = u64{max_index - min_index} * stride + component.element_size;
+    if (size > MAX_SIZE)
+      return false;
+
+    entry.arrays.push_back({component.array, base, stride});
+    entry.ranges.push_back({base + min_index * stride, static_cast<u32>(size), 0});
+  }
+
+  entry.generation = WatchRanges(entry.ranges);
+  return std::ranges::all_of(entry.ranges,
+                             [](Entry::Range& range) { return HashRange(range, &range.hash); });
+}
+
+std::optional<u64> DisplayListCache::WatchRanges(std::span<const Entry::Range> ranges)
+{
+  if (!g_ActiveConfig.bTextureWriteTracking)
+    return std::nullopt;
+
+  // Watch all of the ranges before hashing any of them, so that every write that the hashes might
+  // not include is newer than the first generation.
+  auto& memory = Core::System::GetInstance().GetMemory();
+  std::optional<u64> first_generation;
+  for (const Entry::Range& range : ranges)
+  {
+    const std::optional<u64> generation = memory.WatchForWrites(range.address, range.size);
+    if (!generation)
+      return std::nullopt;
+    if (!first_generation)
+      first_generation = generation;
+  }
+  return first_generation;
+}
+
+bool DisplayListCache::HashRange(const Entry::Range& range, u64* hash)
+{
+  auto& memory = Core::System::GetInstance().GetMemory();
+  const u8* data = memory.GetPointerForRange(range.address, range.size);
+  if (!data)
+    return false;
+
+  *hash = XXH3_64bits(data, range.size);
+  return true;
+}
+
+size_t DisplayListCache::GetEntrySize(const Entry& entry)
+{
+  return entry.vertices.size() + entry.indices.size() * sizeof(u16);
+}
@@ -0,0 +1,119 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/CPMemory.h"
+#include "VideoCommon/OpcodeDecoding.h"
+
+class VertexLoaderBase;
+
+// Keeps the converted vertices and generated indices of draws in display lists, so that display
+// lists which are called again with the same data, like static geometry that is drawn every frame,
+// don't have to go through the vertex loader and index generator again.
+//
+// A draw is identified by the RAM address of its vertex data, its vertex loader, primitive type
+// and vertex count. It stays valid as long as neither its vertex data nor the parts of the vertex
+// arrays that its indices point to change. This is checked with RAM write tracking, and by hashing
+// the data again if it might have been written to or write tracking isn't available.
+class DisplayListCache
+{
+public:
+  struct Key
+  {
+    u32 address;
+    u32 count;
+    const VertexLoaderBase* loader;
+    OpcodeDecoder::Primitive primitive;
+
+    bool operator==(const Key&) const = default;
+  };
+
+  struct Entry
+  {
+    // The data that the vertex loader and index generator wrote, indices relative to the first
+    // vertex. The vertices are loaded into this directly. The entry can't be used until Store
+    // filled in the rest.
+    std::vector<u8> vertices;
+    std::vector<u16> indices;
+    u32 num_vertices = 0;
+    bool stored = false;
+
+    // What the vertex loader left in VertexLoaderManager's caches of the last vertices.
+    std::array<std::array<float, 4>, 3> position_cache;
+    std::array<u32, 3> position_matrix_index_cache;
+    std::array<float, 4> normal_cache;
+    std::array<float, 4> tangent_cache;
+    std::array<float, 4> binormal_cache;
+    bool has_position_matrix_index = false;
+    bool has_normal = false;
+    bool has_tangents = false;
+
+  private:
+    friend class DisplayListCache;
+
+    struct Range
+    {
+      u32 address;
+      u32 size;
+      u64 hash;
+    };
+    struct Array
+    {
+      CPArray array;
+      u32 base;
+      u32 stride;
+    };
+
+    // The vertex data, followed by the used parts of the vertex arrays.
+    std::vector<Range> ranges;
+    std::vector<Array> arrays;
+    // Writes to the ranges newer than this generation have been recorded. Nothing if writes to the
+    // ranges aren't tracked.
+    std::optional<u64> generation;
+    // Number of times that the data was found to be changed.
+    u32 changes = 0;
+  };
+
+  // Returns the entry for the draw if its data didn't change since it was stored. Otherwise, if the
+  // draw may be cached, sets new_entry to an entry that Store has to be called for once the
+  // vertices are loaded. The entries stay valid until the next call.
+  const Entry* Lookup(const Key& key, const u8* src, const TVtxDesc& vtx_desc, const VAT& vat,
+                      Entry** new_entry);
+  // Completes an entry whose vertices were just loaded, from VertexLoaderManager's caches.
+  void Store(Entry* entry, u32 num_vertices, u32 stride, std::vector<u16> indices);
+  // Writes an entry's state back to VertexLoaderManager's caches, as if its vertices were loaded.
+  static void RestoreLoaderCaches(const Entry& entry);
+
+  void Clear();
+  // Memory used by the vertices and indices of stored entries.
+  size_t GetSize() const { return m_size; }
+
+private:
+  struct KeyHash
+  {
+    size_t operator()(const Key& key) const noexcept;
+  };
+
+  static constexpr size_t MAX_SIZE = 64 * 1024 * 1024;
+  // Draws whose data keeps changing, like skinned meshes, aren't worth hashing and copying.
+  static constexpr u32 MAX_CHANGES = 3;
+
+  static bool IsUnchanged(Entry& entry);
+  static bool Prepare(Entry& entry, u32 address, u32 count, u32 vertex_size, const u8* src,
+                      const TVtxDesc& vtx_desc, const VAT& vat);
+  static std::optional<u64> WatchRanges(std::span<const Entry::Range> ranges);
+  static bool HashRange(const Entry::Range& range, u64* hash);
+  static size_t GetEntrySize(const Entry& entry);
+
+  std::unordered_map<Key, Entry, KeyHash> m_entries;
+  size_t m_size = 0;
+};
@@ -13,6 +13,7 @@
 #include "Common/FPURoundMode.h"
 #include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
+#include "Common/Thread.h"
 
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
@@ -28,6 +29,7 @@
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoBackendBase.h"
@@ -36,8 +38,21 @@ namespace Fifo
 {
 static constexpr int GPU_TIME_SLOT_SIZE = 1000;
 
+// Packets are handed to the GPU thread after each draw, or once they reach this size.
+static constexpr size_t PREPARSE_MAX_PACKET_SIZE = 16 * 1024;
+
+struct FifoManager::PreparseAnchor
+{
+  u32 generation = 0;
+  u32 read_ptr = 0;
+  CPState cp_state;
+  // The start of a command that the GPU thread has read, but not run yet.
+  std::vector<u8> tail;
+};
+
 FifoManager::FifoManager(Core::System& system) : m_system{system}
 {
+  m_preparse_anchor = std::make_unique<PreparseAnchor>();
 }
 
 FifoManager::~FifoManager() = default;
@@ -65,6 +80,9 @@ void FifoManager::DoState(PointerWrap& p)
 
   p.Do(m_sync_ticks);
   p.Do(m_syncing_suspended);
+
+  if (p.IsReadMode())
+    InvalidatePreparsedFifo();
 }
 
 void FifoManager::PauseAndLock(bool do_lock, bool unpause_on_unlock)
@@ -77,6 +95,8 @@ void FifoManager::PauseAndLock(bool do_lock, bool unpause_on_unlock)
     if (!m_system.IsDualCoreMode() || m_use_deterministic_gpu_thread)
       return;
 
+    if (m_use_preparse_thread)
+      m_preparse_loop.WaitYield(std::chrono::milliseconds(100), Host_YieldToUI);
     m_gpu_mainloop.WaitYield(std::chrono::milliseconds(100), Host_YieldToUI);
   }
   else
@@ -91,6 +111,8 @@ void FifoManager::Init()
   if (!m_config_callback_id)
     m_config_callback_id = Config::AddConfigChangedCallback([this] { RefreshConfig(); });
   RefreshConfig();
+  m_use_preparse_thread =
+      Config::Get(Config::MAIN_FIFO_PREPARSE_THREAD) && m_system.IsDualCoreMode();
 
   // Padded so that SIMD overreads in the vertex loader are safe
   m_video_buffer = static_cast<u8*>(Common::AllocateMemoryPages(FIFO_SIZE + 4));
@@ -114,6 +136,12 @@ void FifoManager::Shutdown()
   m_fifo_aux_write_ptr = nullptr;
   m_fifo_aux_read_ptr = nullptr;
 
+  m_preparsed_packets.Clear();
+  m_preparse_free_buffers.Clear();
+  m_preparse_bytes_in_flight = 0;
+  m_preparse_packet = {};
+  m_preparse_buffer = {};
+
   if (m_config_callback_id)
   {
     Config::RemoveConfigChangedCallback(*m_config_callback_id);
@@ -135,15 +163,23 @@ void FifoManager::ExitGpuLoop()
   // Terminate GPU thread loop
   m_emu_running_state.Set();
   m_gpu_mainloop.Stop(Common::BlockingLoop::StopMode::NonBlock);
+  m_preparse_loop.Stop(Common::BlockingLoop::StopMode::NonBlock);
 }
 
 void FifoManager::EmulatorState(bool running)
 {
   m_emu_running_state.Set(running);
   if (running)
+  {
     m_gpu_mainloop.Wakeup();
+    if (m_use_preparse_thread)
+      m_preparse_loop.Wakeup();
+  }
   else
+  {
     m_gpu_mainloop.AllowSleep();
+    m_preparse_loop.AllowSleep();
+  }
 }
 
 void FifoManager::SyncGPU(SyncGPUReason reason, bool may_move_read_ptr)
@@ -213,29 +249,46 @@ void* FifoManager::PopFifoAuxBuffer(size_t size)
   return ret;
 }
 
-// Description: RunGpuLoop() sends data through this function.
-void FifoManager::ReadDataFromFifo(u32 read_ptr)
+// Moves the data that hasn't been run yet to the start of m_video_buffer if size bytes don't fit
+// after it. Returns false if they don't fit at all.
+bool FifoManager::MakeRoomInVideoBuffer(size_t size)
 {
-  if (GPFifo::GATHER_PIPE_SIZE >
-      static_cast<size_t>(m_video_buffer + FIFO_SIZE - m_video_buffer_write_ptr))
+  if (size > static_cast<size_t>(m_video_buffer + FIFO_SIZE - m_video_buffer_write_ptr))
   {
     const size_t existing_len = m_video_buffer_write_ptr - m_video_buffer_read_ptr;
-    if (GPFifo::GATHER_PIPE_SIZE > static_cast<size_t>(FIFO_SIZE - existing_len))
+    if (size > static_cast<size_t>(FIFO_SIZE - existing_len))
     {
-      PanicAlertFmt("FIFO out of bounds (existing {} + new {} > {})", existing_len,
-                    GPFifo::GATHER_PIPE_SIZE, FIFO_SIZE);
-      return;
+      PanicAlertFmt("FIFO out of bounds (existing {} + new {} > {})", existing_len, size,
+                    FIFO_SIZE);
+      return false;
     }
     memmove(m_video_buffer, m_video_buffer_read_ptr, existing_len);
     m_video_buffer_write_ptr = m_video_buffer + existing_len;
     m_video_buffer_read_ptr = m_video_buffer;
   }
+  return true;
+}
+
+// Description: RunGpuLoop() sends data through this function.
+void FifoManager::ReadDataFromFifo(u32 read_ptr)
+{
+  if (!MakeRoomInVideoBuffer(GPFifo::GATHER_PIPE_SIZE))
+    return;
   // Copy new video instructions to m_video_buffer for future use in rendering the new picture
   auto& memory = m_system.GetMemory();
   memory.CopyFromEmu(m_video_buffer_write_ptr, read_ptr, GPFifo::GATHER_PIPE_SIZE);
   m_video_buffer_write_ptr += GPFifo::GATHER_PIPE_SIZE;
 }
 
+// The pre-parse thread version.
+void FifoManager::ReadDataFromPacket(const std::vector<u8>& data)
+{
+  if (!MakeRoomInVideoBuffer(data.size()))
+    return;
+  std::memcpy(m_video_buffer_write_ptr, data.data(), data.size());
+  m_video_buffer_write_ptr += data.size();
+}
+
 // The deterministic_gpu_thread version.
 void FifoManager::ReadDataFromFifoOnCPU(u32 read_ptr)
 {
@@ -281,6 +334,7 @@ void FifoManager::ResetVideoBuffer()
   m_video_buffer_pp_read_ptr = m_video_buffer;
   m_fifo_aux_write_ptr = m_fifo_aux_data;
   m_fifo_aux_read_ptr = m_fifo_aux_data;
+  InvalidatePreparsedFifo();
 }
 
 // Description: Main FIFO update loop
@@ -290,6 +344,14 @@ void FifoManager::RunGpuLoop()
   AsyncRequests::GetInstance()->SetEnable(true);
   AsyncRequests::GetInstance()->SetPassthrough(false);
 
+  if (m_use_preparse_thread)
+  {
+    // Prepared here so that ExitGpuLoop can stop it even before the thread starts running it.
+    m_preparse_loop.Prepare();
+    InvalidatePreparsedFifo();
+    m_preparse_thread = std::thread(&FifoManager::RunPreparseLoop, this);
+  }
+
   m_gpu_mainloop.Run(
       [this] {
         // Run events from the CPU thread.
@@ -318,6 +380,8 @@ void FifoManager::RunGpuLoop()
           auto& fifo = command_processor.GetFifo();
           command_processor.SetCPStatusFromGPU();
 
+          bool waiting_for_preparse = false;
+
           // check if we are able to run this buffer
           while (!command_processor.IsInterruptWaiting() &&
                  fifo.bFF_GPReadEnable.load(std::memory_order_relaxed) &&
@@ -329,16 +393,28 @@ void FifoManager::RunGpuLoop()
 
             u32 cyclesExecuted = 0;
             u32 readPtr = fifo.CPReadPointer.load(std::memory_order_relaxed);
-            ReadDataFromFifo(readPtr);
-
-            if (readPtr == fifo.CPEnd.load(std::memory_order_relaxed))
-              readPtr = fifo.CPBase.load(std::memory_order_relaxed);
+            u32 read_size = GPFifo::GATHER_PIPE_SIZE;
+            if (m_use_preparse_thread)
+            {
+              if (!ReadPreparsedPacket(readPtr, &readPtr, &read_size))
+              {
+                waiting_for_preparse = true;
+                break;
+              }
+            }
             else
-              readPtr += GPFifo::GATHER_PIPE_SIZE;
+            {
+              ReadDataFromFifo(readPtr);
+
+              if (readPtr == fifo.CPEnd.load(std::memory_order_relaxed))
+                readPtr = fifo.CPBase.load(std::memory_order_relaxed);
+              else
+                readPtr += GPFifo::GATHER_PIPE_SIZE;
+            }
 
             const s32 distance =
                 static_cast<s32>(fifo.CPReadWriteDistance.load(std::memory_order_relaxed)) -
-                GPFifo::GATHER_PIPE_SIZE;
+                static_cast<s32>(read_size);
             ASSERT_MSG(COMMANDPROCESSOR, distance >= 0,
                        "Negative fifo.CPReadWriteDistance = {} in FIFO Loop !\nThat can produce "
                        "instability in the game. Please report it.",
@@ -349,7 +425,12 @@ void FifoManager::RunGpuLoop()
                 DataReader(m_video_buffer_read_ptr, write_ptr), &cyclesExecuted);
 
             fifo.CPReadPointer.store(readPtr, std::memory_order_relaxed);
-            fifo.CPReadWriteDistance.fetch_sub(GPFifo::GATHER_PIPE_SIZE, std::memory_order_seq_cst);
+            fifo.CPReadWriteDistance.fetch_sub(read_size, std::memory_order_seq_cst);
+            if (m_use_preparse_thread)
+            {
+              RetirePreparsedPacket(read_size,
+                                    static_cast<u32>(write_ptr - m_video_buffer_read_ptr));
+            }
             if ((write_ptr - m_video_buffer_read_ptr) == 0)
             {
               fifo.SafeCPReadPointer.store(fifo.CPReadPointer.load(std::memory_order_relaxed),
@@ -376,6 +457,14 @@ void FifoManager::RunGpuLoop()
             AsyncRequests::GetInstance()->PullEvents();
           }
 
+          // The FIFO isn't empty, the pre-parse thread just hasn't caught up with it yet. It wakes
+          // this loop up again once it has pushed the next packet.
+          if (waiting_for_preparse)
+          {
+            m_preparse_loop.Wakeup();
+            return;
+          }
+
           // fast skip remaining GPU time if fifo is empty
           if (m_sync_ticks.load() > 0)
           {
@@ -392,21 +481,245 @@ void FifoManager::RunGpuLoop()
       },
       100);
 
+  if (m_preparse_thread.joinable())
+  {
+    m_preparse_loop.Stop(Common::BlockingLoop::StopMode::NonBlock);
+    m_preparse_thread.join();
+  }
+
   AsyncRequests::GetInstance()->SetEnable(false);
   AsyncRequests::GetInstance()->SetPassthrough(true);
 }
 
+void FifoManager::RunPreparseLoop()
+{
+  Common::SetCurrentThreadName("FIFO pre-parse thread");
+
+  m_preparse_loop.Run(
+      [this] {
+        // The CPU thread preprocesses the FIFO itself in deterministic GPU thread mode.
+        if (!m_emu_running_state.IsSet() || m_use_deterministic_gpu_thread)
+          return;
+
+        PreparseFifo();
+      },
+      100);
+}
+
+void FifoManager::PreparseFifo()
+{
+  auto& command_processor = m_system.GetCommandProcessor();
+  const auto& fifo = command_processor.GetFifo();
+  auto& memory = m_system.GetMemory();
+
+  while (true)
+  {
+    const u32 generation = m_preparse_generation.load(std::memory_order_acquire);
+    if (generation != m_preparse_thread_generation)
+    {
+      // Restart from where the GPU thread is, once it has dropped the old packets.
+      std::lock_guard lk(m_preparse_anchor_lock);
+      if (m_preparse_anchor->generation != generation)
+        return;
+
+      std::memcpy(static_cast<void*>(&g_preprocess_cp_state),
+                  static_cast<const void*>(&m_preparse_anchor->cp_state), sizeof(CPState));
+      VertexLoaderManager::g_preprocess_vat_dirty = BitSet8::AllTrue(CP_NUM_VAT_REG);
+      m_preparse_buffer = m_preparse_anchor->tail;
+      m_preparse_read_ptr = m_preparse_anchor->read_ptr;
+      m_preparse_packet.data.clear();
+      m_preparse_thread_generation = generation;
+    }
+
+    if (!fifo.bFF_GPReadEnable.load(std::memory_order_relaxed) ||
+        (fifo.bFF_BPEnable.load(std::memory_order_relaxed) &&
+         m_preparse_read_ptr == fifo.CPBreakpoint.load(std::memory_order_relaxed)))
+    {
+      break;
+    }
+
+    // The GPU thread lowers the distance before the bytes in flight, so reading them in the other
+    // order can only make the available size seem smaller than it is.
+    const u32 in_flight = m_preparse_bytes_in_flight.load();
+    const u32 distance = fifo.CPReadWriteDistance.load();
+    const u32 packet_size = static_cast<u32>(m_preparse_packet.data.size());
+    if (in_flight + packet_size + GPFifo::GATHER_PIPE_SIZE > distance)
+      break;
+
+    if (packet_size == 0)
+      m_preparse_packet.read_ptr = m_preparse_read_ptr;
+    m_preparse_packet.data.resize(packet_size + GPFifo::GATHER_PIPE_SIZE);
+    u8* const block = m_preparse_packet.data.data() + packet_size;
+    memory.CopyFromEmu(block, m_preparse_read_ptr, GPFifo::GATHER_PIPE_SIZE);
+    m_preparse_buffer.insert(m_preparse_buffer.end(), block, block + GPFifo::GATHER_PIPE_SIZE);
+
+    if (m_preparse_read_ptr == fifo.CPEnd.load(std::memory_order_relaxed))
+      m_preparse_read_ptr = fifo.CPBase.load(std::memory_order_relaxed);
+    else
+      m_preparse_read_ptr += GPFifo::GATHER_PIPE_SIZE;
+
+    u32 draws = 0;
+    const u32 parsed_size = OpcodeDecoder::PreparseFifo(
+        m_preparse_buffer.data(), static_cast<u32>(m_preparse_buffer.size()), &draws);
+    m_preparse_buffer.erase(m_preparse_buffer.begin(), m_preparse_buffer.begin() + parsed_size);
+
+    // No command is this large, so the CP state must have gone wrong somewhere.
+    if (m_preparse_buffer.size() > FIFO_SIZE)
+    {
+      InvalidatePreparsedFifo();
+      continue;
+    }
+
+    if (draws != 0 || m_preparse_packet.data.size() >= PREPARSE_MAX_PACKET_SIZE)
+      PushPreparsedPacket();
+  }
+
+  if (!m_preparse_packet.data.empty())
+    PushPreparsedPacket();
+}
+
+void FifoManager::PushPreparsedPacket()
+{
+  m_preparse_packet.next_read_ptr = m_preparse_read_ptr;
+  m_preparse_packet.tail_size = static_cast<u32>(m_preparse_buffer.size());
+  m_preparse_packet.generation = m_preparse_thread_generation;
+  m_preparse_bytes_in_flight.fetch_add(static_cast<u32>(m_preparse_packet.data.size()));
+  m_preparsed_packets.Push(std::move(m_preparse_packet));
+
+  m_preparse_packet = {};
+  m_preparse_free_buffers.Pop(m_preparse_packet.data);
+  m_preparse_packet.data.clear();
+
+  m_gpu_mainloop.Wakeup();
+}
+
+bool FifoManager::ReadPreparsedPacket(u32 read_ptr, u32* next_read_ptr, u32* size)
+{
+  const auto& fifo = m_system.GetCommandProcessor().GetFifo();
+  while (true)
+  {
+    const u32 generation = m_preparse_generation.load(std::memory_order_acquire);
+    if (generation != m_gpu_preparse_generation)
+      AnchorPreparse(generation);
+    if (m_preparsed_packets.Empty())
+      return false;
+
+    const PreparsedPacket& packet = m_preparsed_packets.Front();
+    if (packet.generation != generation)
+    {
+      DropPreparsedPacket();
+      continue;
+    }
+
+    // The CPU has moved the read pointer or emptied the FIFO since the packet was read.
+    if (packet.read_ptr != read_ptr ||
+        packet.data.size() > fifo.CPReadWriteDistance.load(std::memory_order_relaxed) ||
+        PacketContainsBreakpoint(packet))
+    {
+      InvalidatePreparsedFifo();
+      continue;
+    }
+
+    ReadDataFromPacket(packet.data);
+    *next_read_ptr = packet.next_read_ptr;
+    *size = static_cast<u32>(packet.data.size());
+    m_preparsed_tail_size = packet.tail_size;
+
+    // The bytes stay in flight until the packet has been run, see RetirePreparsedPacket.
+    m_preparse_free_buffers.Push(std::move(m_preparsed_packets.Front().data));
+    m_preparsed_packets.Pop();
+    return true;
+  }
+}
+
+void FifoManager::RetirePreparsedPacket(u32 size, u32 tail_size)
+{
+  m_preparse_bytes_in_flight.fetch_sub(size);
+  // The pre-parse thread may have stopped because too many bytes were in flight.
+  m_preparse_loop.Wakeup();
+  INCSTAT(g_stats.this_frame.num_preparsed_packets);
+
+  // If the GPU thread stopped somewhere else in the packet, the pre-parse thread followed another
+  // CP state, like when a display list changed after it was read. Restart it from here.
+  if (tail_size != m_preparsed_tail_size)
+  {
+    INCSTAT(g_stats.this_frame.num_preparse_restarts);
+    InvalidatePreparsedFifo();
+  }
+}
+
+void FifoManager::DropPreparsedPacket()
+{
+  PreparsedPacket& packet = m_preparsed_packets.Front();
+  m_preparse_bytes_in_flight.fetch_sub(static_cast<u32>(packet.data.size()));
+  m_preparse_free_buffers.Push(std::move(packet.data));
+  m_preparsed_packets.Pop();
+  m_preparse_loop.Wakeup();
+}
+
+void FifoManager::AnchorPreparse(u32 generation)
+{
+  while (!m_preparsed_packets.Empty())
+    DropPreparsedPacket();
+
+  {
+    const auto& fifo = m_system.GetCommandProcessor().GetFifo();
+    std::lock_guard lk(m_preparse_anchor_lock);
+    m_preparse_anchor->generation = generation;
+    m_preparse_anchor->read_ptr = fifo.CPReadPointer.load(std::memory_order_relaxed);
+    std::memcpy(static_cast<void*>(&m_preparse_anchor->cp_state),
+                static_cast<const void*>(&g_main_cp_state), sizeof(CPState));
+    m_preparse_anchor->tail.assign(m_video_buffer_read_ptr, m_video_buffer_write_ptr.load());
+  }
+  m_gpu_preparse_generation = generation;
+  m_preparse_loop.Wakeup();
+}
+
+bool FifoManager::PacketContainsBreakpoint(const PreparsedPacket& packet) const
+{
+  const auto& fifo = m_system.GetCommandProcessor().GetFifo();
+  if (!fifo.bFF_BPEnable.load(std::memory_order_relaxed))
+    return false;
+
+  // The loop in RunGpuLoop already checks the first block.
+  const u32 breakpoint = fifo.CPBreakpoint.load(std::memory_order_relaxed);
+  u32 read_ptr = packet.read_ptr;
+  for (size_t i = GPFifo::GATHER_PIPE_SIZE; i < packet.data.size(); i += GPFifo::GATHER_PIPE_SIZE)
+  {
+    if (read_ptr == fifo.CPEnd.load(std::memory_order_relaxed))
+      read_ptr = fifo.CPBase.load(std::memory_order_relaxed);
+    else
+      read_ptr += GPFifo::GATHER_PIPE_SIZE;
+    if (read_ptr == breakpoint)
+      return true;
+  }
+  return false;
+}
+
+void FifoManager::InvalidatePreparsedFifo()
+{
+  if (!m_use_preparse_thread)
+    return;
+
+  m_preparse_generation.fetch_add(1, std::memory_order_acq_rel);
+  // The GPU thread has to hand the pre-parse thread a new anchor before it can continue.
+  m_gpu_mainloop.Wakeup();
+}
+
 void FifoManager::FlushGpu()
 {
   if (!m_system.IsDualCoreMode() || m_use_deterministic_gpu_thread)
     return;
 
+  if (m_use_preparse_thread)
+    m_preparse_loop.Wait();
   m_gpu_mainloop.Wait();
 }
 
 void FifoManager::GpuMaySleep()
 {
   m_gpu_mainloop.AllowSleep();
+  m_preparse_loop.AllowSleep();
 }
 
 bool AtBreakpoint(Core::System& system)
@@ -426,6 +739,8 @@ void FifoManager::RunGpu()
   if (is_dual_core && !m_use_deterministic_gpu_thread)
   {
     m_gpu_mainloop.Wakeup();
+    if (m_use_preparse_thread)
+      m_preparse_loop.Wakeup();
   }
 
   // if the sync GPU callback is suspended, wake it up.
@@ -532,6 +847,8 @@ void FifoManager::UpdateWantDeterminism(bool want)
       CopyPreprocessCPStateFromMain();
       VertexLoaderManager::MarkAllDirty();
     }
+    // Either way, the preprocess CP state no longer matches what the pre-parse thread read.
+    InvalidatePreparsedFifo();
   }
 }
 
@@ -5,13 +5,18 @@
 
 #include <atomic>
 #include <cstddef>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <thread>
+#include <vector>
 
 #include "Common/BlockingLoop.h"
 #include "Common/CommonTypes.h"
 #include "Common/Config/Config.h"
 #include "Common/Event.h"
 #include "Common/Flag.h"
+#include "Common/SPSCQueue.h"
 
 class PointerWrap;
 
@@ -64,6 +69,10 @@ public:
   // In dual core mode, this synchronizes with the GPU thread.
   void SyncGPUForRegisterAccess();
 
+  // Drops the FIFO data that the pre-parse thread has read ahead of the GPU thread. Needed when the
+  // read pointer is moved, as the memory after it may hold other commands then.
+  void InvalidatePreparsedFifo();
+
   void PushFifoAuxBuffer(const void* ptr, size_t size);
   void* PopFifoAuxBuffer(size_t size);
 
@@ -76,13 +85,38 @@ public:
   void ResetVideoBuffer();
 
 private:
+  // A run of whole 32-byte blocks from the FIFO that the pre-parse thread hands to the GPU thread.
+  // Runs end after a draw where possible, so that the GPU thread can start on it right away.
+  struct PreparsedPacket
+  {
+    std::vector<u8> data;
+    // Emulated addresses of the first block and of the block after the last one.
+    u32 read_ptr = 0;
+    u32 next_read_ptr = 0;
+    // Number of bytes at the end that belong to a command which isn't complete yet.
+    u32 tail_size = 0;
+    u32 generation = 0;
+  };
+  struct PreparseAnchor;
+
   void RefreshConfig();
+  bool MakeRoomInVideoBuffer(size_t size);
   void ReadDataFromFifo(u32 read_ptr);
+  void ReadDataFromPacket(const std::vector<u8>& data);
   void ReadDataFromFifoOnCPU(u32 read_ptr);
   int RunGpuOnCpu(int ticks);
   int WaitForGpuThread(int ticks);
   static void SyncGPUCallback(Core::System& system, u64 ticks, s64 cyclesLate);
 
+  void RunPreparseLoop();
+  void PreparseFifo();
+  void PushPreparsedPacket();
+  bool ReadPreparsedPacket(u32 read_ptr, u32* next_read_ptr, u32* size);
+  void RetirePreparsedPacket(u32 size, u32 tail_size);
+  void DropPreparsedPacket();
+  void AnchorPreparse(u32 generation);
+  bool PacketContainsBreakpoint(const PreparsedPacket& packet) const;
+
   static constexpr u32 FIFO_SIZE = 2 * 1024 * 1024;
 
   Common::BlockingLoop m_gpu_mainloop;
@@ -118,6 +152,32 @@ private:
   // polls, it's just atomic.
   // - The pp_read_ptr is the CPU preprocessing version of the read_ptr.
 
+  // In dual core mode, the pre-parse thread can read the FIFO ahead of the GPU thread and split it
+  // into packets, so that the GPU thread only has to run them. The CP registers are only updated
+  // once the GPU thread has run a packet, so dropping packets is always safe:
+  // - m_preparse_generation is increased to drop all packets read so far. The GPU thread then
+  // hands the pre-parse thread an anchor to restart from: the read pointer, the CP state and
+  // the part of a command that it has already read.
+  // - m_preparse_bytes_in_flight counts the bytes in packets that the GPU thread hasn't run or
+  // dropped yet, which the pre-parse thread must not read again.
+  bool m_use_preparse_thread = false;
+  Common::BlockingLoop m_preparse_loop;
+  std::thread m_preparse_thread;
+  Common::SPSCQueue<PreparsedPacket> m_preparsed_packets;
+  Common::SPSCQueue<std::vector<u8>> m_preparse_free_buffers;
+  std::atomic<u32> m_preparse_generation = 0;
+  std::atomic<u32> m_preparse_bytes_in_flight = 0;
+  std::mutex m_preparse_anchor_lock;
+  std::unique_ptr<PreparseAnchor> m_preparse_anchor;
+  // Owned by the GPU thread.
+  u32 m_gpu_preparse_generation = 0;
+  u32 m_preparsed_tail_size = 0;
+  // Owned by the pre-parse thread.
+  u32 m_preparse_thread_generation = 0;
+  u32 m_preparse_read_ptr = 0;
+  PreparsedPacket m_preparse_packet;
+  std::vector<u8> m_preparse_buffer;
+
   std::atomic<int> m_sync_ticks = 0;
   bool m_syncing_suspended = false;
   Common::Event m_sync_wakeup_event;
@@ -3,6 +3,7 @@
 
 #include "VideoCommon/FramebufferManager.h"
 
+#include <algorithm>
 #include <fmt/format.h>
 #include <memory>
 
@@ -22,6 +23,7 @@
 #include "VideoCommon/FramebufferShaderGen.h"
 #include "VideoCommon/PixelShaderManager.h"
 #include "VideoCommon/Present.h"
+#include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
@@ -29,6 +31,9 @@
 // Maximum number of pixels poked in one batch * 6
 constexpr size_t MAX_POKE_VERTICES = 32768;
 
+// Maximum number of frames that EFB peeks may lag behind
+constexpr u32 MAX_EFB_CACHE_LATENCY = 4;
+
 std::unique_ptr<FramebufferManager> g_framebuffer_manager;
 
 FramebufferManager::FramebufferManager() : m_prev_efb_format(PixelFormat::INVALID_FMT)
@@ -54,6 +59,8 @@ bool FramebufferManager::Initialize()
   }
 
   m_efb_cache_tile_size = static_cast<u32>(std::max(g_ActiveConfig.iEFBAccessTileSize, 0));
+  m_efb_cache_latency = static_cast<u32>(
+      std::clamp(g_ActiveConfig.iEFBAccessLatency, 0, static_cast<int>(MAX_EFB_CACHE_LATENCY)));
   if (!CreateReadbackFramebuffer())
   {
     PanicAlertFmt("Failed to create EFB readback framebuffer");
@@ -481,20 +488,8 @@ u32 FramebufferManager::PeekEFBColor(u32 x, u32 y)
   if (g_backend_info.bUsesLowerLeftOrigin)
     y = EFB_HEIGHT - 1 - y;
 
-  u32 tile_index;
-  if (!IsEFBCacheTilePresent(false, x, y, &tile_index))
-    PopulateEFBCache(false, tile_index);
-
-  m_efb_color_cache.tiles[tile_index].frame_access_mask |= 1;
-
-  if (m_efb_color_cache.needs_flush)
-  {
-    m_efb_color_cache.readback_texture->Flush();
-    m_efb_color_cache.needs_flush = false;
-  }
-
   u32 value;
-  m_efb_color_cache.readback_texture->ReadTexel(x, y, &value);
+  GetEFBCacheReadbackTexture(false, x, y)->ReadTexel(x, y, &value);
   return value;
 }
 
@@ -504,21 +499,37 @@ float FramebufferManager::PeekEFBDepth(u32 x, u32 y)
   if (g_backend_info.bUsesLowerLeftOrigin)
     y = EFB_HEIGHT - 1 - y;
 
+  float value;
+  GetEFBCacheReadbackTexture(true, x, y)->ReadTexel(x, y, &value);
+  return value;
+}
+
+AbstractStagingTexture* FramebufferManager::GetEFBCacheReadbackTexture(bool depth, u32 x, u32 y)
+{
+  EFBCacheData& data = depth ? m_efb_depth_cache : m_efb_color_cache;
   u32 tile_index;
-  if (!IsEFBCacheTilePresent(true, x, y, &tile_index))
-    PopulateEFBCache(true, tile_index);
+  const bool present = IsEFBCacheTilePresent(depth, x, y, &tile_index);
+  data.tiles[tile_index].frame_access_mask |= 1;
+
+  if (!present)
+  {
+    // A tile that was read back in an earlier frame doesn't have to wait for the GPU.
+    if (AbstractStagingTexture* prefetched = GetPrefetchedEFBCacheTile(depth, tile_index))
+    {
+      INCSTAT(g_stats.this_frame.num_efb_peeks_prefetched);
+      return prefetched;
+    }
 
-  m_efb_depth_cache.tiles[tile_index].frame_access_mask |= 1;
+    PopulateEFBCache(depth, tile_index);
+  }
 
-  if (m_efb_depth_cache.needs_flush)
+  if (data.needs_flush)
   {
-    m_efb_depth_cache.readback_texture->Flush();
-    m_efb_depth_cache.needs_flush = false;
+    data.readback_texture->Flush();
+    data.needs_flush = false;
   }
 
-  float value;
-  m_efb_depth_cache.readback_texture->ReadTexel(x, y, &value);
-  return value;
+  return data.readback_texture.get();
 }
 
 void FramebufferManager::SetEFBCacheTileSize(u32 size)
@@ -533,8 +544,26 @@ void FramebufferManager::SetEFBCacheTileSize(u32 size)
     PanicAlertFmt("Failed to create EFB readback framebuffers");
 }
 
+void FramebufferManager::SetEFBCacheLatency(u32 frames)
+{
+  frames = std::min(frames, MAX_EFB_CACHE_LATENCY);
+  if (m_efb_cache_latency == frames)
+    return;
+
+  m_efb_cache_latency = frames;
+  if (!CreateEFBCachePrefetches())
+    PanicAlertFmt("Failed to create EFB readback framebuffers");
+}
+
 void FramebufferManager::RefreshPeekCache()
 {
+  // Tiles are read back for later frames instead, peeks in the current frame don't wait for them.
+  if (m_efb_cache_latency != 0)
+  {
+    PrefetchEFBCache();
+    return;
+  }
+
   if (!m_efb_color_cache.needs_refresh && !m_efb_depth_cache.needs_refresh)
   {
     // The cache has already been refreshed.
@@ -601,6 +630,9 @@ void FramebufferManager::InvalidatePeekCache(bool forced)
 
 void FramebufferManager::FlagPeekCacheAsOutOfDate()
 {
+  m_efb_color_cache.prefetch_out_of_date = true;
+  m_efb_depth_cache.prefetch_out_of_date = true;
+
   if (m_efb_color_cache.has_active_tiles)
     m_efb_color_cache.out_of_date = true;
   if (m_efb_depth_cache.has_active_tiles)
@@ -617,6 +649,8 @@ void FramebufferManager::EndOfFrame()
     m_efb_color_cache.tiles[i].frame_access_mask <<= 1;
     m_efb_depth_cache.tiles[i].frame_access_mask <<= 1;
   }
+
+  m_efb_cache_frame++;
 }
 
 bool FramebufferManager::CompileReadbackPipelines()
@@ -767,9 +801,107 @@ bool FramebufferManager::CreateReadbackFramebuffer()
   m_efb_depth_cache.tiles.resize(total_tiles);
   std::ranges::fill(m_efb_depth_cache.tiles, EFBCacheTile{false, 0});
 
+  return CreateEFBCachePrefetches();
+}
+
+bool FramebufferManager::CreateEFBCachePrefetches()
+{
+  // The prefetch of the current frame is still being written to, so the oldest one that is within
+  // the latency budget needs one more.
+  const u32 count = m_efb_cache_latency != 0 ? m_efb_cache_latency + 1 : 0;
+  for (EFBCacheData* data : {&m_efb_color_cache, &m_efb_depth_cache})
+  {
+    const AbstractTextureFormat format =
+        data == &m_efb_depth_cache ? GetEFBDepthCopyFormat() : GetEFBColorFormat();
+    data->prefetches.clear();
+    data->prefetches.resize(count);
+    for (EFBCachePrefetch& prefetch : data->prefetches)
+    {
+      prefetch.readback_texture = g_gfx->CreateStagingTexture(
+          StagingTextureType::Mutable, TextureConfig(EFB_WIDTH, EFB_HEIGHT, 1, 1, 1, format, 0,
+                                                     AbstractTextureType::Texture_2DArray));
+      if (!prefetch.readback_texture)
+        return false;
+
+      prefetch.tiles.assign(data->tiles.size(), false);
+      prefetch.frame = 0;
+      prefetch.needs_flush = false;
+    }
+    data->prefetch_out_of_date = true;
+  }
+
   return true;
 }
 
+void FramebufferManager::PrefetchEFBCache()
+{
+  bool flush_command_buffer = false;
+  for (const bool depth : {false, true})
+  {
+    EFBCacheData& data = depth ? m_efb_depth_cache : m_efb_color_cache;
+    EFBCachePrefetch& prefetch = data.prefetches[m_efb_cache_frame % data.prefetches.size()];
+    if (prefetch.frame != m_efb_cache_frame)
+    {
+      prefetch.frame = m_efb_cache_frame;
+      prefetch.tiles.assign(prefetch.tiles.size(), false);
+    }
+
+    // Tiles are copied again when the EFB was drawn to since, so that the last copy of the frame
+    // matches what the game saw at the end of it.
+    for (u32 i = 0; i < data.tiles.size(); i++)
+    {
+      if (data.tiles[i].frame_access_mask == 0 ||
+          (prefetch.tiles[i] && !data.prefetch_out_of_date))
+      {
+        continue;
+      }
+
+      CopyEFBCacheTile(depth, i, prefetch.readback_texture.get());
+      INCSTAT(g_stats.this_frame.num_efb_peek_prefetches);
+      prefetch.tiles[i] = true;
+      prefetch.needs_flush = true;
+      flush_command_buffer = true;
+    }
+    data.prefetch_out_of_date = false;
+  }
+
+  if (flush_command_buffer)
+    g_gfx->Flush();
+}
+
+AbstractStagingTexture* FramebufferManager::GetPrefetchedEFBCacheTile(bool depth, u32 tile_index)
+{
+  // Prefer the oldest prefetch within the latency budget, as the GPU is the most likely to have
+  // finished copying it.
+  EFBCacheData& data = depth ? m_efb_depth_cache : m_efb_color_cache;
+  for (u32 age = m_efb_cache_latency; age > 0; age--)
+  {
+    if (age > m_efb_cache_frame)
+      continue;
+
+    const u64 frame = m_efb_cache_frame - age;
+    EFBCachePrefetch& prefetch = data.prefetches[frame % data.prefetches.size()];
+    if (prefetch.frame != frame || !prefetch.tiles[tile_index])
+      continue;
+
+    if (prefetch.needs_flush)
+    {
+      prefetch.readback_texture->Flush();
+      prefetch.needs_flush = false;
+    }
+    return prefetch.readback_texture.get();
+  }
+
+  return nullptr;
+}
+
+void FramebufferManager::DiscardPrefetchedEFBCacheTile(bool depth, u32 tile_index)
+{
+  EFBCacheData& data = depth ? m_efb_depth_cache : m_efb_color_cache;
+  for (EFBCachePrefetch& prefetch : data.prefetches)
+    prefetch.tiles[tile_index] = false;
+}
+
 void FramebufferManager::DestroyReadbackFramebuffer()
 {
   auto DestroyCache = [](EFBCacheData& data) {
@@ -778,12 +910,35 @@ void FramebufferManager::DestroyReadbackFramebuffer()
     data.texture.reset();
     data.needs_refresh = false;
     data.has_active_tiles = false;
+    data.prefetches.clear();
   };
   DestroyCache(m_efb_color_cache);
   DestroyCache(m_efb_depth_cache);
 }
 
 void FramebufferManager::PopulateEFBCache(bool depth, u32 tile_index, bool async)
+{
+  EFBCacheData& data = depth ? m_efb_depth_cache : m_efb_color_cache;
+  CopyEFBCacheTile(depth, tile_index, data.readback_texture.get());
+
+  // Wait until the copy is complete.
+  if (!async)
+  {
+    INCSTAT(g_stats.this_frame.num_efb_peek_readbacks);
+    data.readback_texture->Flush();
+    data.needs_flush = false;
+  }
+  else
+  {
+    data.needs_flush = true;
+  }
+  data.has_active_tiles = true;
+  data.out_of_date = false;
+  data.tiles[tile_index].present = true;
+}
+
+void FramebufferManager::CopyEFBCacheTile(bool depth, u32 tile_index,
+                                          AbstractStagingTexture* readback_texture)
 {
   FlushEFBPokes();
   g_vertex_manager->OnCPUEFBAccess();
@@ -829,7 +984,7 @@ void FramebufferManager::PopulateEFBCache(bool depth, u32 tile_index, bool async
 
     // Copy from EFB or copy texture to staging texture.
     // No need to call FinishedRendering() here because CopyFromTexture() transitions.
-    data.readback_texture->CopyFromTexture(
+    readback_texture->CopyFromTexture(
         data.texture.get(), MathUtil::Rectangle<int>(0, 0, rect.GetWidth(), rect.GetHeight()), 0, 0,
         rect);
 
@@ -837,22 +992,8 @@ void FramebufferManager::PopulateEFBCache(bool depth, u32 tile_index, bool async
   }
   else
   {
-    data.readback_texture->CopyFromTexture(src_texture, rect, 0, 0, rect);
+    readback_texture->CopyFromTexture(src_texture, rect, 0, 0, rect);
   }
-
-  // Wait until the copy is complete.
-  if (!async)
-  {
-    data.readback_texture->Flush();
-    data.needs_flush = false;
-  }
-  else
-  {
-    data.needs_flush = true;
-  }
-  data.has_active_tiles = true;
-  data.out_of_date = false;
-  data.tiles[tile_index].present = true;
 }
 
 void FramebufferManager::ClearEFB(const MathUtil::Rectangle<int>& rc, bool color_enable,
@@ -961,6 +1102,7 @@ void FramebufferManager::PokeEFBColor(u32 x, u32 y, u32 color)
   u32 tile_index;
   if (IsEFBCacheTilePresent(false, x, y, &tile_index))
     m_efb_color_cache.readback_texture->WriteTexel(x, y, &color);
+  DiscardPrefetchedEFBCacheTile(false, tile_index);
 }
 
 void FramebufferManager::PokeEFBDepth(u32 x, u32 y, float depth)
@@ -979,6 +1121,7 @@ void FramebufferManager::PokeEFBDepth(u32 x, u32 y, float depth)
   u32 tile_index;
   if (IsEFBCacheTilePresent(true, x, y, &tile_index))
     m_efb_depth_cache.readback_texture->WriteTexel(x, y, &depth);
+  DiscardPrefetchedEFBCacheTile(true, tile_index);
 }
 
 void FramebufferManager::CreatePokeVertices(std::vector<EFBPokeVertex>* destination_list, u32 x,
@@ -1141,6 +1284,11 @@ void FramebufferManager::DoLoadState(PointerWrap& p)
 {
   // Invalidate any peek cache tiles.
   InvalidatePeekCache(true);
+  for (EFBCacheData* data : {&m_efb_color_cache, &m_efb_depth_cache})
+  {
+    for (EFBCachePrefetch& prefetch : data->prefetches)
+      prefetch.tiles.assign(prefetch.tiles.size(), false);
+  }
 
   // Deserialize the color and depth textures. This could fail.
   auto color_tex = g_texture_cache->DeserializeTexture(p);
@@ -7,6 +7,7 @@
 #include <memory>
 #include <optional>
 #include <tuple>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/EnumFormatter.h"
@@ -118,6 +119,9 @@ public:
   u32 PeekEFBColor(u32 x, u32 y);
   float PeekEFBDepth(u32 x, u32 y);
   void SetEFBCacheTileSize(u32 size);
+  // Allows peeks to return values that are up to the given number of frames old, which are read
+  // back ahead of time for tiles that were peeked recently. 0 reads back the current values.
+  void SetEFBCacheLatency(u32 frames);
   void InvalidatePeekCache(bool forced = true);
   void RefreshPeekCache();
   void FlagPeekCacheAsOutOfDate();
@@ -145,6 +149,14 @@ protected:
     u8 frame_access_mask;
   };
 
+  struct EFBCachePrefetch
+  {
+    std::unique_ptr<AbstractStagingTexture> readback_texture;
+    std::vector<bool> tiles;
+    u64 frame;
+    bool needs_flush;
+  };
+
   // EFB cache - for CPU EFB access
   // Tiles are ordered left-to-right, then top-to-bottom
   struct EFBCacheData
@@ -158,6 +170,12 @@ protected:
     bool has_active_tiles;
     bool needs_refresh;
     bool needs_flush;
+
+    // Readbacks of recently peeked tiles, one per frame within the latency budget. Prefetch i
+    // holds the tiles copied in frames where frame % prefetches.size() == i.
+    std::vector<EFBCachePrefetch> prefetches;
+    // Set when the EFB was drawn to after the tiles of the current frame's prefetch were copied.
+    bool prefetch_out_of_date;
   };
 
   bool CreateEFBFramebuffer();
@@ -182,6 +200,13 @@ protected:
   bool IsEFBCacheTilePresent(bool depth, u32 x, u32 y, u32* tile_index) const;
   MathUtil::Rectangle<int> GetEFBCacheTileRect(u32 tile_index) const;
   void PopulateEFBCache(bool depth, u32 tile_index, bool async = false);
+  void CopyEFBCacheTile(bool depth, u32 tile_index, AbstractStagingTexture* readback_texture);
+  AbstractStagingTexture* GetEFBCacheReadbackTexture(bool depth, u32 x, u32 y);
+
+  bool CreateEFBCachePrefetches();
+  void PrefetchEFBCache();
+  AbstractStagingTexture* GetPrefetchedEFBCacheTile(bool depth, u32 tile_index);
+  void DiscardPrefetchedEFBCacheTile(bool depth, u32 tile_index);
 
   void CreatePokeVertices(std::vector<EFBPokeVertex>* destination_list, u32 x, u32 y, float z,
                           u32 color);
@@ -226,6 +251,10 @@ protected:
   u32 m_efb_cache_tile_row_stride = 1;
   EFBCacheData m_efb_color_cache = {};
   EFBCacheData m_efb_depth_cache = {};
+  // Number of frames that peeks may lag behind, 0 if tiles aren't prefetched.
+  u32 m_efb_cache_latency = 0;
+  // Number of frames that were presented, used to tell the age of prefetched tiles.
+  u64 m_efb_cache_frame = 0;
 
   // EFB clear pipelines
   // Indexed by [color_write_enabled][alpha_write_enabled][depth_write_enabled]
@@ -319,6 +319,29 @@ void IndexGenerator::AddIndices(OpcodeDecoder::Primitive primitive, u32 num_vert
   m_base_index += num_vertices;
 }
 
+void IndexGenerator::AddIndices(OpcodeDecoder::Primitive primitive, u32 num_vertices,
+                                std::vector<u16>* relative_indices)
+{
+  // Index buffers may be mapped GPU memory which is slow to read, so generate the indices into
+  // relative_indices first. No primitive needs more than 3 indices per vertex.
+  relative_indices->resize(num_vertices * 3 + 1);
+  const u16* const end = m_primitive_table[primitive](relative_indices->data(), num_vertices, 0);
+  relative_indices->resize(end - relative_indices->data());
+
+  AddRelativeIndices(*relative_indices, num_vertices);
+}
+
+void IndexGenerator::AddRelativeIndices(std::span<const u16> indices, u32 num_vertices)
+{
+  for (const u16 index : indices)
+  {
+    *m_index_buffer_current++ = index == s_primitive_restart ?
+                                    s_primitive_restart :
+                                    static_cast<u16>(index + m_base_index);
+  }
+  m_base_index += num_vertices;
+}
+
 void IndexGenerator::AddExternalIndices(const u16* indices, u32 num_indices, u32 num_vertices)
 {
   std::memcpy(m_index_buffer_current, indices, sizeof(u16) * num_indices);
@@ -6,6 +6,9 @@
 
 #pragma once
 
+#include <span>
+#include <vector>
+
 #include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
 #include "VideoCommon/OpcodeDecoding.h"
@@ -17,6 +20,11 @@ public:
   void Start(u16* index_ptr);
 
   void AddIndices(OpcodeDecoder::Primitive primitive, u32 num_vertices);
+  // Like AddIndices, but also returns the new indices in relative_indices, relative to the first
+  // of the vertices, so that they can be added again with AddRelativeIndices.
+  void AddIndices(OpcodeDecoder::Primitive primitive, u32 num_vertices,
+                  std::vector<u16>* relative_indices);
+  void AddRelativeIndices(std::span<const u16> indices, u32 num_vertices);
 
   void AddExternalIndices(const u16* indices, u32 num_indices, u32 num_vertices);
 
@@ -172,7 +172,8 @@ public:
         const u8* start_address;
 
         auto& fifo = system.GetFifo();
-        if (fifo.UseDeterministicGPUThread())
+        const bool from_ram = !fifo.UseDeterministicGPUThread();
+        if (!from_ram)
         {
           start_address = static_cast<u8*>(fifo.PopFifoAuxBuffer(size));
         }
@@ -188,7 +189,12 @@ public:
           // temporarily swap dl and non-dl (small "hack" for the stats)
           g_stats.SwapDL();
 
+          // The deterministic GPU thread reads a copy of the display list, whose data can't be
+          // tracked in RAM.
+          if (from_ram)
+            VertexLoaderManager::SetDisplayList(address, start_address);
           Run(start_address, size, *this);
+          VertexLoaderManager::ClearDisplayList();
           INCSTAT(g_stats.this_frame.num_dlists_called);
 
           // un-swap
@@ -257,6 +263,63 @@ public:
   bool m_in_display_list = false;
 };
 
+// Used by the FIFO pre-parse thread to split the FIFO into draws ahead of the GPU thread, which
+// decodes everything again.
+class PreparseCallback final : public Callback
+{
+public:
+  OPCODE_CALLBACK(void OnXF(u16 address, u8 count, const u8* data)) {}
+  OPCODE_CALLBACK(void OnCP(u8 command, u32 value))
+  {
+    const u8 sub_command = command & CP_COMMAND_MASK;
+    if (sub_command == VCD_LO || sub_command == VCD_HI)
+    {
+      VertexLoaderManager::g_preprocess_vat_dirty = BitSet8::AllTrue(CP_NUM_VAT_REG);
+    }
+    else if (sub_command == CP_VAT_REG_A || sub_command == CP_VAT_REG_B ||
+             sub_command == CP_VAT_REG_C)
+    {
+      VertexLoaderManager::g_preprocess_vat_dirty[command & CP_VAT_MASK] = true;
+    }
+    GetCPState().LoadCPReg(command, value);
+  }
+  OPCODE_CALLBACK(void OnBP(u8 command, u32 value)) {}
+  OPCODE_CALLBACK(void OnIndexedLoad(CPArray array, u32 index, u16 address, u8 size)) {}
+  OPCODE_CALLBACK(void OnPrimitiveCommand(OpcodeDecoder::Primitive primitive, u8 vat,
+                                          u32 vertex_size, u16 num_vertices, const u8* vertex_data))
+  {
+    m_draws++;
+  }
+  // Display lists can change the VAT too, so they have to be followed.
+  OPCODE_CALLBACK_NOINLINE(void OnDisplayList(u32 address, u32 size))
+  {
+    if (m_in_display_list)
+      return;
+
+    m_in_display_list = true;
+    auto& memory = Core::System::GetInstance().GetMemory();
+    const u8* const start_address = memory.GetPointerForRange(address, size);
+    if (start_address != nullptr)
+      Run(start_address, size, *this);
+    m_in_display_list = false;
+  }
+  OPCODE_CALLBACK(void OnNop(u32 count)) {}
+  OPCODE_CALLBACK(void OnUnknown(u8 opcode, const u8* data)) {}
+  OPCODE_CALLBACK(void OnCommand(const u8* data, u32 size)) {}
+
+  OPCODE_CALLBACK(CPState& GetCPState()) { return g_preprocess_cp_state; }
+
+  // This also creates the vertex loaders before the GPU thread needs them.
+  OPCODE_CALLBACK(u32 GetVertexSize(u8 vat))
+  {
+    VertexLoaderBase* loader = VertexLoaderManager::RefreshLoader<true>(vat);
+    return loader->m_vertex_size;
+  }
+
+  u32 m_draws = 0;
+  bool m_in_display_list = false;
+};
+
 template <bool is_preprocess>
 u8* RunFifo(DataReader src, u32* cycles)
 {
@@ -274,4 +337,12 @@ u8* RunFifo(DataReader src, u32* cycles)
 template u8* RunFifo<true>(DataReader src, u32* cycles);
 template u8* RunFifo<false>(DataReader src, u32* cycles);
 
+u32 PreparseFifo(const u8* data, u32 size, u32* draws)
+{
+  PreparseCallback callback;
+  const u32 parsed_size = Run(data, size, callback);
+  *draws = callback.m_draws;
+  return parsed_size;
+}
+
 }  // namespace OpcodeDecoder
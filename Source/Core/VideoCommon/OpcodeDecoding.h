@@ -281,6 +281,11 @@ DOLPHIN_FORCE_INLINE u32 Run(const u8* data, u32 available,
 template <bool is_preprocess = false>
 u8* RunFifo(DataReader src, u32* cycles);
 
+// Decodes commands without running them, only following the CP state that the sizes of primitive
+// commands depend on (in g_preprocess_cp_state). Returns the size of the complete commands, and
+// the number of primitive commands among them in draws.
+u32 PreparseFifo(const u8* data, u32 size, u32* draws);
+
 }  // namespace OpcodeDecoder
 
 template <>
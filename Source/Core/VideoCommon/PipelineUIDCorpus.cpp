@@ -0,0 +1,172 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/PipelineUIDCorpus.h"
+
+#include <algorithm>
+#include <set>
+
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+
+namespace VideoCommon
+{
+namespace
+{
+// Same header as ShaderCache writes to UID caches.
+constexpr u32 UID_CACHE_MAGIC = 0x44495550;  // PUID
+constexpr size_t UID_CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
+
+constexpr u32 CORPUS_MAGIC = 0x43495550;  // PUIC
+
+#pragma pack(push, 1)
+struct CorpusHeader
+{
+  u32 magic;
+  u32 file_version;
+  u32 uid_version;
+  u32 revision;
+  u32 source_count;
+  u32 entry_count;
+};
+#pragma pack(pop)
+}  // namespace
+
+void PipelineUIDCorpus::AddUIDCache(std::span<const SerializedGXPipelineUid> uids)
+{
+  // UID caches shouldn't contain duplicates, but only the first one counts if they do.
+  std::set<SerializedGXPipelineUid, UIDLess> seen;
+  const u64 last = std::max<u64>(uids.size(), 2) - 1;
+  for (size_t i = 0; i < uids.size(); i++)
+  {
+    if (seen.insert(uids[i]).second)
+      Add(uids[i], 1, i * POSITION_SCALE / last);
+  }
+  m_source_count++;
+}
+
+void PipelineUIDCorpus::AddCorpus(const PipelineUIDCorpus& corpus)
+{
+  for (const auto& [uid, statistics] : corpus.m_uids)
+    Add(uid, statistics.occurrences, statistics.position_sum);
+  m_source_count += corpus.m_source_count;
+  m_revision = std::max(m_revision, corpus.m_revision);
+}
+
+void PipelineUIDCorpus::Add(const SerializedGXPipelineUid& uid, u32 occurrences, u64 position_sum)
+{
+  Statistics& statistics = m_uids[uid];
+  statistics.occurrences += occurrences;
+  statistics.position_sum += position_sum;
+}
+
+std::vector<PipelineUIDCorpus::Entry> PipelineUIDCorpus::GetEntries() const
+{
+  std::vector<Entry> entries;
+  entries.reserve(m_uids.size());
+  for (const auto& [uid, statistics] : m_uids)
+  {
+    const u64 occurrences = std::max<u64>(statistics.occurrences, 1);
+    const u64 position = (statistics.position_sum + occurrences / 2) / occurrences;
+    entries.push_back({uid, statistics.occurrences, static_cast<u32>(position)});
+  }
+
+  // The map is ordered by UID, so entries that are equally likely keep a stable order.
+  std::ranges::stable_sort(entries, [](const Entry& a, const Entry& b) {
+    if (a.occurrences != b.occurrences)
+      return a.occurrences > b.occurrences;
+    return a.position < b.position;
+  });
+  return entries;
+}
+
+bool PipelineUIDCorpus::Save(const std::string& path) const
+{
+  File::IOFile file(path, "wb");
+  if (!file)
+    return false;
+
+  const std::vector<Entry> entries = GetEntries();
+  CorpusHeader header;
+  header.magic = CORPUS_MAGIC;
+  header.file_version = FILE_VERSION;
+  header.uid_version = GX_PIPELINE_UID_VERSION;
+  header.revision = m_revision;
+  header.source_count = m_source_count;
+  header.entry_count = static_cast<u32>(entries.size());
+  if (!file.WriteBytes(&header, sizeof(header)))
+    return false;
+
+  for (const Entry& entry : entries)
+  {
+    if (!file.WriteBytes(&entry.uid, sizeof(entry.uid)) ||
+        !file.WriteBytes(&entry.occurrences, sizeof(entry.occurrences)) ||
+        !file.WriteBytes(&entry.position, sizeof(entry.position)))
+    {
+      return false;
+    }
+  }
+
+  return file.Close();
+}
+
+std::optional<PipelineUIDCorpus> PipelineUIDCorpus::Load(const std::string& path)
+{
+  constexpr size_t ENTRY_SIZE = sizeof(SerializedGXPipelineUid) + sizeof(u32) + sizeof(u32);
+
+  File::IOFile file(path, "rb");
+  CorpusHeader header;
+  if (!file || !file.ReadBytes(&header, sizeof(header)))
+    return std::nullopt;
+
+  if (header.magic != CORPUS_MAGIC)
+    return std::nullopt;
+  if (header.file_version != FILE_VERSION || header.uid_version != GX_PIPELINE_UID_VERSION)
+  {
+    WARN_LOG_FMT(VIDEO, "Pipeline UID corpus {} was made for another version", path);
+    return std::nullopt;
+  }
+  if (file.GetSize() != sizeof(header) + u64{header.entry_count} * ENTRY_SIZE)
+  {
+    WARN_LOG_FMT(VIDEO, "Pipeline UID corpus {} has the wrong size", path);
+    return std::nullopt;
+  }
+
+  PipelineUIDCorpus corpus;
+  for (u32 i = 0; i < header.entry_count; i++)
+  {
+    Entry entry;
+    if (!file.ReadBytes(&entry.uid, sizeof(entry.uid)) ||
+        !file.ReadBytes(&entry.occurrences, sizeof(entry.occurrences)) ||
+        !file.ReadBytes(&entry.position, sizeof(entry.position)))
+    {
+      return std::nullopt;
+    }
+    corpus.Add(entry.uid, entry.occurrences, u64{entry.position} * entry.occurrences);
+  }
+  corpus.m_source_count = header.source_count;
+  corpus.m_revision = header.revision;
+  return corpus;
+}
+
+std::optional<std::vector<SerializedGXPipelineUid>> ReadPipelineUIDCache(const std::string& path)
+{
+  File::IOFile file(path, "rb");
+  u32 magic;
+  u32 version;
+  if (!file || !file.ReadBytes(&magic, sizeof(magic)) || !file.ReadBytes(&version, sizeof(version)))
+    return std::nullopt;
+  if (magic != UID_CACHE_MAGIC || version != GX_PIPELINE_UID_VERSION)
+    return std::nullopt;
+
+  const u64 file_size = file.GetSize();
+  if (file_size < UID_CACHE_HEADER_SIZE)
+    return std::nullopt;
+
+  std::vector<SerializedGXPipelineUid> uids(
+      static_cast<size_t>((file_size - UID_CACHE_HEADER_SIZE) / sizeof(SerializedGXPipelineUid)));
+  if (!file.ReadArray(uids.data(), uids.size()))
+    return std::nullopt;
+  return uids;
+}
+}  // namespace VideoCommon
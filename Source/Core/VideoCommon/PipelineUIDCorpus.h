@@ -0,0 +1,87 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstring>
+#include <map>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/GXPipelineTypes.h"
+
+namespace VideoCommon
+{
+// A set of pipeline UIDs merged from the UID caches (GAMEID.uidcache) of many machines, which can
+// be shared so that new installs compile the pipelines a game needs before it first uses them.
+//
+// Each UID remembers how many of the merged caches contained it, and how early on average it was
+// added to them. GetEntries orders the UIDs by how likely they are to be needed soon: UIDs that
+// more caches contained come first, and UIDs that were added earlier come first among those.
+class PipelineUIDCorpus
+{
+public:
+  // Bump this when the file format changes.
+  static constexpr u32 FILE_VERSION = 1;
+
+  struct Entry
+  {
+    SerializedGXPipelineUid uid;
+    // Number of merged UID caches that contained the UID.
+    u32 occurrences;
+    // Average position of the UID within the caches, from 0 for the first to POSITION_SCALE.
+    u32 position;
+  };
+  static constexpr u32 POSITION_SCALE = 0xFFFF;
+
+  // Merges the UIDs of a UID cache, in the order that they were added to it.
+  void AddUIDCache(std::span<const SerializedGXPipelineUid> uids);
+  // Merges another corpus, as if the caches it was made from were merged one by one.
+  void AddCorpus(const PipelineUIDCorpus& corpus);
+
+  // Returns the UIDs in the order that they should be compiled in.
+  std::vector<Entry> GetEntries() const;
+  size_t GetSize() const { return m_uids.size(); }
+  // Number of UID caches that were merged, including those of merged corpora.
+  u32 GetSourceCount() const { return m_source_count; }
+
+  // Revision of the corpus, which is increased each time that it is rebuilt, so that machines can
+  // tell which corpus they have.
+  u32 GetRevision() const { return m_revision; }
+  void SetRevision(u32 revision) { m_revision = revision; }
+
+  bool Save(const std::string& path) const;
+  // Returns nothing if the file doesn't exist, is damaged or was made for other pipeline UIDs.
+  static std::optional<PipelineUIDCorpus> Load(const std::string& path);
+
+private:
+  struct UIDLess
+  {
+    bool operator()(const SerializedGXPipelineUid& a, const SerializedGXPipelineUid& b) const
+    {
+      return std::memcmp(&a, &b, sizeof(a)) < 0;
+    }
+  };
+
+  struct Statistics
+  {
+    u32 occurrences = 0;
+    // Sum of the positions of all occurrences.
+    u64 position_sum = 0;
+  };
+
+  void Add(const SerializedGXPipelineUid& uid, u32 occurrences, u64 position_sum);
+
+  std::map<SerializedGXPipelineUid, Statistics, UIDLess> m_uids;
+  u32 m_source_count = 0;
+  u32 m_revision = 0;
+};
+
+// Reads the UIDs of a UID cache that ShaderCache wrote. A damaged entry at the end, like one that
+// was cut off by a crash, is ignored. Returns nothing if the file can't be read or was made for
+// other pipeline UIDs.
+std::optional<std::vector<SerializedGXPipelineUid>> ReadPipelineUIDCache(const std::string& path);
+}  // namespace VideoCommon
@@ -15,6 +15,8 @@
 #include "VideoCommon/DriverDetails.h"
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/FramebufferShaderGen.h"
+#include "VideoCommon/OnScreenDisplay.h"
+#include "VideoCommon/PipelineUIDCorpus.h"
 #include "VideoCommon/Present.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderManager.h"
@@ -66,8 +68,10 @@ void ShaderCache::InitializeShaderCache()
   if (g_ActiveConfig.UsingUberShaders())
     QueueUberShaderPipelines();
 
-  // Compile all known UIDs.
+  // Compile all known UIDs, followed by those that other machines have seen.
   CompileMissingPipelines();
+  if (g_ActiveConfig.bShaderCache && m_api_type != APIType::Nothing)
+    LoadPipelineUIDCorpus();
   if (g_ActiveConfig.bWaitForShadersBeforeStarting)
     WaitForAsyncCompiler();
 
@@ -94,6 +98,7 @@ void ShaderCache::Reload()
   // UIDs are still be in the map. Therefore, when these are rebuilt, the shaders will also
   // be recompiled.
   CompileMissingPipelines();
+  m_corpus_compiled = 0;
   if (g_ActiveConfig.bWaitForShadersBeforeStarting)
     WaitForAsyncCompiler();
   m_async_shader_compiler->ResizeWorkerThreads(g_ActiveConfig.GetShaderCompilerThreads());
@@ -102,6 +107,7 @@ void ShaderCache::Reload()
 void ShaderCache::RetrieveAsyncShaders()
 {
   m_async_shader_compiler->RetrieveWorkItems();
+  UpdatePipelineUIDCorpusProgress();
 }
 
 void ShaderCache::Shutdown()
@@ -117,10 +123,12 @@ void ShaderCache::Shutdown()
 const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid)
 {
   auto it = m_gx_pipeline_cache.find(uid);
-  if (it != m_gx_pipeline_cache.end() && !it->second.second)
+  const bool exists_in_cache = it != m_gx_pipeline_cache.end();
+  if (exists_in_cache && !m_unused_corpus_uids.empty())
+    OnCorpusPipelineUsed(uid, false);
+  if (exists_in_cache && !it->second.second)
     return it->second.first.get();
 
-  const bool exists_in_cache = it != m_gx_pipeline_cache.end();
   std::unique_ptr<AbstractPipeline> pipeline;
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
   if (pipeline_config)
@@ -135,6 +143,9 @@ std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const
   auto it = m_gx_pipeline_cache.find(uid);
   if (it != m_gx_pipeline_cache.end())
   {
+    if (!m_unused_corpus_uids.empty())
+      OnCorpusPipelineUsed(uid, it->second.second);
+
     // .second is the pending flag, i.e. compiling in the background.
     if (!it->second.second)
       return it->second.first.get();
@@ -147,6 +158,22 @@ std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const
   return {};
 }
 
+std::optional<const AbstractPipeline*>
+ShaderCache::GetUberPipelineForUidAsync(const GXUberPipelineUid& uid)
+{
+  auto it = m_gx_uber_pipeline_cache.find(uid);
+  if (it != m_gx_uber_pipeline_cache.end())
+  {
+    if (!it->second.second)
+      return it->second.first.get();
+    else
+      return {};
+  }
+
+  QueueUberPipelineCompile(uid, COMPILE_PRIORITY_SEMI_UBER_PIPELINE);
+  return {};
+}
+
 const AbstractPipeline* ShaderCache::GetUberPipelineForUid(const GXUberPipelineUid& uid)
 {
   auto it = m_gx_uber_pipeline_cache.find(uid);
@@ -990,6 +1017,91 @@ void ShaderCache::LoadPipelineUIDCache()
   INFO_LOG_FMT(VIDEO, "Read {} pipeline UIDs from {}", m_gx_pipeline_cache.size(), filename);
 }
 
+void ShaderCache::LoadPipelineUIDCorpus()
+{
+  const std::string filename =
+      File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".uidcorpus";
+  if (!File::Exists(filename))
+    return;
+
+  const std::optional<PipelineUIDCorpus> corpus = PipelineUIDCorpus::Load(filename);
+  if (!corpus)
+  {
+    WARN_LOG_FMT(VIDEO, "Ignoring invalid pipeline UID corpus {}", filename);
+    return;
+  }
+
+  m_corpus_uids.clear();
+  m_corpus_compiled = 0;
+  m_unused_corpus_uids.clear();
+  const std::vector<PipelineUIDCorpus::Entry> entries = corpus->GetEntries();
+  for (u32 rank = 0; rank < entries.size(); rank++)
+  {
+    GXPipelineUid uid;
+    UnserializePipelineUid(entries[rank].uid, uid);
+    if (m_gx_pipeline_cache.contains(uid))
+      continue;
+
+    QueuePipelineCompile(uid, COMPILE_PRIORITY_CORPUS_PIPELINE + rank);
+    m_corpus_uids.push_back(uid);
+    m_unused_corpus_uids.insert(uid);
+  }
+
+  m_corpus_progress_callback = [](size_t compiled, size_t total) {
+    OSD::AddTypedMessage(OSD::MessageType::ShaderCompileProgress,
+                         fmt::format("Compiling shaders from corpus: {}/{}", compiled, total),
+                         compiled == total ? OSD::Duration::NORMAL : OSD::Duration::SHORT);
+  };
+
+  INFO_LOG_FMT(VIDEO, "Queued {} of {} pipeline UIDs from corpus {} (revision {})",
+               m_corpus_uids.size(), entries.size(), filename, corpus->GetRevision());
+}
+
+void ShaderCache::OnCorpusPipelineUsed(const GXPipelineUid& uid, bool pending)
+{
+  if (m_unused_corpus_uids.erase(uid) == 0)
+    return;
+
+  AppendGXPipelineUID(uid);
+  if (!pending)
+    return;
+
+  // The game needs the pipeline now, so it can't wait behind the rest of the corpus. Its stages
+  // are queued again too, since it can't be compiled before them. Whichever compile finishes
+  // first is kept.
+  const GXPipelineUid actual_uid = ApplyDriverBugs(uid);
+  const auto vs_it = m_vs_cache.shader_map.find(actual_uid.vs_uid);
+  if (vs_it != m_vs_cache.shader_map.end() && vs_it->second.pending)
+    QueueVertexShaderCompile(actual_uid.vs_uid, COMPILE_PRIORITY_ONDEMAND_PIPELINE);
+
+  PixelShaderUid ps_uid = actual_uid.ps_uid;
+  ClearUnusedPixelShaderUidBits(m_api_type, m_host_config, &ps_uid);
+  const auto ps_it = m_ps_cache.shader_map.find(ps_uid);
+  if (ps_it != m_ps_cache.shader_map.end() && ps_it->second.pending)
+    QueuePixelShaderCompile(ps_uid, COMPILE_PRIORITY_ONDEMAND_PIPELINE);
+
+  QueuePipelineCompile(uid, COMPILE_PRIORITY_ONDEMAND_PIPELINE);
+}
+
+void ShaderCache::UpdatePipelineUIDCorpusProgress()
+{
+  if (m_corpus_compiled == m_corpus_uids.size())
+    return;
+
+  // Pipelines are mostly compiled in order, so only the leading ones that are done are counted.
+  const size_t previous = m_corpus_compiled;
+  while (m_corpus_compiled < m_corpus_uids.size())
+  {
+    const auto it = m_gx_pipeline_cache.find(m_corpus_uids[m_corpus_compiled]);
+    if (it != m_gx_pipeline_cache.end() && it->second.second)
+      break;
+    m_corpus_compiled++;
+  }
+
+  if (m_corpus_compiled != previous && m_corpus_progress_callback)
+    m_corpus_progress_callback(m_corpus_compiled, m_corpus_uids.size());
+}
+
 void ShaderCache::ClosePipelineUIDCache()
 {
   // This is left as a method in case we need to append extra data to the file in the future.
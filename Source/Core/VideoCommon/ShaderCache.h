@@ -6,12 +6,15 @@
 #include <array>
 #include <cstddef>
 #include <cstring>
+#include <functional>
 #include <map>
 #include <memory>
 #include <optional>
+#include <set>
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
@@ -69,6 +72,8 @@ public:
   // Accesses ShaderGen shader caches asynchronously.
   // The optional will be empty if this pipeline is now background compiling.
   std::optional<const AbstractPipeline*> GetPipelineForUidAsync(const GXPipelineUid& uid);
+  // Used for semi-ubershaders, which are compiled ahead of on demand pipelines.
+  std::optional<const AbstractPipeline*> GetUberPipelineForUidAsync(const GXUberPipelineUid& uid);
 
   // Shared shaders
   const AbstractShader* GetScreenQuadVertexShader() const
@@ -123,6 +128,9 @@ private:
   void LoadPipelineUIDCache();
   void ClosePipelineUIDCache();
   void CompileMissingPipelines();
+  void LoadPipelineUIDCorpus();
+  void UpdatePipelineUIDCorpusProgress();
+  void OnCorpusPipelineUsed(const GXPipelineUid& uid, bool pending);
   void QueueUberShaderPipelines();
   bool CompileSharedPipelines();
 
@@ -184,12 +192,16 @@ private:
   // Priorities for compiling. The lower the value, the sooner the pipeline is compiled.
   // The shader cache is compiled last, as it is the least likely to be required. On demand
   // shaders are always compiled before pending ubershaders, as we want to use the ubershader
-  // for as few frames as possible, otherwise we risk framerate drops.
+  // for as few frames as possible, otherwise we risk framerate drops. Semi-ubershaders are used
+  // until the on demand pipeline is ready, so they're only useful if they are compiled first.
   enum : u32
   {
+    COMPILE_PRIORITY_SEMI_UBER_PIPELINE = 50,
     COMPILE_PRIORITY_ONDEMAND_PIPELINE = 100,
     COMPILE_PRIORITY_UBERSHADER_PIPELINE = 200,
-    COMPILE_PRIORITY_SHADERCACHE_PIPELINE = 300
+    COMPILE_PRIORITY_SHADERCACHE_PIPELINE = 300,
+    // Pipelines of a UID corpus add their rank in it, so that they are compiled in its order.
+    COMPILE_PRIORITY_CORPUS_PIPELINE = 400
   };
 
   // Configuration bits.
@@ -232,6 +244,15 @@ private:
   Common::LinearDiskCache<SerializedGXPipelineUid, u8> m_gx_pipeline_disk_cache;
   Common::LinearDiskCache<SerializedGXUberPipelineUid, u8> m_gx_uber_pipeline_disk_cache;
 
+  // Pipelines queued from the UID corpus, in the order they are compiled in, and the number of
+  // them from the start which have been compiled. The callback is called when that number changes.
+  std::vector<GXPipelineUid> m_corpus_uids;
+  size_t m_corpus_compiled = 0;
+  // Pipelines from the corpus that the game hasn't used yet. They are written to the UID cache once
+  // it does.
+  std::set<GXPipelineUid> m_unused_corpus_uids;
+  std::function<void(size_t compiled, size_t total)> m_corpus_progress_callback;
+
   // EFB copy to VRAM/RAM pipelines
   std::map<TextureConversionShaderGen::TCShaderUid, std::unique_ptr<AbstractPipeline>>
       m_efb_copy_to_vram_pipelines;
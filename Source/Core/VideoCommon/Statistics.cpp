@@ -10,6 +10,7 @@
 
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/SystemTimers.h"
+#include "Core/PowerPC/JitInterface.h"
 #include "Core/System.h"
 
 #include "VideoCommon/BPFunctions.h"
@@ -90,14 +91,39 @@ void Statistics::Display() const
   draw_statistic("Textures created", "%d", num_textures_created);
   draw_statistic("Textures uploaded", "%d", num_textures_uploaded);
   draw_statistic("Textures alive", "%d", num_textures_alive);
+  draw_statistic("Texture lookups", "%d (%d hits)", this_frame.num_texture_lookups,
+                 this_frame.num_texture_lookup_hits);
+  draw_statistic("Avg. lookup probes", "%.2f",
+                 this_frame.num_texture_lookups != 0 ?
+                     static_cast<float>(this_frame.num_texture_lookup_probes) /
+                         this_frame.num_texture_lookups :
+                     0.0f);
+  draw_statistic("Texture hashes", "%d (%d skipped)",
+                 this_frame.num_texture_hashes_computed + this_frame.num_texture_hashes_skipped,
+                 this_frame.num_texture_hashes_skipped);
   draw_statistic("pshaders created", "%d", num_pixel_shaders_created);
   draw_statistic("pshaders alive", "%d", num_pixel_shaders_alive);
   draw_statistic("vshaders created", "%d", num_vertex_shaders_created);
   draw_statistic("vshaders alive", "%d", num_vertex_shaders_alive);
   draw_statistic("shaders changes", "%d", this_frame.num_shader_changes);
   draw_statistic("dlists called", "%d", this_frame.num_dlists_called);
+  const int dlist_cache_lookups =
+      this_frame.num_dlist_cache_hits + this_frame.num_dlist_cache_misses;
+  draw_statistic("dlist cache hit rate", "%.1f%% of %d draws",
+                 dlist_cache_lookups ? this_frame.num_dlist_cache_hits * 100.0f /
+                                           dlist_cache_lookups :
+                                       0.0f,
+                 dlist_cache_lookups);
   draw_statistic("Primitive joins", "%d", this_frame.num_primitive_joins);
   draw_statistic("Draw calls", "%d", this_frame.num_draw_calls);
+  draw_statistic("Draw calls (specialized/semi-uber/uber)", "%d/%d/%d",
+                 this_frame.num_draw_calls_specialized, this_frame.num_draw_calls_semi_uber,
+                 this_frame.num_draw_calls_uber);
+  draw_statistic("Draw calls merged", "%d", this_frame.num_draw_calls_merged);
+  draw_statistic("CPU cull batches (culled/kept by bounds)", "%d / %d",
+                 this_frame.num_cpu_cull_bounds_culled, this_frame.num_cpu_cull_bounds_kept);
+  draw_statistic("FIFO pre-parse packets (restarts)", "%d (%d)", this_frame.num_preparsed_packets,
+                 this_frame.num_preparse_restarts);
   draw_statistic("Primitives", "%d", this_frame.num_prims);
   draw_statistic("Primitives (DL)", "%d", this_frame.num_dl_prims);
   draw_statistic("XF loads", "%d", this_frame.num_xf_loads);
@@ -109,12 +135,26 @@ void Statistics::Display() const
   draw_statistic("Vertex streamed", "%i kB", this_frame.bytes_vertex_streamed / 1024);
   draw_statistic("Index streamed", "%i kB", this_frame.bytes_index_streamed / 1024);
   draw_statistic("Uniform streamed", "%i kB", this_frame.bytes_uniform_streamed / 1024);
-  draw_statistic("Vertex Loaders", "%d", num_vertex_loaders);
+  draw_statistic("Vertex Loaders", "%d (%d from cache)", num_vertex_loaders,
+                 num_vertex_loaders_preloaded);
+  draw_statistic("Vertex loader creation", "%.2f ms (%.2f ms from cache)",
+                 vertex_loader_creation_ms, vertex_loader_preload_ms);
   draw_statistic("EFB peeks:", "%d", this_frame.num_efb_peeks);
   draw_statistic("EFB pokes:", "%d", this_frame.num_efb_pokes);
+  draw_statistic("EFB peek readbacks:", "%d (%d prefetched)", this_frame.num_efb_peek_readbacks,
+                 this_frame.num_efb_peek_prefetches);
+  draw_statistic("EFB peeks from prefetch:", "%d", this_frame.num_efb_peeks_prefetched);
   draw_statistic("Draw dones:", "%d", this_frame.num_draw_done);
   draw_statistic("Tokens:", "%d/%d", this_frame.num_token, this_frame.num_token_int);
 
+  const auto [jit_blocks_warmed_up, jit_blocks_compiled_on_demand] =
+      Core::System::GetInstance().GetJitInterface().GetPersistentBlockCacheStats();
+  if (jit_blocks_warmed_up != 0 || jit_blocks_compiled_on_demand != 0)
+  {
+    draw_statistic("JIT blocks warmed up", "%zu", jit_blocks_warmed_up);
+    draw_statistic("JIT blocks compiled on demand", "%zu", jit_blocks_compiled_on_demand);
+  }
+
   ImGui::Columns(1);
 
   ImGui::End();
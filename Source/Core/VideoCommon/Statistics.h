@@ -20,6 +20,10 @@ struct Statistics
   int num_textures_alive = 0;
 
   int num_vertex_loaders = 0;
+  // Loaders that were created from the UID cache before they were used.
+  int num_vertex_loaders_preloaded = 0;
+  float vertex_loader_creation_ms = 0;
+  float vertex_loader_preload_ms = 0;
 
   std::array<float, 6> proj{};
   std::array<float, 16> gproj{};
@@ -55,8 +59,19 @@ struct Statistics
 
     int num_primitive_joins = 0;
     int num_draw_calls = 0;
+    int num_draw_calls_specialized = 0;
+    int num_draw_calls_semi_uber = 0;
+    int num_draw_calls_uber = 0;
+    int num_draw_calls_merged = 0;
+    int num_cpu_cull_bounds_culled = 0;
+    int num_cpu_cull_bounds_kept = 0;
+    int num_preparsed_packets = 0;
+    int num_preparse_restarts = 0;
 
     int num_dlists_called = 0;
+    // Draws in display lists that could use DisplayListCache
+    int num_dlist_cache_hits = 0;
+    int num_dlist_cache_misses = 0;
 
     int bytes_vertex_streamed = 0;
     int bytes_index_streamed = 0;
@@ -73,8 +88,18 @@ struct Statistics
     int tev_pixels_in = 0;
     int tev_pixels_out = 0;
 
+    int num_texture_lookups = 0;
+    int num_texture_lookup_hits = 0;
+    int num_texture_lookup_probes = 0;
+
+    int num_texture_hashes_skipped = 0;
+    int num_texture_hashes_computed = 0;
+
     int num_efb_peeks = 0;
     int num_efb_pokes = 0;
+    int num_efb_peek_readbacks = 0;
+    int num_efb_peek_prefetches = 0;
+    int num_efb_peeks_prefetched = 0;
 
     int num_draw_done = 0;
     int num_token = 0;
@@ -62,9 +62,22 @@ static const u64 TEXHASH_INVALID = 0;
 // Sonic the Fighters (inside Sonic Gems Collection) loops a 64 frames animation
 static const int TEXTURE_KILL_THRESHOLD = 64;
 static const int TEXTURE_POOL_KILL_THRESHOLD = 3;
+// Textures whose base level decodes to at least this many bytes are decoded on several threads.
+// Below that, waking up the threads takes about as long as decoding.
+static const u32 PARALLEL_DECODE_THRESHOLD = 256 * 1024;
 
 static int xfb_count = 0;
 
+static TextureCacheKey GetTextureCacheKey(u32 address, const TextureAndTLUTFormat& format,
+                                          u32 width, u32 height, u64 hash)
+{
+  // Like TextureAndTLUTFormat::operator==, only color indexed textures care about the TLUT format.
+  u32 packed_format = static_cast<u32>(format.texfmt);
+  if (IsColorIndexed(format.texfmt))
+    packed_format |= static_cast<u32>(format.tlutfmt) << 16;
+  return {address, packed_format, width, height, hash};
+}
+
 std::unique_ptr<TextureCacheBase> g_texture_cache;
 
 TCacheEntry::TCacheEntry(std::unique_ptr<AbstractTexture> tex,
@@ -91,6 +104,73 @@ void TextureCacheBase::CheckTempSize(size_t required_size)
   m_temp = static_cast<u8*>(Common::AllocateAlignedMemory(m_temp_size, 16));
 }
 
+u64 TextureCacheBase::HashTextureMemory(u32 address, u32 size, const u8* data,
+                                        int safety_color_sample_size)
+{
+  if (!g_ActiveConfig.bTextureWriteTracking)
+  {
+    INCSTAT(g_stats.this_frame.num_texture_hashes_computed);
+    return Common::GetHash64(data, size, safety_color_sample_size);
+  }
+
+  auto& memory = Core::System::GetInstance().GetMemory();
+  const u64 key = (static_cast<u64>(address) << 32) | size;
+  auto iter = m_texture_memory_hashes.find(key);
+  if (iter != m_texture_memory_hashes.end() &&
+      iter->second.safety_color_sample_size == safety_color_sample_size &&
+      memory.IsUnchangedSince(address, size, iter->second.generation))
+  {
+    INCSTAT(g_stats.this_frame.num_texture_hashes_skipped);
+    return iter->second.hash;
+  }
+
+  // Watch the memory before hashing it, so that every write the hash might not include is newer
+  // than the generation.
+  const std::optional<u64> generation = memory.WatchForWrites(address, size);
+  const u64 hash = Common::GetHash64(data, size, safety_color_sample_size);
+  INCSTAT(g_stats.this_frame.num_texture_hashes_computed);
+
+  if (!generation)
+  {
+    if (iter != m_texture_memory_hashes.end())
+      m_texture_memory_hashes.erase(iter);
+    return hash;
+  }
+
+  // Ranges that are no longer used are never removed, so start over once there are a lot of them.
+  if (iter == m_texture_memory_hashes.end() &&
+      m_texture_memory_hashes.size() >= MAX_TEXTURE_MEMORY_HASHES)
+  {
+    m_texture_memory_hashes.clear();
+  }
+  m_texture_memory_hashes.insert_or_assign(
+      key, TextureMemoryHash{hash, *generation, safety_color_sample_size});
+  return hash;
+}
+
+void TextureCacheBase::DecodeTextureLevelsInParallel(const TextureInfo& texture_info, u32 levels,
+                                                     u8* dst)
+{
+  m_decoder_pool.Add(dst, texture_info.GetData(), texture_info.GetExpandedWidth(),
+                     texture_info.GetExpandedHeight(), texture_info.GetTextureFormat(),
+                     texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
+  dst += texture_info.GetExpandedWidth() * sizeof(u32) * texture_info.GetExpandedHeight();
+
+  for (u32 level = 1; level < levels; ++level)
+  {
+    const auto mip_level = texture_info.GetMipMapLevel(level - 1);
+    if (!mip_level)
+      continue;
+
+    m_decoder_pool.Add(dst, mip_level->GetData(), mip_level->GetExpandedWidth(),
+                       mip_level->GetExpandedHeight(), texture_info.GetTextureFormat(),
+                       texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
+    dst += mip_level->GetExpandedWidth() * sizeof(u32) * mip_level->GetExpandedHeight();
+  }
+
+  m_decoder_pool.Run();
+}
+
 TextureCacheBase::TextureCacheBase()
 {
   SetBackupConfig(g_ActiveConfig);
@@ -129,6 +209,8 @@ bool TextureCacheBase::Initialize()
     return false;
   }
 
+  m_decoder_pool.SetThreadCount(g_ActiveConfig.GetTextureDecodingThreads());
+
   return true;
 }
 
@@ -141,6 +223,10 @@ void TextureCacheBase::Invalidate()
     bind.reset();
   m_textures_by_hash.clear();
   m_textures_by_address.clear();
+  m_textures_by_key.Clear();
+  m_efb_copy_counts.clear();
+  m_texture_size_bound.Clear();
+  m_texture_memory_hashes.clear();
 
   m_texture_pool.clear();
 }
@@ -171,6 +257,8 @@ void TextureCacheBase::OnConfigChanged(const VideoConfig& config)
     TexDecoder_SetTexFmtOverlayOptions(config.bTexFmtOverlayEnable, config.bTexFmtOverlayCenter);
   }
 
+  m_decoder_pool.SetThreadCount(config.GetTextureDecodingThreads());
+
   SetBackupConfig(config);
 }
 
@@ -335,7 +423,7 @@ RcTcacheEntry TextureCacheBase::ApplyPaletteToEntry(RcTcacheEntry& entry, const
     g_gfx->EndUtilityDrawing();
   }
 
-  m_textures_by_address.emplace(decoded_entry->addr, decoded_entry);
+  AddToTextureCache(decoded_entry->addr, decoded_entry);
 
   return decoded_entry;
 }
@@ -381,7 +469,7 @@ RcTcacheEntry TextureCacheBase::ReinterpretEntry(const RcTcacheEntry& existing_e
   g_gfx->EndUtilityDrawing();
   reinterpreted_entry->texture->FinishedRendering();
 
-  m_textures_by_address.emplace(reinterpreted_entry->addr, reinterpreted_entry);
+  AddToTextureCache(reinterpreted_entry->addr, reinterpreted_entry);
 
   return reinterpreted_entry;
 }
@@ -735,7 +823,7 @@ void TextureCacheBase::DoLoadState(PointerWrap& p)
 
     auto& entry = GetEntry(id);
     if (entry)
-      m_textures_by_address.emplace(addr, entry);
+      AddToTextureCache(addr, entry);
   }
 
   // Fill in hash map.
@@ -1270,9 +1358,24 @@ TCacheEntry* TextureCacheBase::LoadImpl(const TextureInfo& texture_info, bool fo
 
     // Otherwise, hash the backing memory and check it's unchanged.
     // FIXME: this doesn't correctly handle textures from tmem.
-    if (!entry->invalidated && entry->base_hash == entry->CalculateHash())
+    if (!entry->invalidated)
     {
-      return entry;
+      // Textures which aren't copies are hashed like in GetTexture, which can skip the hashing.
+      u64 hash;
+      if (entry->IsCopy())
+      {
+        hash = entry->CalculateHash();
+      }
+      else
+      {
+        auto& memory = Core::System::GetInstance().GetMemory();
+        hash = HashTextureMemory(entry->addr, entry->size_in_bytes,
+                                 memory.GetPointerForRange(entry->addr, entry->size_in_bytes),
+                                 entry->HashSampleSize());
+      }
+
+      if (entry->base_hash == hash)
+        return entry;
     }
   }
 
@@ -1339,8 +1442,16 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
 
   // TODO: This doesn't hash GB tiles for preloaded RGBA8 textures (instead, it's hashing more data
   // from the low tmem bank than it should)
-  base_hash = Common::GetHash64(texture_info.GetData(), texture_info.GetTextureSize(),
-                                textureCacheSafetyColorSampleSize);
+  if (texture_info.IsFromTmem())
+  {
+    base_hash = Common::GetHash64(texture_info.GetData(), texture_info.GetTextureSize(),
+                                  textureCacheSafetyColorSampleSize);
+  }
+  else
+  {
+    base_hash = HashTextureMemory(texture_info.GetRawAddress(), texture_info.GetTextureSize(),
+                                  texture_info.GetData(), textureCacheSafetyColorSampleSize);
+  }
   u32 palette_size = 0;
   if (texture_info.GetPaletteSize())
   {
@@ -1381,6 +1492,40 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
   //
   // For efb copies, the entry created in CopyRenderTargetToTexture always has to be used, or else
   // it was done in vain.
+  //
+  // Before walking all entries at the address, look up normal textures by everything that has to
+  // match. This finds textures which are already in the cache without a scan in the common case.
+  // If there are EFB copies at the address, the walk has to decide between them and normal
+  // textures, and prunes the copies that aren't useful anymore, so the index isn't used then.
+  INCSTAT(g_stats.this_frame.num_texture_lookups);
+  if (!m_efb_copy_counts.contains(texture_info.GetRawAddress()))
+  {
+    const auto lookup = m_textures_by_key.FindIf(
+        GetTextureCacheKey(texture_info.GetRawAddress(), full_format, texture_info.GetRawWidth(),
+                           texture_info.GetRawHeight(), full_hash),
+        [&](TexAddrCache::iterator iter) {
+          // The index holds the values the entry was added with, so check the current ones.
+          const RcTcacheEntry& entry = iter->second;
+          return entry->hash == full_hash && entry->format == full_format &&
+                 entry->native_levels >= texture_info.GetLevelCount() &&
+                 entry->native_width == texture_info.GetRawWidth() &&
+                 entry->native_height == texture_info.GetRawHeight();
+        });
+    ADDSTAT(g_stats.this_frame.num_texture_lookup_probes, lookup.probes);
+    if (lookup.value)
+    {
+      INCSTAT(g_stats.this_frame.num_texture_lookup_hits);
+      RcTcacheEntry& entry = (*lookup.value)->second;
+      entry = DoPartialTextureUpdates(entry, texture_info.GetTlutAddress(),
+                                      texture_info.GetTlutFormat());
+      if (entry)
+      {
+        entry->texture->FinishedRendering();
+        return entry;
+      }
+    }
+  }
+
   auto iter_range = m_textures_by_address.equal_range(texture_info.GetRawAddress());
   TexAddrCache::iterator iter = iter_range.first;
   TexAddrCache::iterator oldest_entry = iter;
@@ -1666,6 +1811,13 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
         g_ActiveConfig.UseGPUTextureDecoding() &&
         !(texture_info.IsFromTmem() && texture_info.GetTextureFormat() == TextureFormat::RGBA8);
 
+    // Large textures are decoded on several threads, all levels at once, before the levels are
+    // loaded one by one below.
+    const bool decode_in_parallel =
+        !decode_on_gpu && m_decoder_pool.GetThreadCount() > 1 &&
+        !(texture_info.GetTextureFormat() == TextureFormat::RGBA8 && texture_info.IsFromTmem()) &&
+        expanded_width * sizeof(u32) * expanded_height >= PARALLEL_DECODE_THRESHOLD;
+
     ArbitraryMipmapDetector arbitrary_mip_detector;
 
     // Initialized to null because only software loading uses this buffer
@@ -1698,7 +1850,12 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
 
       CheckTempSize(total_texture_size);
       dst_buffer = m_temp;
-      if (!(texture_info.GetTextureFormat() == TextureFormat::RGBA8 && texture_info.IsFromTmem()))
+      if (decode_in_parallel)
+      {
+        DecodeTextureLevelsInParallel(texture_info, texLevels, dst_buffer);
+      }
+      else if (!(texture_info.GetTextureFormat() == TextureFormat::RGBA8 &&
+                 texture_info.IsFromTmem()))
       {
         TexDecoder_Decode(dst_buffer, texture_info.GetData(), expanded_width, expanded_height,
                           texture_info.GetTextureFormat(), texture_info.GetTlutAddress(),
@@ -1736,9 +1893,12 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
         // No need to call CheckTempSize here, as the whole buffer is preallocated at the beginning
         const u32 decoded_mip_size =
             mip_level->GetExpandedWidth() * sizeof(u32) * mip_level->GetExpandedHeight();
-        TexDecoder_Decode(dst_buffer, mip_level->GetData(), mip_level->GetExpandedWidth(),
-                          mip_level->GetExpandedHeight(), texture_info.GetTextureFormat(),
-                          texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
+        if (!decode_in_parallel)
+        {
+          TexDecoder_Decode(dst_buffer, mip_level->GetData(), mip_level->GetExpandedWidth(),
+                            mip_level->GetExpandedHeight(), texture_info.GetTextureFormat(),
+                            texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
+        }
         entry->texture->Load(level, mip_level->GetRawWidth(), mip_level->GetRawHeight(),
                              mip_level->GetExpandedWidth(), dst_buffer, decoded_mip_size);
 
@@ -1768,14 +1928,6 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
     }
   }
 
-  const auto iter = m_textures_by_address.emplace(texture_info.GetRawAddress(), entry);
-  if (safety_color_sample_size == 0 ||
-      std::max(texture_info.GetTextureSize(), creation_info.palette_size) <=
-          (u32)safety_color_sample_size * 8)
-  {
-    entry->textures_by_hash_iter = m_textures_by_hash.emplace(creation_info.full_hash, entry);
-  }
-
   const TextureAndTLUTFormat full_format(texture_info.GetTextureFormat(),
                                          texture_info.GetTlutFormat());
   entry->SetGeneralParameters(texture_info.GetRawAddress(), texture_info.GetTextureSize(),
@@ -1786,6 +1938,14 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
   entry->memory_stride = entry->BytesPerRow();
   entry->SetNotCopy();
 
+  const auto iter = AddToTextureCache(texture_info.GetRawAddress(), entry);
+  if (safety_color_sample_size == 0 ||
+      std::max(texture_info.GetTextureSize(), creation_info.palette_size) <=
+          (u32)safety_color_sample_size * 8)
+  {
+    entry->textures_by_hash_iter = m_textures_by_hash.emplace(creation_info.full_hash, entry);
+  }
+
   INCSTAT(g_stats.num_textures_uploaded);
   SETSTAT(g_stats.num_textures_alive, static_cast<int>(m_textures_by_address.size()));
 
@@ -1868,7 +2028,7 @@ RcTcacheEntry TextureCacheBase::GetXFBTexture(u32 address, u32 width, u32 height
   entry->texture->FinishedRendering();
 
   // Insert into the texture cache so we can re-use it next frame, if needed.
-  m_textures_by_address.emplace(entry->addr, entry);
+  AddToTextureCache(entry->addr, entry);
   SETSTAT(g_stats.num_textures_alive, static_cast<int>(m_textures_by_address.size()));
   INCSTAT(g_stats.num_textures_uploaded);
 
@@ -2399,6 +2559,7 @@ void TextureCacheBase::CopyRenderTargetToTexture(
       UninitializeEFBMemory(dst, dstStride, bytes_per_row, num_blocks_y);
     }
   }
+  memory.RecordWrite(dstAddr, covered_range);
 
   // Invalidate all textures, if they are either fully overwritten by our efb copy, or if they
   // have a different stride than our efb copy. Partly overwritten textures with the same stride
@@ -2481,7 +2642,7 @@ void TextureCacheBase::CopyRenderTargetToTexture(
   {
     const u64 hash = entry->CalculateHash();
     entry->SetHashes(hash, hash);
-    m_textures_by_address.emplace(dstAddr, std::move(entry));
+    AddToTextureCache(dstAddr, std::move(entry));
   }
 }
 
@@ -2522,6 +2683,7 @@ void TextureCacheBase::FlushEFBCopy(TCacheEntry* entry)
   u8* const dst = memory.GetPointerForRange(entry->addr, covered_range);
   WriteEFBCopyToRAM(dst, entry->pending_efb_copy_width, entry->pending_efb_copy_height,
                     entry->memory_stride, std::move(entry->pending_efb_copy));
+  memory.RecordWrite(entry->addr, covered_range);
 
   // If the EFB copy was invalidated (e.g. the bloom case mentioned in InvalidateTexture), we don't
   // need to do anything more. The entry will be automatically deleted by smart pointers
@@ -2693,6 +2855,31 @@ TextureCacheBase::FindMatchingTextureFromPool(const TextureConfig& config)
   return matching_iter != range.second ? matching_iter : m_texture_pool.end();
 }
 
+TextureCacheBase::TexAddrCache::iterator TextureCacheBase::AddToTextureCache(u32 address,
+                                                                            RcTcacheEntry entry)
+{
+  entry->cache_size_in_bytes = entry->size_in_bytes;
+  m_texture_size_bound.Add(entry->cache_size_in_bytes);
+
+  const bool add_to_textures_by_key = !entry->IsEfbCopy();
+  if (add_to_textures_by_key)
+  {
+    entry->cache_key = GetTextureCacheKey(address, entry->format, entry->native_width,
+                                          entry->native_height, entry->hash);
+    entry->is_in_textures_by_key = true;
+  }
+
+  else
+  {
+    m_efb_copy_counts[address]++;
+  }
+
+  const auto iter = m_textures_by_address.emplace(address, std::move(entry));
+  if (add_to_textures_by_key)
+    m_textures_by_key.Insert(iter->second->cache_key, iter);
+  return iter;
+}
+
 TextureCacheBase::TexAddrCache::iterator TextureCacheBase::GetTexCacheIter(TCacheEntry* entry)
 {
   auto iter_range = m_textures_by_address.equal_range(entry->addr);
@@ -2712,12 +2899,10 @@ std::pair<TextureCacheBase::TexAddrCache::iterator, TextureCacheBase::TexAddrCac
 TextureCacheBase::FindOverlappingTextures(u32 addr, u32 size_in_bytes)
 {
   // We index by the starting address only, so there is no way to query all textures
-  // which end after the given addr. But the GC textures have a limited size, so we
-  // look for all textures which have a start address bigger than addr minus the maximal
-  // texture size. But this yields false-positives which must be checked later on.
-
-  // 1024 x 1024 texel times 8 nibbles per texel
-  constexpr u32 max_texture_size = 1024 * 1024 * 4;
+  // which end after the given addr. But the textures in the cache have a limited size, so we
+  // look for all textures which have a start address bigger than addr minus the size of the
+  // largest one. But this yields false-positives which must be checked later on.
+  const u32 max_texture_size = m_texture_size_bound.GetMaxSize();
   u32 lower_addr = addr > max_texture_size ? addr - max_texture_size : 0;
   auto begin = m_textures_by_address.lower_bound(lower_addr);
   auto end = m_textures_by_address.upper_bound(addr + size_in_bytes);
@@ -2769,6 +2954,19 @@ TextureCacheBase::InvalidateTexture(TexAddrCache::iterator iter, bool discard_pe
   }
   entry->invalidated = true;
 
+  m_texture_size_bound.Remove(entry->cache_size_in_bytes);
+  if (entry->is_in_textures_by_key)
+  {
+    m_textures_by_key.Remove(entry->cache_key, iter);
+    entry->is_in_textures_by_key = false;
+  }
+  if (entry->IsEfbCopy())
+  {
+    const auto count = m_efb_copy_counts.find(iter->first);
+    if (count != m_efb_copy_counts.end() && --count->second == 0)
+      m_efb_copy_counts.erase(count);
+  }
+
   return m_textures_by_address.erase(iter);
 }
 
@@ -25,8 +25,10 @@
 #include "VideoCommon/Assets/CustomAsset.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/HiresTextures.h"
+#include "VideoCommon/TextureCacheIndex.h"
 #include "VideoCommon/TextureConfig.h"
 #include "VideoCommon/TextureDecoder.h"
+#include "VideoCommon/TextureDecoderPool.h"
 #include "VideoCommon/TextureInfo.h"
 #include "VideoCommon/TextureUtils.h"
 #include "VideoCommon/VideoEvents.h"
@@ -156,6 +158,12 @@ struct TCacheEntry
   // removing the cache entry
   std::multimap<u64, std::shared_ptr<TCacheEntry>>::iterator textures_by_hash_iter;
 
+  // The key and size this entry was added to the texture cache with, so that it can be removed
+  // from m_textures_by_key and m_texture_size_bound even if it changed since
+  TextureCacheKey cache_key;
+  u32 cache_size_in_bytes = 0;
+  bool is_in_textures_by_key = false;
+
   // This is used to keep track of both:
   //   * efb copies used by this partially updated texture
   //   * partially updated textures which refer to this efb copy
@@ -369,13 +377,24 @@ private:
 
   void CheckTempSize(size_t required_size);
 
+  // Hashes texture data in RAM. If the memory wasn't written to since the range was last hashed,
+  // returns the previous hash instead.
+  u64 HashTextureMemory(u32 address, u32 size, const u8* data, int safety_color_sample_size);
+
+  // Decodes the levels of a texture into dst one after another, on all texture decoding threads.
+  void DecodeTextureLevelsInParallel(const TextureInfo& texture_info, u32 levels, u8* dst);
+
   RcTcacheEntry AllocateCacheEntry(const TextureConfig& config);
   std::optional<TexPoolEntry> AllocateTexture(const TextureConfig& config);
   TexPool::iterator FindMatchingTextureFromPool(const TextureConfig& config);
   TexAddrCache::iterator GetTexCacheIter(TCacheEntry* entry);
 
+  // Adds the entry to m_textures_by_address, and to the indices which are kept alongside it
+  TexAddrCache::iterator AddToTextureCache(u32 address, RcTcacheEntry entry);
+
   // Return all possible overlapping textures. As addr+size of the textures is not
-  // indexed, this may return false positives.
+  // indexed, this may return false positives. The range only extends back by the size of the
+  // largest texture in the cache.
   std::pair<TexAddrCache::iterator, TexAddrCache::iterator>
   FindOverlappingTextures(u32 addr, u32 size_in_bytes);
 
@@ -415,6 +434,29 @@ private:
   // All textures in here will also be in m_textures_by_address
   TexHashCache m_textures_by_hash;
 
+  // m_textures_by_key indexes all entries of m_textures_by_address except for EFB copies by
+  // everything that has to match to reuse them, so that looking up a texture which is already in
+  // the cache doesn't have to walk all entries at its address
+  TextureCacheIndex<TexAddrCache::iterator> m_textures_by_key;
+
+  // Number of EFB copies in m_textures_by_address at each address. Lookups at an address with EFB
+  // copies can't use m_textures_by_key, as the EFB copies take precedence over normal textures.
+  std::unordered_map<u32, u32> m_efb_copy_counts;
+
+  // The largest size of all entries in m_textures_by_address, for FindOverlappingTextures
+  TextureSizeBound m_texture_size_bound;
+
+  // Hashes of texture data by address and size, along with the generation of RAM writes that they
+  // are valid for, see Memory::PageWriteTracker
+  struct TextureMemoryHash
+  {
+    u64 hash;
+    u64 generation;
+    int safety_color_sample_size;
+  };
+  static constexpr size_t MAX_TEXTURE_MEMORY_HASHES = 0x4000;
+  std::unordered_map<u64, TextureMemoryHash> m_texture_memory_hashes;
+
   // m_bound_textures are actually active in the current draw
   // It's valid for textures to be in here after they've been invalidated
   std::array<RcTcacheEntry, 8> m_bound_textures{};
@@ -461,6 +503,9 @@ private:
   // readbacks, saving the overhead of allocating a new buffer every time.
   std::unique_ptr<AbstractStagingTexture> m_readback_texture;
 
+  // Threads for decoding large textures on the CPU.
+  TextureDecoderPool m_decoder_pool;
+
   void OnFrameEnd();
 
   Common::EventHook m_frame_event =
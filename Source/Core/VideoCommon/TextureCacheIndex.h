@@ -0,0 +1,217 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "Common/Assert.h"
+#include "Common/CommonTypes.h"
+
+// Everything that has to match for a texture cache entry to be reused for a texture.
+struct TextureCacheKey
+{
+  u32 address = 0;
+  // The texture format, and for color indexed textures the TLUT format in the upper bits.
+  u32 format = 0;
+  u32 width = 0;
+  u32 height = 0;
+  u64 hash = 0;
+
+  bool operator==(const TextureCacheKey&) const = default;
+};
+
+// Hash table from TextureCacheKey to values, using open addressing with linear probing.
+//
+// The probe sequence only reads a dense array of 32-bit tags, which holds 16 slots per cache line,
+// and the keys are compared only for slots with a matching tag. Removal shifts the following
+// entries back instead of leaving tombstones, so probe sequences don't degrade over time. Several
+// values can be stored under the same key.
+template <typename T>
+class TextureCacheIndex
+{
+public:
+  struct FindResult
+  {
+    T* value;
+    // The number of slots that were looked at, including the final empty one.
+    u32 probes;
+  };
+
+  void Insert(const TextureCacheKey& key, T value)
+  {
+    if ((m_size + 1) * 2 > m_tags.size())
+      Rehash(std::max<size_t>(m_tags.size() * 2, MIN_CAPACITY));
+
+    InsertWithoutGrowing(key, std::move(value), HashKey(key));
+    m_size++;
+  }
+
+  // Returns the first value stored under the key for which the predicate returns true.
+  template <typename Predicate>
+  FindResult FindIf(const TextureCacheKey& key, Predicate&& predicate)
+  {
+    if (m_size == 0)
+      return {nullptr, 0};
+
+    const u32 tag = HashKey(key);
+    u32 probes = 1;
+    for (size_t i = tag & GetMask(); m_tags[i] != EMPTY_TAG; i = (i + 1) & GetMask(), probes++)
+    {
+      if (m_tags[i] == tag && m_slots[i].key == key && predicate(m_slots[i].value))
+        return {&m_slots[i].value, probes};
+    }
+    return {nullptr, probes};
+  }
+
+  // Removes a value that was stored under the key. Returns false if it wasn't found.
+  bool Remove(const TextureCacheKey& key, const T& value)
+  {
+    if (m_size == 0)
+      return false;
+
+    const u32 tag = HashKey(key);
+    for (size_t i = tag & GetMask(); m_tags[i] != EMPTY_TAG; i = (i + 1) & GetMask())
+    {
+      if (m_tags[i] == tag && m_slots[i].key == key && m_slots[i].value == value)
+      {
+        Erase(i);
+        m_size--;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void Clear()
+  {
+    m_tags.clear();
+    m_slots.clear();
+    m_size = 0;
+  }
+
+  size_t Size() const { return m_size; }
+
+  // Returns the number of bytes allocated for the table.
+  size_t GetMemoryUsage() const
+  {
+    return m_tags.capacity() * sizeof(u32) + m_slots.capacity() * sizeof(Slot);
+  }
+
+private:
+  struct Slot
+  {
+    TextureCacheKey key;
+    T value{};
+  };
+
+  static constexpr size_t MIN_CAPACITY = 64;
+
+  // Tags have the top bit set, so that they are never equal to EMPTY_TAG. The low bits select the
+  // slot a key is placed in if there is no collision.
+  static constexpr u32 EMPTY_TAG = 0;
+
+  static u32 HashKey(const TextureCacheKey& key)
+  {
+    // Texture hashes are already well distributed, the other fields only have to be mixed in.
+    u64 hash = key.hash ^ (static_cast<u64>(key.address) * 0x9E3779B97F4A7C15ULL);
+    hash ^= (static_cast<u64>(key.format) << 48) ^ (static_cast<u64>(key.width) << 24) ^
+            static_cast<u64>(key.height);
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 33;
+    return static_cast<u32>(hash) | 0x80000000;
+  }
+
+  size_t GetMask() const { return m_tags.size() - 1; }
+
+  void InsertWithoutGrowing(const TextureCacheKey& key, T value, u32 tag)
+  {
+    size_t i = tag & GetMask();
+    while (m_tags[i] != EMPTY_TAG)
+      i = (i + 1) & GetMask();
+
+    m_tags[i] = tag;
+    m_slots[i].key = key;
+    m_slots[i].value = std::move(value);
+  }
+
+  void Erase(size_t i)
+  {
+    // Move back every following entry of the cluster that would still be reachable from its home
+    // slot if it was placed in the hole.
+    for (size_t j = (i + 1) & GetMask(); m_tags[j] != EMPTY_TAG; j = (j + 1) & GetMask())
+    {
+      const size_t home = m_tags[j] & GetMask();
+      const bool reachable = i <= j ? (home <= i || home > j) : (home <= i && home > j);
+      if (!reachable)
+        continue;
+
+      m_tags[i] = m_tags[j];
+      m_slots[i] = std::move(m_slots[j]);
+      i = j;
+    }
+
+    m_tags[i] = EMPTY_TAG;
+    m_slots[i] = Slot{};
+  }
+
+  void Rehash(size_t capacity)
+  {
+    DEBUG_ASSERT(std::has_single_bit(capacity));
+
+    std::vector<u32> old_tags(capacity, EMPTY_TAG);
+    std::vector<Slot> old_slots(capacity);
+    std::swap(old_tags, m_tags);
+    std::swap(old_slots, m_slots);
+
+    for (size_t i = 0; i < old_tags.size(); i++)
+    {
+      if (old_tags[i] != EMPTY_TAG)
+        InsertWithoutGrowing(old_slots[i].key, std::move(old_slots[i].value), old_tags[i]);
+    }
+  }
+
+  std::vector<u32> m_tags;
+  std::vector<Slot> m_slots;
+  size_t m_size = 0;
+};
+
+// Keeps an upper bound of the sizes of all textures in the cache. The cache is only ordered by
+// start address, so overlap queries have to look back by the size of the largest texture, which is
+// usually far smaller than the largest texture that is possible.
+class TextureSizeBound
+{
+public:
+  void Add(u32 size) { m_counts[GetBucket(size)]++; }
+
+  void Remove(u32 size)
+  {
+    DEBUG_ASSERT(m_counts[GetBucket(size)] != 0);
+    m_counts[GetBucket(size)]--;
+  }
+
+  void Clear() { m_counts = {}; }
+
+  // Returns a size that is at least as large as every size that is currently added.
+  u32 GetMaxSize() const
+  {
+    for (size_t bucket = m_counts.size(); bucket-- > 0;)
+    {
+      if (m_counts[bucket] != 0)
+        return bucket == 32 ? 0xFFFFFFFF : static_cast<u32>((u64{1} << bucket) - 1);
+    }
+    return 0;
+  }
+
+private:
+  // Sizes are grouped by their bit width, bucket n holds sizes below 2^n.
+  static size_t GetBucket(u32 size) { return static_cast<size_t>(std::bit_width(size)); }
+
+  std::array<u32, 33> m_counts{};
+};
@@ -6,6 +6,7 @@
 #include <array>
 #include <span>
 #include <tuple>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/EnumFormatter.h"
@@ -202,7 +203,37 @@ void TexDecoder_DecodeTexelRGBA8FromTmem(u8* dst, const u8* src_ar, const u8* sr
 void TexDecoder_DecodeXFB(u8* dst, const u8* src, u32 width, u32 height, u32 stride);
 
 void TexDecoder_SetTexFmtOverlayOptions(bool enable, bool center);
+// Draws the texture format overlay onto a decoded texture if it is enabled. TexDecoder_Decode does
+// this by itself; it's only needed after decoding with _TexDecoder_DecodeImpl.
+void TexDecoder_DrawOverlay(u8* dst, int width, int height, TextureFormat texformat);
 
-/* Internal method, implemented by TextureDecoder_Generic and TextureDecoder_x64. */
+// Instruction sets the texture decoders are written for.
+enum class TexDecoderISA
+{
+  Generic,
+  SSE2,
+  SSSE3,
+  AVX2,
+  NEON,
+};
+template <>
+struct fmt::formatter<TexDecoderISA> : EnumFormatter<TexDecoderISA::NEON>
+{
+  constexpr formatter() : EnumFormatter({"Generic", "SSE2", "SSSE3", "AVX2", "NEON"}) {}
+};
+
+// Returns the instruction sets the host CPU can decode textures with, from the generic decoder up
+// to the one TexDecoder_Decode uses.
+std::vector<TexDecoderISA> TexDecoder_GetSupportedISAs();
+
+/* Internal methods, implemented by TextureDecoder_Generic, TextureDecoder_x64 and
+ * TextureDecoder_ARM64. */
 void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, TextureFormat texformat,
                             const u8* tlut, TLUTFormat tlutfmt);
+// Decodes with the given instruction set, to test the decoders against each other.
+void _TexDecoder_DecodeImplWithISA(TexDecoderISA isa, u32* dst, const u8* src, int width,
+                                   int height, TextureFormat texformat, const u8* tlut,
+                                   TLUTFormat tlutfmt);
+// The reference decoder, which is written in plain C++ and built on every host.
+void _TexDecoder_DecodeImplGeneric(u32* dst, const u8* src, int width, int height,
+                                   TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt);
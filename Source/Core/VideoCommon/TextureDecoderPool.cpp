@@ -0,0 +1,94 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/TextureDecoderPool.h"
+
+#include <algorithm>
+
+#include <fmt/format.h>
+
+#include "VideoCommon/TextureDecoder.h"
+
+// Bands are made at least this large (in decoded bytes), so the threads don't spend more time
+// fetching bands than decoding them.
+static constexpr u32 MIN_BAND_SIZE = 64 * 1024;
+
+// Splitting a texture into more bands than this doesn't balance the load between threads any
+// better.
+static constexpr u32 MAX_BANDS_PER_THREAD = 4;
+
+TextureDecoderPool::TextureDecoderPool() = default;
+
+TextureDecoderPool::~TextureDecoderPool() = default;
+
+void TextureDecoderPool::SetThreadCount(u32 count)
+{
+  count = std::max<u32>(count, 1);
+  if (GetThreadCount() == count)
+    return;
+
+  m_workers.clear();
+  for (u32 i = 1; i < count; i++)
+  {
+    m_workers.push_back(std::make_unique<Common::WorkQueueThreadSP<u32>>(
+        fmt::format("Texture Decoder {}", i), [this](u32) { DecodeBands(); }));
+  }
+}
+
+void TextureDecoderPool::Add(u8* dst, const u8* src, int width, int height,
+                             TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt)
+{
+  if (width <= 0 || height <= 0)
+    return;
+
+  const u32 texture = static_cast<u32>(m_textures.size());
+  m_textures.push_back({dst, src, width, height, texformat, tlut, tlutfmt});
+
+  // Bands have to start at a block row.
+  const int block_height = TexDecoder_GetBlockHeightInTexels(texformat);
+  const int block_rows = (height + block_height - 1) / block_height;
+  const u32 block_row_size = static_cast<u32>(width) * block_height * sizeof(u32);
+  const u32 max_bands = GetThreadCount() * MAX_BANDS_PER_THREAD;
+  const u32 min_rows_per_band = (MIN_BAND_SIZE + block_row_size - 1) / block_row_size;
+  const u32 num_bands = std::clamp<u32>(block_rows / min_rows_per_band, 1, max_bands);
+  const int rows_per_band = (block_rows + num_bands - 1) / num_bands * block_height;
+
+  for (int row = 0; row < height; row += rows_per_band)
+    m_bands.push_back({texture, row, std::min(rows_per_band, height - row)});
+}
+
+void TextureDecoderPool::Run()
+{
+  if (m_bands.empty())
+    return;
+
+  const size_t num_workers = std::min(m_workers.size(), m_bands.size() - 1);
+  m_next_band.store(0, std::memory_order_relaxed);
+  for (size_t i = 0; i < num_workers; i++)
+    m_workers[i]->Push(0);
+  DecodeBands();
+  for (size_t i = 0; i < num_workers; i++)
+    m_workers[i]->WaitForCompletion();
+
+  for (const Texture& texture : m_textures)
+    TexDecoder_DrawOverlay(texture.dst, texture.width, texture.height, texture.texformat);
+
+  m_textures.clear();
+  m_bands.clear();
+}
+
+void TextureDecoderPool::DecodeBands()
+{
+  for (u32 i = m_next_band.fetch_add(1, std::memory_order_relaxed); i < m_bands.size();
+       i = m_next_band.fetch_add(1, std::memory_order_relaxed))
+  {
+    const Band& band = m_bands[i];
+    const Texture& texture = m_textures[band.texture];
+
+    u8* const dst = texture.dst + static_cast<size_t>(band.first_row) * texture.width * sizeof(u32);
+    const u8* const src = texture.src + TexDecoder_GetTextureSizeInBytes(
+                                            texture.width, band.first_row, texture.texformat);
+    _TexDecoder_DecodeImpl(reinterpret_cast<u32*>(dst), src, texture.width, band.num_rows,
+                           texture.texformat, texture.tlut, texture.tlutfmt);
+  }
+}
@@ -0,0 +1,69 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/WorkQueueThread.h"
+
+enum class TextureFormat;
+enum class TLUTFormat;
+
+// Decodes large textures on several threads.
+//
+// Textures are stored as rows of blocks which decode independently of each other, so every queued
+// texture is split into bands of block rows, and the bands of all textures (usually the levels of
+// a mip chain) are shared among the threads. The results are identical to TexDecoder_Decode.
+class TextureDecoderPool
+{
+public:
+  TextureDecoderPool();
+  ~TextureDecoderPool();
+
+  TextureDecoderPool(const TextureDecoderPool&) = delete;
+  TextureDecoderPool& operator=(const TextureDecoderPool&) = delete;
+
+  // The thread calling Run decodes as well, so a count of 1 doesn't start any worker threads.
+  void SetThreadCount(u32 count);
+  u32 GetThreadCount() const { return static_cast<u32>(m_workers.size()) + 1; }
+
+  // Queues a texture, taking the same arguments as TexDecoder_Decode. Like there, the size has to
+  // be a multiple of the block size. The source data and the destination buffer have to stay valid
+  // until Run returns.
+  void Add(u8* dst, const u8* src, int width, int height, TextureFormat texformat, const u8* tlut,
+           TLUTFormat tlutfmt);
+
+  // Decodes all queued textures and returns when they are done.
+  void Run();
+
+private:
+  struct Texture
+  {
+    u8* dst;
+    const u8* src;
+    int width;
+    int height;
+    TextureFormat texformat;
+    const u8* tlut;
+    TLUTFormat tlutfmt;
+  };
+
+  struct Band
+  {
+    u32 texture;
+    int first_row;
+    int num_rows;
+  };
+
+  void DecodeBands();
+
+  std::vector<Texture> m_textures;
+  std::vector<Band> m_bands;
+  std::atomic<u32> m_next_band = 0;
+
+  std::vector<std::unique_ptr<Common::WorkQueueThreadSP<u32>>> m_workers;
+};
@@ -0,0 +1,467 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/TextureDecoder.h"
+
+#include <arm_neon.h>
+#include <cstring>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/MsgHandler.h"
+#include "Common/Swap.h"
+
+#include "VideoCommon/LookUpTables.h"
+#include "VideoCommon/TextureDecoder_Util.h"
+
+// NEON texture decoders.
+// Texels are decoded as one byte plane per channel, which keeps all arithmetic in 8-bit lanes.
+// The planes are interleaved into RGBA8 when they are stored. Color indexed textures decode
+// their palette into planes first, so that each texel only takes a table lookup.
+
+static inline uint8x16_t Expand3To8(uint8x16_t values)
+{
+  return vorrq_u8(vorrq_u8(vshlq_n_u8(values, 5), vshlq_n_u8(values, 2)), vshrq_n_u8(values, 1));
+}
+
+static inline uint8x16_t Expand4To8(uint8x16_t values)
+{
+  return vorrq_u8(vshlq_n_u8(values, 4), values);
+}
+
+static inline uint8x16_t Expand5To8(uint8x16_t values)
+{
+  return vorrq_u8(vshlq_n_u8(values, 3), vshrq_n_u8(values, 2));
+}
+
+static inline uint8x16_t Expand6To8(uint8x16_t values)
+{
+  return vorrq_u8(vshlq_n_u8(values, 2), vshrq_n_u8(values, 4));
+}
+
+// Decodes 16 texels of a 16-bit format, given as the planes of their first and second byte in
+// memory. RGB565 and RGB5A3 are big endian, so the first byte holds the high bits.
+static inline uint8x16x4_t DecodeTexels16(uint8x16_t first, uint8x16_t second, TLUTFormat format)
+{
+  const uint8x16_t mask_x03 = vdupq_n_u8(0x03);
+  const uint8x16_t mask_x07 = vdupq_n_u8(0x07);
+  const uint8x16_t mask_x0f = vdupq_n_u8(0x0f);
+  const uint8x16_t mask_x1f = vdupq_n_u8(0x1f);
+
+  uint8x16x4_t rgba;
+  switch (format)
+  {
+  case TLUTFormat::IA8:
+    rgba.val[0] = second;
+    rgba.val[1] = second;
+    rgba.val[2] = second;
+    rgba.val[3] = first;
+    break;
+
+  case TLUTFormat::RGB565:
+    rgba.val[0] = Expand5To8(vshrq_n_u8(first, 3));
+    rgba.val[1] =
+        Expand6To8(vorrq_u8(vshlq_n_u8(vandq_u8(first, mask_x07), 3), vshrq_n_u8(second, 5)));
+    rgba.val[2] = Expand5To8(vandq_u8(second, mask_x1f));
+    rgba.val[3] = vdupq_n_u8(0xff);
+    break;
+
+  case TLUTFormat::RGB5A3:
+  {
+    // The top bit selects between RGB555 and ARGB3444.
+    const uint8x16_t opaque = vtstq_u8(first, vdupq_n_u8(0x80));
+
+    const uint8x16_t r5 = Expand5To8(vandq_u8(vshrq_n_u8(first, 2), mask_x1f));
+    const uint8x16_t g5 =
+        Expand5To8(vorrq_u8(vshlq_n_u8(vandq_u8(first, mask_x03), 3), vshrq_n_u8(second, 5)));
+    const uint8x16_t b5 = Expand5To8(vandq_u8(second, mask_x1f));
+
+    const uint8x16_t a3 = Expand3To8(vandq_u8(vshrq_n_u8(first, 4), mask_x07));
+    const uint8x16_t r4 = Expand4To8(vandq_u8(first, mask_x0f));
+    const uint8x16_t g4 = Expand4To8(vshrq_n_u8(second, 4));
+    const uint8x16_t b4 = Expand4To8(vandq_u8(second, mask_x0f));
+
+    rgba.val[0] = vbslq_u8(opaque, r5, r4);
+    rgba.val[1] = vbslq_u8(opaque, g5, g4);
+    rgba.val[2] = vbslq_u8(opaque, b5, b4);
+    rgba.val[3] = vorrq_u8(opaque, a3);
+    break;
+  }
+
+  default:
+    rgba.val[0] = vdupq_n_u8(0);
+    rgba.val[1] = vdupq_n_u8(0);
+    rgba.val[2] = vdupq_n_u8(0);
+    rgba.val[3] = vdupq_n_u8(0);
+    break;
+  }
+  return rgba;
+}
+
+// Stores the 16 texels of a 4x4 block, one row of 4 texels at a time.
+static inline void StoreBlockRows4(u32* dst, int width, const uint8x16x4_t& rgba)
+{
+  const uint16x8_t rg_low = vreinterpretq_u16_u8(vzip1q_u8(rgba.val[0], rgba.val[1]));
+  const uint16x8_t rg_high = vreinterpretq_u16_u8(vzip2q_u8(rgba.val[0], rgba.val[1]));
+  const uint16x8_t ba_low = vreinterpretq_u16_u8(vzip1q_u8(rgba.val[2], rgba.val[3]));
+  const uint16x8_t ba_high = vreinterpretq_u16_u8(vzip2q_u8(rgba.val[2], rgba.val[3]));
+
+  vst1q_u8(reinterpret_cast<u8*>(dst + width * 0),
+           vreinterpretq_u8_u16(vzip1q_u16(rg_low, ba_low)));
+  vst1q_u8(reinterpret_cast<u8*>(dst + width * 1),
+           vreinterpretq_u8_u16(vzip2q_u16(rg_low, ba_low)));
+  vst1q_u8(reinterpret_cast<u8*>(dst + width * 2),
+           vreinterpretq_u8_u16(vzip1q_u16(rg_high, ba_high)));
+  vst1q_u8(reinterpret_cast<u8*>(dst + width * 3),
+           vreinterpretq_u8_u16(vzip2q_u16(rg_high, ba_high)));
+}
+
+// Stores 16 texels as two rows of 8 texels.
+static inline void StoreBlockRows8(u32* dst, int width, const uint8x16x4_t& rgba)
+{
+  uint8x8x4_t row;
+  for (int i = 0; i < 4; i++)
+    row.val[i] = vget_low_u8(rgba.val[i]);
+  vst4_u8(reinterpret_cast<u8*>(dst), row);
+  for (int i = 0; i < 4; i++)
+    row.val[i] = vget_high_u8(rgba.val[i]);
+  vst4_u8(reinterpret_cast<u8*>(dst + width), row);
+}
+
+// Stores 16 intensities as two rows of 8 texels.
+static inline void StoreIntensityRows8(u32* dst, int width, uint8x16_t intensities)
+{
+  const uint8x8_t low = vget_low_u8(intensities);
+  const uint8x8_t high = vget_high_u8(intensities);
+  vst4_u8(reinterpret_cast<u8*>(dst), uint8x8x4_t{{low, low, low, low}});
+  vst4_u8(reinterpret_cast<u8*>(dst + width), uint8x8x4_t{{high, high, high, high}});
+}
+
+// Splits 16 bytes of 4-bit values, 4 bytes per row, into one byte per value. The results hold the
+// rows 0-1 and 2-3 respectively.
+static inline void SplitNibbles(uint8x16_t bytes, uint8x16_t* rows01, uint8x16_t* rows23)
+{
+  const uint8x16_t high = vshrq_n_u8(bytes, 4);
+  const uint8x16_t low = vandq_u8(bytes, vdupq_n_u8(0x0f));
+  *rows01 = vzip1q_u8(high, low);
+  *rows23 = vzip2q_u8(high, low);
+}
+
+static inline uint8x16x4_t DecodePaletteEntries(const u8* tlut, TLUTFormat tlutfmt)
+{
+  const uint8x16x2_t entries = vld2q_u8(tlut);
+  return DecodeTexels16(entries.val[0], entries.val[1], tlutfmt);
+}
+
+static inline uint8x16x4_t LookUpPalette16(const uint8x16x4_t& palette, uint8x16_t indices)
+{
+  uint8x16x4_t rgba;
+  for (int i = 0; i < 4; i++)
+    rgba.val[i] = vqtbl1q_u8(palette.val[i], indices);
+  return rgba;
+}
+
+static void TexDecoder_DecodeImpl_I4_NEON(u32* dst, const u8* src, int width, int height)
+{
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0; x < width; x += 8, src += 32)
+    {
+      u32* block_dst = dst + y * width + x;
+      for (int i = 0; i < 2; i++)
+      {
+        uint8x16_t rows01, rows23;
+        SplitNibbles(vld1q_u8(src + i * 16), &rows01, &rows23);
+        StoreIntensityRows8(block_dst + width * (i * 4 + 0), width, Expand4To8(rows01));
+        StoreIntensityRows8(block_dst + width * (i * 4 + 2), width, Expand4To8(rows23));
+      }
+    }
+  }
+}
+
+static void TexDecoder_DecodeImpl_I8_NEON(u32* dst, const u8* src, int width, int height)
+{
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0; x < width; x += 8, src += 32)
+    {
+      u32* block_dst = dst + y * width + x;
+      StoreIntensityRows8(block_dst, width, vld1q_u8(src));
+      StoreIntensityRows8(block_dst + width * 2, width, vld1q_u8(src + 16));
+    }
+  }
+}
+
+static void TexDecoder_DecodeImpl_IA4_NEON(u32* dst, const u8* src, int width, int height)
+{
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0; x < width; x += 8, src += 32)
+    {
+      u32* block_dst = dst + y * width + x;
+      for (int i = 0; i < 2; i++)
+      {
+        const uint8x16_t texels = vld1q_u8(src + i * 16);
+        const uint8x16_t intensity = Expand4To8(vandq_u8(texels, vdupq_n_u8(0x0f)));
+        const uint8x16_t alpha = Expand4To8(vshrq_n_u8(texels, 4));
+        StoreBlockRows8(block_dst + width * (i * 2), width,
+                        uint8x16x4_t{{intensity, intensity, intensity, alpha}});
+      }
+    }
+  }
+}
+
+static void TexDecoder_DecodeImpl_Texels16_NEON(u32* dst, const u8* src, int width, int height,
+                                                TLUTFormat format)
+{
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0; x < width; x += 4, src += 32)
+    {
+      const uint8x16x2_t texels = vld2q_u8(src);
+      StoreBlockRows4(dst + y * width + x, width,
+                      DecodeTexels16(texels.val[0], texels.val[1], format));
+    }
+  }
+}
+
+static void TexDecoder_DecodeImpl_RGBA8_NEON(u32* dst, const u8* src, int width, int height)
+{
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0; x < width; x += 4, src += 64)
+    {
+      // A block holds 16 AR pairs followed by 16 GB pairs.
+      const uint8x16x2_t ar = vld2q_u8(src);
+      const uint8x16x2_t gb = vld2q_u8(src + 32);
+      StoreBlockRows4(dst + y * width + x, width,
+                      uint8x16x4_t{{ar.val[1], gb.val[0], gb.val[1], ar.val[0]}});
+    }
+  }
+}
+
+static void TexDecoder_DecodeImpl_C4_NEON(u32* dst, const u8* src, int width, int height,
+                                          const u8* tlut, TLUTFormat tlutfmt)
+{
+  const uint8x16x4_t palette = DecodePaletteEntries(tlut, tlutfmt);
+
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0; x < width; x += 8, src += 32)
+    {
+      u32* block_dst = dst + y * width + x;
+      for (int i = 0; i < 2; i++)
+      {
+        uint8x16_t rows01, rows23;
+        SplitNibbles(vld1q_u8(src + i * 16), &rows01, &rows23);
+        StoreBlockRows8(block_dst + width * (i * 4 + 0), width, LookUpPalette16(palette, rows01));
+        StoreBlockRows8(block_dst + width * (i * 4 + 2), width, LookUpPalette16(palette, rows23));
+      }
+    }
+  }
+}
+
+static void TexDecoder_DecodeImpl_C8_NEON(u32* dst, const u8* src, int width, int height,
+                                          const u8* tlut, TLUTFormat tlutfmt)
+{
+  // Each channel of the 256 palette entries takes four 64-byte tables.
+  uint8x16x4_t palette[4][4];
+  for (int i = 0; i < 16; i++)
+  {
+    const uint8x16x4_t entries = DecodePaletteEntries(tlut + i * 16 * sizeof(u16), tlutfmt);
+    for (int channel = 0; channel < 4; channel++)
+      palette[channel][i / 4].val[i % 4] = entries.val[channel];
+  }
+
+  const uint8x16_t offset = vdupq_n_u8(64);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0; x < width; x += 8, src += 32)
+    {
+      u32* block_dst = dst + y * width + x;
+      for (int i = 0; i < 2; i++)
+      {
+        // Indices outside of a table leave the result of the previous lookup untouched.
+        const uint8x16_t indices0 = vld1q_u8(src + i * 16);
+        const uint8x16_t indices1 = vsubq_u8(indices0, offset);
+        const uint8x16_t indices2 = vsubq_u8(indices1, offset);
+        const uint8x16_t indices3 = vsubq_u8(indices2, offset);
+
+        uint8x16x4_t rgba;
+        for (int channel = 0; channel < 4; channel++)
+        {
+          uint8x16_t value = vqtbl4q_u8(palette[channel][0], indices0);
+          value = vqtbx4q_u8(value, palette[channel][1], indices1);
+          value = vqtbx4q_u8(value, palette[channel][2], indices2);
+          rgba.val[channel] = vqtbx4q_u8(value, palette[channel][3], indices3);
+        }
+        StoreBlockRows8(block_dst + width * (i * 2), width, rgba);
+      }
+    }
+  }
+}
+
+static void TexDecoder_DecodeImpl_C14X2_NEON(u32* dst, const u8* src, int width, int height,
+                                             const u8* tlut, TLUTFormat tlutfmt)
+{
+  const u16* tlut16 = reinterpret_cast<const u16*>(tlut);
+
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0; x < width; x += 4, src += 32)
+    {
+      // The palette is too large for table lookups, so fetch the entries first and decode them
+      // like a block of 16-bit texels.
+      alignas(16) u16 entries[16];
+      for (int i = 0; i < 16; i++)
+      {
+        u16 index;
+        std::memcpy(&index, src + i * sizeof(u16), sizeof(u16));
+        entries[i] = tlut16[Common::swap16(index) & 0x3FFF];
+      }
+
+      const uint8x16x2_t texels = vld2q_u8(reinterpret_cast<const u8*>(entries));
+      StoreBlockRows4(dst + y * width + x, width,
+                      DecodeTexels16(texels.val[0], texels.val[1], tlutfmt));
+    }
+  }
+}
+
+static inline void DecodeDXTBlock_NEON(u32* dst, const DXTBlock* src, int width)
+{
+  const u16 c1 = Common::swap16(src->color1);
+  const u16 c2 = Common::swap16(src->color2);
+  const int blue1 = Convert5To8(c1 & 0x1F);
+  const int blue2 = Convert5To8(c2 & 0x1F);
+  const int green1 = Convert6To8((c1 >> 5) & 0x3F);
+  const int green2 = Convert6To8((c2 >> 5) & 0x3F);
+  const int red1 = Convert5To8((c1 >> 11) & 0x1F);
+  const int red2 = Convert5To8((c2 >> 11) & 0x1F);
+
+  alignas(16) u32 colors[4];
+  colors[0] = MakeRGBA(red1, green1, blue1, 255);
+  colors[1] = MakeRGBA(red2, green2, blue2, 255);
+  if (c1 > c2)
+  {
+    colors[2] =
+        MakeRGBA(DXTBlend(red2, red1), DXTBlend(green2, green1), DXTBlend(blue2, blue1), 255);
+    colors[3] =
+        MakeRGBA(DXTBlend(red1, red2), DXTBlend(green1, green2), DXTBlend(blue1, blue2), 255);
+  }
+  else
+  {
+    // color[3] is the same as color[2] (average of both colors), but transparent.
+    colors[2] = MakeRGBA((red1 + red2) / 2, (green1 + green2) / 2, (blue1 + blue2) / 2, 255);
+    colors[3] = MakeRGBA((red1 + red2) / 2, (green1 + green2) / 2, (blue1 + blue2) / 2, 0);
+  }
+  const uint8x16_t color_table = vld1q_u8(reinterpret_cast<const u8*>(colors));
+
+  // Each row has a byte of 2-bit indices, the leftmost texel in the top bits. Shift the index of
+  // every texel into place for all four bytes of it, then look the bytes up in the color table.
+  static constexpr s8 shifts[16] = {-6, -6, -6, -6, -4, -4, -4, -4, -2, -2, -2, -2, 0, 0, 0, 0};
+  static constexpr u8 channels[16] = {0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3};
+  const int8x16_t shift = vld1q_s8(shifts);
+  const uint8x16_t channel = vld1q_u8(channels);
+  const uint8x16_t mask_x03 = vdupq_n_u8(0x03);
+
+  for (int y = 0; y < 4; y++)
+  {
+    const uint8x16_t indices = vandq_u8(vshlq_u8(vdupq_n_u8(src->lines[y]), shift), mask_x03);
+    const uint8x16_t offsets = vorrq_u8(vshlq_n_u8(indices, 2), channel);
+    vst1q_u8(reinterpret_cast<u8*>(dst + y * width), vqtbl1q_u8(color_table, offsets));
+  }
+}
+
+static void TexDecoder_DecodeImpl_CMPR_NEON(u32* dst, const u8* src, int width, int height)
+{
+  const DXTBlock* blocks = reinterpret_cast<const DXTBlock*>(src);
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0; x < width; x += 8, blocks += 4)
+    {
+      u32* block_dst = dst + y * width + x;
+      DecodeDXTBlock_NEON(block_dst, blocks + 0, width);
+      DecodeDXTBlock_NEON(block_dst + 4, blocks + 1, width);
+      DecodeDXTBlock_NEON(block_dst + width * 4, blocks + 2, width);
+      DecodeDXTBlock_NEON(block_dst + width * 4 + 4, blocks + 3, width);
+    }
+  }
+}
+
+std::vector<TexDecoderISA> TexDecoder_GetSupportedISAs()
+{
+  return {TexDecoderISA::Generic, TexDecoderISA::NEON};
+}
+
+void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, TextureFormat texformat,
+                            const u8* tlut, TLUTFormat tlutfmt)
+{
+  _TexDecoder_DecodeImplWithISA(TexDecoderISA::NEON, dst, src, width, height, texformat, tlut,
+                                tlutfmt);
+}
+
+void _TexDecoder_DecodeImplWithISA(TexDecoderISA isa, u32* dst, const u8* src, int width,
+                                   int height, TextureFormat texformat, const u8* tlut,
+                                   TLUTFormat tlutfmt)
+{
+  if (isa != TexDecoderISA::NEON)
+  {
+    _TexDecoder_DecodeImplGeneric(dst, src, width, height, texformat, tlut, tlutfmt);
+    return;
+  }
+
+  switch (texformat)
+  {
+  case TextureFormat::C4:
+    TexDecoder_DecodeImpl_C4_NEON(dst, src, width, height, tlut, tlutfmt);
+    break;
+
+  case TextureFormat::I4:
+    TexDecoder_DecodeImpl_I4_NEON(dst, src, width, height);
+    break;
+
+  case TextureFormat::I8:
+    TexDecoder_DecodeImpl_I8_NEON(dst, src, width, height);
+    break;
+
+  case TextureFormat::C8:
+    TexDecoder_DecodeImpl_C8_NEON(dst, src, width, height, tlut, tlutfmt);
+    break;
+
+  case TextureFormat::IA4:
+    TexDecoder_DecodeImpl_IA4_NEON(dst, src, width, height);
+    break;
+
+  case TextureFormat::IA8:
+    TexDecoder_DecodeImpl_Texels16_NEON(dst, src, width, height, TLUTFormat::IA8);
+    break;
+
+  case TextureFormat::C14X2:
+    TexDecoder_DecodeImpl_C14X2_NEON(dst, src, width, height, tlut, tlutfmt);
+    break;
+
+  case TextureFormat::RGB565:
+    TexDecoder_DecodeImpl_Texels16_NEON(dst, src, width, height, TLUTFormat::RGB565);
+    break;
+
+  case TextureFormat::RGB5A3:
+    TexDecoder_DecodeImpl_Texels16_NEON(dst, src, width, height, TLUTFormat::RGB5A3);
+    break;
+
+  case TextureFormat::RGBA8:
+    TexDecoder_DecodeImpl_RGBA8_NEON(dst, src, width, height);
+    break;
+
+  case TextureFormat::CMPR:
+    TexDecoder_DecodeImpl_CMPR_NEON(dst, src, width, height);
+    break;
+
+  case TextureFormat::XFB:
+    TexDecoder_DecodeXFB(reinterpret_cast<u8*>(dst), src, width, height, width * 2);
+    break;
+
+  default:
+    PanicAlertFmt("Invalid Texture Format {}! (_TexDecoder_DecodeImpl)", texformat);
+    break;
+  }
+}
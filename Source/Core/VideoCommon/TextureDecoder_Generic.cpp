@@ -5,6 +5,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
+#include <vector>
 
 #include "Common/CPUDetect.h"
 #include "Common/CommonTypes.h"
@@ -178,8 +180,8 @@ static void DecodeDXTBlock(u32* dst, const DXTBlock* src, int pitch)
 // TODO: complete SSE2 optimization of less often used texture formats.
 // TODO: refactor algorithms using _mm_loadl_epi64 unaligned loads to prefer 128-bit aligned loads.
 
-void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, TextureFormat texformat,
-                            const u8* tlut, TLUTFormat tlutfmt)
+void _TexDecoder_DecodeImplGeneric(u32* dst, const u8* src, int width, int height,
+                                   TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt)
 {
   const int Wsteps4 = (width + 3) / 4;
   const int Wsteps8 = (width + 7) / 8;
@@ -334,3 +336,23 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
   }
 }
+
+#if !defined(_M_X86_64) && !defined(_M_ARM_64)
+std::vector<TexDecoderISA> TexDecoder_GetSupportedISAs()
+{
+  return {TexDecoderISA::Generic};
+}
+
+void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, TextureFormat texformat,
+                            const u8* tlut, TLUTFormat tlutfmt)
+{
+  _TexDecoder_DecodeImplGeneric(dst, src, width, height, texformat, tlut, tlutfmt);
+}
+
+void _TexDecoder_DecodeImplWithISA(TexDecoderISA isa, u32* dst, const u8* src, int width,
+                                   int height, TextureFormat texformat, const u8* tlut,
+                                   TLUTFormat tlutfmt)
+{
+  _TexDecoder_DecodeImplGeneric(dst, src, width, height, texformat, tlut, tlutfmt);
+}
+#endif
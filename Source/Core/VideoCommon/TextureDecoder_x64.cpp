@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <vector>
 
 #ifdef CHECK
 #include "Common/Assert.h"
@@ -1413,20 +1414,549 @@ static void TexDecoder_DecodeImpl_CMPR(u32* dst, const u8* src, int width, int h
   }
 }
 
+// AVX2 decoders.
+// A 256-bit register holds a row of 8 texels, or a whole 4x4 block of 16-bit texels, so blocks are
+// decoded with a single load and stored a row at a time. Color indexed textures decode their
+// palette first, so that each texel only takes a lookup.
+
+FUNCTION_TARGET_AVX2
+static inline void StoreBlockRows_AVX2(u32* dst, int width, __m256i rows02, __m256i rows13)
+{
+  _mm_storeu_si128((__m128i*)(dst + width * 0), _mm256_castsi256_si128(rows02));
+  _mm_storeu_si128((__m128i*)(dst + width * 1), _mm256_castsi256_si128(rows13));
+  _mm_storeu_si128((__m128i*)(dst + width * 2), _mm256_extracti128_si256(rows02, 1));
+  _mm_storeu_si128((__m128i*)(dst + width * 3), _mm256_extracti128_si256(rows13, 1));
+}
+
+// Replicates the bytes 0-3 of lane 0 and 4-7 of lane 1 four times each. When both lanes hold the
+// same 8 intensities, this makes 8 texels out of them.
+FUNCTION_TARGET_AVX2
+static inline __m256i ExpandIntensities_AVX2(__m256i intensities)
+{
+  const __m256i mask = _mm256_setr_epi8(0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4,
+                                        5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7);
+  return _mm256_shuffle_epi8(intensities, mask);
+}
+
+// Stores a row of 8 texels, with the intensities of the row in both lanes as the first qword.
+FUNCTION_TARGET_AVX2
+static inline void StoreIntensityRow_AVX2(u32* dst, __m256i intensities)
+{
+  _mm256_storeu_si256((__m256i*)dst, ExpandIntensities_AVX2(intensities));
+}
+
+// Splits the bytes of 4-bit texels into one byte per texel, the texel in the high nibble first.
+// Lane 0 of low gets the texels of the bytes 0-7, lane 1 those of the bytes 16-23, and high gets
+// the bytes 8-15 and 24-31.
+FUNCTION_TARGET_AVX2
+static inline void SplitNibbles_AVX2(__m256i bytes, __m256i* low, __m256i* high)
+{
+  const __m256i mask_x0f = _mm256_set1_epi8(0x0f);
+  const __m256i left = _mm256_and_si256(_mm256_srli_epi16(bytes, 4), mask_x0f);
+  const __m256i right = _mm256_and_si256(bytes, mask_x0f);
+  *low = _mm256_unpacklo_epi8(left, right);
+  *high = _mm256_unpackhi_epi8(left, right);
+}
+
+FUNCTION_TARGET_AVX2
+static inline __m256i Expand4To8_AVX2(__m256i values)
+{
+  return _mm256_or_si256(values, _mm256_slli_epi16(values, 4));
+}
+
+FUNCTION_TARGET_AVX2
+static inline __m256i Expand5To8_AVX2(__m256i values)
+{
+  return _mm256_or_si256(_mm256_slli_epi16(values, 3), _mm256_srli_epi16(values, 2));
+}
+
+FUNCTION_TARGET_AVX2
+static inline __m256i Expand6To8_AVX2(__m256i values)
+{
+  return _mm256_or_si256(_mm256_slli_epi16(values, 2), _mm256_srli_epi16(values, 4));
+}
+
+// Decodes 16 texels of a 16-bit format (the TLUT formats, which are also texture formats) as they
+// are stored in memory. Each 16-bit element of rg gets the red and green component of a texel, and
+// ba gets blue and alpha, so interleaving them makes RGBA8 texels.
+FUNCTION_TARGET_AVX2
+static inline void DecodeTexels16_AVX2(__m256i raw, TLUTFormat format, __m256i* rg, __m256i* ba)
+{
+  if (format == TLUTFormat::IA8)
+  {
+    // Stored as the bytes A, I.
+    const __m256i intensity = _mm256_srli_epi16(raw, 8);
+    *rg = _mm256_or_si256(intensity, _mm256_slli_epi16(intensity, 8));
+    *ba = _mm256_or_si256(intensity, _mm256_slli_epi16(raw, 8));
+    return;
+  }
+
+  const __m256i swap = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14, 1, 0,
+                                        3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+  const __m256i value = _mm256_shuffle_epi8(raw, swap);
+  const __m256i mask_x0f = _mm256_set1_epi16(0x0f);
+  const __m256i mask_x1f = _mm256_set1_epi16(0x1f);
+  const __m256i alpha_xff = _mm256_set1_epi16(static_cast<s16>(0xff00));
+
+  if (format == TLUTFormat::RGB565)
+  {
+    const __m256i r = Expand5To8_AVX2(_mm256_srli_epi16(value, 11));
+    const __m256i g =
+        Expand6To8_AVX2(_mm256_and_si256(_mm256_srli_epi16(value, 5), _mm256_set1_epi16(0x3f)));
+    const __m256i b = Expand5To8_AVX2(_mm256_and_si256(value, mask_x1f));
+    *rg = _mm256_or_si256(r, _mm256_slli_epi16(g, 8));
+    *ba = _mm256_or_si256(b, alpha_xff);
+    return;
+  }
+
+  // RGB5A3: RGB555 when the top bit is set, ARGB3444 otherwise.
+  const __m256i r5 = Expand5To8_AVX2(_mm256_and_si256(_mm256_srli_epi16(value, 10), mask_x1f));
+  const __m256i g5 = Expand5To8_AVX2(_mm256_and_si256(_mm256_srli_epi16(value, 5), mask_x1f));
+  const __m256i b5 = Expand5To8_AVX2(_mm256_and_si256(value, mask_x1f));
+  const __m256i rg555 = _mm256_or_si256(r5, _mm256_slli_epi16(g5, 8));
+  const __m256i ba555 = _mm256_or_si256(b5, alpha_xff);
+
+  const __m256i a3 = _mm256_and_si256(_mm256_srli_epi16(value, 12), _mm256_set1_epi16(0x07));
+  const __m256i a8 =
+      _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi16(a3, 5), _mm256_slli_epi16(a3, 2)),
+                      _mm256_srli_epi16(a3, 1));
+  const __m256i r4 = Expand4To8_AVX2(_mm256_and_si256(_mm256_srli_epi16(value, 8), mask_x0f));
+  const __m256i g4 = Expand4To8_AVX2(_mm256_and_si256(_mm256_srli_epi16(value, 4), mask_x0f));
+  const __m256i b4 = Expand4To8_AVX2(_mm256_and_si256(value, mask_x0f));
+  const __m256i rg3444 = _mm256_or_si256(r4, _mm256_slli_epi16(g4, 8));
+  const __m256i ba3444 = _mm256_or_si256(b4, _mm256_slli_epi16(a8, 8));
+
+  const __m256i opaque = _mm256_srai_epi16(value, 15);
+  *rg = _mm256_blendv_epi8(rg3444, rg555, opaque);
+  *ba = _mm256_blendv_epi8(ba3444, ba555, opaque);
+}
+
+// Decodes a 4x4 block of 16-bit texels.
+FUNCTION_TARGET_AVX2
+static inline void DecodeBlock16_AVX2(u32* dst, int width, __m256i raw, TLUTFormat format)
+{
+  __m256i rg, ba;
+  DecodeTexels16_AVX2(raw, format, &rg, &ba);
+  StoreBlockRows_AVX2(dst, width, _mm256_unpacklo_epi16(rg, ba), _mm256_unpackhi_epi16(rg, ba));
+}
+
+// Decodes the first num_entries (a multiple of 16) colors of a palette.
+FUNCTION_TARGET_AVX2
+static void DecodePalette_AVX2(u32* palette, const u8* tlut, TLUTFormat tlutfmt, int num_entries)
+{
+  for (int i = 0; i < num_entries; i += 16)
+  {
+    __m256i rg, ba;
+    DecodeTexels16_AVX2(_mm256_loadu_si256((const __m256i*)(tlut + i * sizeof(u16))), tlutfmt, &rg,
+                        &ba);
+    // Entries 0-3 and 8-11, and 4-7 and 12-15.
+    const __m256i low = _mm256_unpacklo_epi16(rg, ba);
+    const __m256i high = _mm256_unpackhi_epi16(rg, ba);
+    _mm256_storeu_si256((__m256i*)(palette + i), _mm256_permute2x128_si256(low, high, 0x20));
+    _mm256_storeu_si256((__m256i*)(palette + i + 8), _mm256_permute2x128_si256(low, high, 0x31));
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_I4_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0; x < width; x += 8, src += 32)
+    {
+      // An 8x8 block has 4 bytes per row. Split into one byte per texel, the qwords of rows0145
+      // are the rows 0, 1, 4 and 5.
+      __m256i rows0145, rows2367;
+      SplitNibbles_AVX2(_mm256_loadu_si256((const __m256i*)src), &rows0145, &rows2367);
+      rows0145 = Expand4To8_AVX2(rows0145);
+      rows2367 = Expand4To8_AVX2(rows2367);
+
+      u32* const block_dst = dst + y * width + x;
+      StoreIntensityRow_AVX2(block_dst + width * 0, _mm256_permute4x64_epi64(rows0145, 0x00));
+      StoreIntensityRow_AVX2(block_dst + width * 1, _mm256_permute4x64_epi64(rows0145, 0x55));
+      StoreIntensityRow_AVX2(block_dst + width * 2, _mm256_permute4x64_epi64(rows2367, 0x00));
+      StoreIntensityRow_AVX2(block_dst + width * 3, _mm256_permute4x64_epi64(rows2367, 0x55));
+      StoreIntensityRow_AVX2(block_dst + width * 4, _mm256_permute4x64_epi64(rows0145, 0xaa));
+      StoreIntensityRow_AVX2(block_dst + width * 5, _mm256_permute4x64_epi64(rows0145, 0xff));
+      StoreIntensityRow_AVX2(block_dst + width * 6, _mm256_permute4x64_epi64(rows2367, 0xaa));
+      StoreIntensityRow_AVX2(block_dst + width * 7, _mm256_permute4x64_epi64(rows2367, 0xff));
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_I8_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0; x < width; x += 8, src += 32)
+    {
+      // An 8x4 block has 8 bytes per row, so each qword is a row.
+      const __m256i rows = _mm256_loadu_si256((const __m256i*)src);
+
+      u32* const block_dst = dst + y * width + x;
+      StoreIntensityRow_AVX2(block_dst + width * 0, _mm256_permute4x64_epi64(rows, 0x00));
+      StoreIntensityRow_AVX2(block_dst + width * 1, _mm256_permute4x64_epi64(rows, 0x55));
+      StoreIntensityRow_AVX2(block_dst + width * 2, _mm256_permute4x64_epi64(rows, 0xaa));
+      StoreIntensityRow_AVX2(block_dst + width * 3, _mm256_permute4x64_epi64(rows, 0xff));
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_IA4_AVX2(u32* dst, const u8* src, int width, int height,
+                                           TextureFormat texformat, const u8* tlut,
+                                           TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // Turns the intensity and alpha bytes of texels 0-3 (lane 0) and 4-7 (lane 1) into IIIA.
+  const __m256i mask = _mm256_setr_epi8(0, 0, 0, 1, 2, 2, 2, 3, 4, 4, 4, 5, 6, 6, 6, 7, 0, 0, 0, 1,
+                                        2, 2, 2, 3, 4, 4, 4, 5, 6, 6, 6, 7);
+  const __m256i mask_x0f = _mm256_set1_epi8(0x0f);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0; x < width; x += 8, src += 32)
+    {
+      const __m256i texels = _mm256_loadu_si256((const __m256i*)src);
+      const __m256i alpha =
+          Expand4To8_AVX2(_mm256_and_si256(_mm256_srli_epi16(texels, 4), mask_x0f));
+      const __m256i intensity = Expand4To8_AVX2(_mm256_and_si256(texels, mask_x0f));
+      // Pairs of intensity and alpha, lane 0 for the rows 0 and 1 and lane 1 for the rows 2 and 3.
+      const __m256i rows02 = _mm256_unpacklo_epi8(intensity, alpha);
+      const __m256i rows13 = _mm256_unpackhi_epi8(intensity, alpha);
+
+      u32* const block_dst = dst + y * width + x;
+      _mm256_storeu_si256((__m256i*)(block_dst + width * 0),
+                          _mm256_shuffle_epi8(_mm256_permute4x64_epi64(rows02, 0x50), mask));
+      _mm256_storeu_si256((__m256i*)(block_dst + width * 1),
+                          _mm256_shuffle_epi8(_mm256_permute4x64_epi64(rows13, 0x50), mask));
+      _mm256_storeu_si256((__m256i*)(block_dst + width * 2),
+                          _mm256_shuffle_epi8(_mm256_permute4x64_epi64(rows02, 0xfa), mask));
+      _mm256_storeu_si256((__m256i*)(block_dst + width * 3),
+                          _mm256_shuffle_epi8(_mm256_permute4x64_epi64(rows13, 0xfa), mask));
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_IA8_AVX2(u32* dst, const u8* src, int width, int height,
+                                           TextureFormat texformat, const u8* tlut,
+                                           TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // Turns the bytes A, I of texels 0-3 or 4-7 of each lane into IIIA.
+  const __m256i mask_even = _mm256_setr_epi8(1, 1, 1, 0, 3, 3, 3, 2, 5, 5, 5, 4, 7, 7, 7, 6, 1, 1,
+                                             1, 0, 3, 3, 3, 2, 5, 5, 5, 4, 7, 7, 7, 6);
+  const __m256i mask_odd = _mm256_setr_epi8(9, 9, 9, 8, 11, 11, 11, 10, 13, 13, 13, 12, 15, 15,
+                                            15, 14, 9, 9, 9, 8, 11, 11, 11, 10, 13, 13, 13, 12, 15,
+                                            15, 15, 14);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0; x < width; x += 4, src += 32)
+    {
+      const __m256i texels = _mm256_loadu_si256((const __m256i*)src);
+      StoreBlockRows_AVX2(dst + y * width + x, width, _mm256_shuffle_epi8(texels, mask_even),
+                          _mm256_shuffle_epi8(texels, mask_odd));
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_Texels16_AVX2(u32* dst, const u8* src, int width, int height,
+                                                TLUTFormat format)
+{
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0; x < width; x += 4, src += 32)
+    {
+      DecodeBlock16_AVX2(dst + y * width + x, width, _mm256_loadu_si256((const __m256i*)src),
+                         format);
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_RGB565_AVX2(u32* dst, const u8* src, int width, int height,
+                                              TextureFormat texformat, const u8* tlut,
+                                              TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  TexDecoder_DecodeImpl_Texels16_AVX2(dst, src, width, height, TLUTFormat::RGB565);
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_RGB5A3_AVX2(u32* dst, const u8* src, int width, int height,
+                                              TextureFormat texformat, const u8* tlut,
+                                              TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  TexDecoder_DecodeImpl_Texels16_AVX2(dst, src, width, height, TLUTFormat::RGB5A3);
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_RGBA8_AVX2(u32* dst, const u8* src, int width, int height,
+                                             TextureFormat texformat, const u8* tlut,
+                                             TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0; x < width; x += 4, src += 64)
+    {
+      // A 4x4 block is stored as 16 AR pairs followed by 16 GB pairs.
+      const __m256i ar = _mm256_loadu_si256((const __m256i*)src);
+      const __m256i gb = _mm256_loadu_si256((const __m256i*)(src + 32));
+      const __m256i rg = _mm256_or_si256(_mm256_srli_epi16(ar, 8), _mm256_slli_epi16(gb, 8));
+      const __m256i ba = _mm256_or_si256(_mm256_srli_epi16(gb, 8), _mm256_slli_epi16(ar, 8));
+      StoreBlockRows_AVX2(dst + y * width + x, width, _mm256_unpacklo_epi16(rg, ba),
+                          _mm256_unpackhi_epi16(rg, ba));
+    }
+  }
+}
+
+// Looks up 8 colors in a palette of 16.
+FUNCTION_TARGET_AVX2
+static inline __m256i LookUpPalette16_AVX2(__m256i palette_low, __m256i palette_high,
+                                           __m256i indices)
+{
+  const __m256i high = _mm256_cmpgt_epi32(indices, _mm256_set1_epi32(7));
+  return _mm256_blendv_epi8(_mm256_permutevar8x32_epi32(palette_low, indices),
+                            _mm256_permutevar8x32_epi32(palette_high, indices), high);
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_C4_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  alignas(32) u32 palette[16];
+  DecodePalette_AVX2(palette, tlut, tlutfmt, 16);
+  const __m256i palette_low = _mm256_load_si256((const __m256i*)palette);
+  const __m256i palette_high = _mm256_load_si256((const __m256i*)(palette + 8));
+
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0; x < width; x += 8, src += 32)
+    {
+      // Like I4, each qword of rows0145 and rows2367 holds the indices of a row.
+      __m256i rows0145, rows2367;
+      SplitNibbles_AVX2(_mm256_loadu_si256((const __m256i*)src), &rows0145, &rows2367);
+      const __m128i rows01 = _mm256_castsi256_si128(rows0145);
+      const __m128i rows45 = _mm256_extracti128_si256(rows0145, 1);
+      const __m128i rows23 = _mm256_castsi256_si128(rows2367);
+      const __m128i rows67 = _mm256_extracti128_si256(rows2367, 1);
+      const __m128i rows[8] = {
+          rows01, _mm_unpackhi_epi64(rows01, rows01), rows23, _mm_unpackhi_epi64(rows23, rows23),
+          rows45, _mm_unpackhi_epi64(rows45, rows45), rows67, _mm_unpackhi_epi64(rows67, rows67),
+      };
+
+      u32* const block_dst = dst + y * width + x;
+      for (int iy = 0; iy < 8; iy++)
+      {
+        const __m256i indices = _mm256_cvtepu8_epi32(rows[iy]);
+        _mm256_storeu_si256((__m256i*)(block_dst + iy * width),
+                            LookUpPalette16_AVX2(palette_low, palette_high, indices));
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_C8_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  alignas(32) u32 palette[256];
+  DecodePalette_AVX2(palette, tlut, tlutfmt, 256);
+
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0; x < width; x += 8, src += 32)
+    {
+      u32* const block_dst = dst + y * width + x;
+      for (int iy = 0; iy < 4; iy++)
+      {
+        const __m256i indices =
+            _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(src + iy * 8)));
+        _mm256_storeu_si256((__m256i*)(block_dst + iy * width),
+                            _mm256_i32gather_epi32((const int*)palette, indices, 4));
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_C14X2_AVX2(u32* dst, const u8* src, int width, int height,
+                                             TextureFormat texformat, const u8* tlut,
+                                             TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // The palette has 16384 colors, more than most textures have texels, so the colors are looked
+  // up first and then decoded a block at a time.
+  const u16* const tlut16 = reinterpret_cast<const u16*>(tlut);
+  const u16* src16 = reinterpret_cast<const u16*>(src);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0; x < width; x += 4, src16 += 16)
+    {
+      alignas(32) u16 colors[16];
+      for (int i = 0; i < 16; i++)
+        colors[i] = tlut16[Common::swap16(src16[i]) & 0x3FFF];
+      DecodeBlock16_AVX2(dst + y * width + x, width,
+                         _mm256_load_si256((const __m256i*)colors), tlutfmt);
+    }
+  }
+}
+
+// Expands RGB565 colors in the low half of each dword into red in the low and green in the high
+// half of each dword of rg, and blue in b.
+FUNCTION_TARGET_AVX2
+static inline void ExpandRGB565_AVX2(__m256i colors, __m256i* rg, __m256i* b)
+{
+  const __m256i r = Expand5To8_AVX2(_mm256_srli_epi32(colors, 11));
+  const __m256i g =
+      Expand6To8_AVX2(_mm256_and_si256(_mm256_srli_epi32(colors, 5), _mm256_set1_epi32(0x3f)));
+  *rg = _mm256_or_si256(r, _mm256_slli_epi32(g, 16));
+  *b = Expand5To8_AVX2(_mm256_and_si256(colors, _mm256_set1_epi32(0x1f)));
+}
+
+// Decodes the 4 colors each of two DXT blocks into the lanes 0-3 and 4-7.
+FUNCTION_TARGET_AVX2
+static inline __m256i DecodeDXTColors_AVX2(const DXTBlock* left, const DXTBlock* right)
+{
+  const u16 left1 = Common::swap16(left->color1);
+  const u16 left2 = Common::swap16(left->color2);
+  const u16 right1 = Common::swap16(right->color1);
+  const u16 right2 = Common::swap16(right->color2);
+
+  // Each color is (weight1 * color1 + weight2 * color2) / 8, using the second set of weights when
+  // color1 <= color2, where the last color is transparent.
+  const __m128i weights1_gt = _mm_setr_epi32(0x00080008, 0x00000000, 0x00050005, 0x00030003);
+  const __m128i weights2_gt = _mm_setr_epi32(0x00000000, 0x00080008, 0x00030003, 0x00050005);
+  const __m128i weights1_le = _mm_setr_epi32(0x00080008, 0x00000000, 0x00040004, 0x00040004);
+  const __m128i weights2_le = _mm_setr_epi32(0x00000000, 0x00080008, 0x00040004, 0x00040004);
+  const __m128i alpha_gt = _mm_set1_epi32(0xff000000);
+  const __m128i alpha_le = _mm_setr_epi32(0xff000000, 0xff000000, 0xff000000, 0);
+  const bool left_gt = left1 > left2;
+  const bool right_gt = right1 > right2;
+  const __m256i weights1 = _mm256_setr_m128i(left_gt ? weights1_gt : weights1_le,
+                                             right_gt ? weights1_gt : weights1_le);
+  const __m256i weights2 = _mm256_setr_m128i(left_gt ? weights2_gt : weights2_le,
+                                             right_gt ? weights2_gt : weights2_le);
+  const __m256i alpha =
+      _mm256_setr_m128i(left_gt ? alpha_gt : alpha_le, right_gt ? alpha_gt : alpha_le);
+
+  const __m256i color1 = _mm256_setr_epi32(left1, left1, left1, left1, right1, right1, right1,
+                                           right1);
+  const __m256i color2 = _mm256_setr_epi32(left2, left2, left2, left2, right2, right2, right2,
+                                           right2);
+  __m256i rg1, b1, rg2, b2;
+  ExpandRGB565_AVX2(color1, &rg1, &b1);
+  ExpandRGB565_AVX2(color2, &rg2, &b2);
+
+  const __m256i rg = _mm256_srli_epi16(
+      _mm256_add_epi16(_mm256_mullo_epi16(rg1, weights1), _mm256_mullo_epi16(rg2, weights2)), 3);
+  const __m256i b = _mm256_srli_epi16(
+      _mm256_add_epi16(_mm256_mullo_epi16(b1, weights1), _mm256_mullo_epi16(b2, weights2)), 3);
+
+  const __m256i r_g = _mm256_or_si256(_mm256_and_si256(rg, _mm256_set1_epi32(0xffff)),
+                                      _mm256_srli_epi32(rg, 8));
+  return _mm256_or_si256(_mm256_or_si256(r_g, _mm256_slli_epi32(b, 16)), alpha);
+}
+
+// Decodes two horizontally adjacent DXT blocks.
+FUNCTION_TARGET_AVX2
+static inline void DecodeDXTBlocks_AVX2(u32* dst, int width, const DXTBlock* left,
+                                        const DXTBlock* right)
+{
+  const __m256i colors = DecodeDXTColors_AVX2(left, right);
+
+  u32 left_lines, right_lines;
+  std::memcpy(&left_lines, left->lines, sizeof(u32));
+  std::memcpy(&right_lines, right->lines, sizeof(u32));
+  const __m256i lines = _mm256_setr_epi32(left_lines, left_lines, left_lines, left_lines,
+                                          right_lines, right_lines, right_lines, right_lines);
+  const __m256i right_offset = _mm256_setr_epi32(0, 0, 0, 0, 4, 4, 4, 4);
+  const __m256i mask_x03 = _mm256_set1_epi32(3);
+
+  for (int row = 0; row < 4; row++)
+  {
+    // Each row of a block is a byte of 2-bit indices, the leftmost texel in the high bits.
+    const __m256i shifts = _mm256_add_epi32(_mm256_setr_epi32(6, 4, 2, 0, 6, 4, 2, 0),
+                                            _mm256_set1_epi32(row * 8));
+    const __m256i indices = _mm256_add_epi32(
+        _mm256_and_si256(_mm256_srlv_epi32(lines, shifts), mask_x03), right_offset);
+    _mm256_storeu_si256((__m256i*)(dst + row * width),
+                        _mm256_permutevar8x32_epi32(colors, indices));
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_CMPR_AVX2(u32* dst, const u8* src, int width, int height,
+                                            TextureFormat texformat, const u8* tlut,
+                                            TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0; x < width; x += 8, src += 4 * sizeof(DXTBlock))
+    {
+      // An 8x8 block is made of 4 DXT blocks, top left, top right, bottom left and bottom right.
+      const DXTBlock* const blocks = reinterpret_cast<const DXTBlock*>(src);
+      DecodeDXTBlocks_AVX2(dst + y * width + x, width, &blocks[0], &blocks[1]);
+      DecodeDXTBlocks_AVX2(dst + (y + 4) * width + x, width, &blocks[2], &blocks[3]);
+    }
+  }
+}
+
+std::vector<TexDecoderISA> TexDecoder_GetSupportedISAs()
+{
+  std::vector<TexDecoderISA> isas = {TexDecoderISA::Generic, TexDecoderISA::SSE2};
+  if (cpu_info.bSSSE3)
+    isas.push_back(TexDecoderISA::SSSE3);
+  if (cpu_info.bAVX2)
+    isas.push_back(TexDecoderISA::AVX2);
+  return isas;
+}
+
 void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, TextureFormat texformat,
                             const u8* tlut, TLUTFormat tlutfmt)
 {
+  const TexDecoderISA isa = cpu_info.bAVX2  ? TexDecoderISA::AVX2 :
+                            cpu_info.bSSSE3 ? TexDecoderISA::SSSE3 :
+                                              TexDecoderISA::SSE2;
+  _TexDecoder_DecodeImplWithISA(isa, dst, src, width, height, texformat, tlut, tlutfmt);
+}
+
+void _TexDecoder_DecodeImplWithISA(TexDecoderISA isa, u32* dst, const u8* src, int width,
+                                   int height, TextureFormat texformat, const u8* tlut,
+                                   TLUTFormat tlutfmt)
+{
+  if (isa != TexDecoderISA::SSE2 && isa != TexDecoderISA::SSSE3 && isa != TexDecoderISA::AVX2)
+  {
+    _TexDecoder_DecodeImplGeneric(dst, src, width, height, texformat, tlut, tlutfmt);
+    return;
+  }
+
+  // Formats without an implementation for an instruction set use the next older one.
+  const bool avx2 = isa == TexDecoderISA::AVX2;
+  const bool ssse3 = avx2 || isa == TexDecoderISA::SSSE3;
+
   int Wsteps4 = (width + 3) / 4;
   int Wsteps8 = (width + 7) / 8;
 
   switch (texformat)
   {
   case TextureFormat::C4:
-    TexDecoder_DecodeImpl_C4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (avx2)
+      TexDecoder_DecodeImpl_C4_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else
+      TexDecoder_DecodeImpl_C4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
     break;
 
   case TextureFormat::I4:
-    if (cpu_info.bSSSE3)
+    if (avx2)
+      TexDecoder_DecodeImpl_I4_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else if (ssse3)
       TexDecoder_DecodeImpl_I4_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                      Wsteps8);
     else
@@ -1434,7 +1964,10 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::I8:
-    if (cpu_info.bSSSE3)
+    if (avx2)
+      TexDecoder_DecodeImpl_I8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else if (ssse3)
       TexDecoder_DecodeImpl_I8_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                      Wsteps8);
     else
@@ -1442,15 +1975,27 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::C8:
-    TexDecoder_DecodeImpl_C8(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (avx2)
+      TexDecoder_DecodeImpl_C8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else
+      TexDecoder_DecodeImpl_C8(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
     break;
 
   case TextureFormat::IA4:
-    TexDecoder_DecodeImpl_IA4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (avx2)
+      TexDecoder_DecodeImpl_IA4_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                     Wsteps8);
+    else
+      TexDecoder_DecodeImpl_IA4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                Wsteps8);
     break;
 
   case TextureFormat::IA8:
-    if (cpu_info.bSSSE3)
+    if (avx2)
+      TexDecoder_DecodeImpl_IA8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                     Wsteps8);
+    else if (ssse3)
       TexDecoder_DecodeImpl_IA8_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                       Wsteps8);
     else
@@ -1459,17 +2004,28 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::C14X2:
-    TexDecoder_DecodeImpl_C14X2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
-                                Wsteps8);
+    if (avx2)
+      TexDecoder_DecodeImpl_C14X2_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                       Wsteps8);
+    else
+      TexDecoder_DecodeImpl_C14X2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                  Wsteps8);
     break;
 
   case TextureFormat::RGB565:
-    TexDecoder_DecodeImpl_RGB565(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
-                                 Wsteps8);
+    if (avx2)
+      TexDecoder_DecodeImpl_RGB565_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                        Wsteps8);
+    else
+      TexDecoder_DecodeImpl_RGB565(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                   Wsteps8);
     break;
 
   case TextureFormat::RGB5A3:
-    if (cpu_info.bSSSE3)
+    if (avx2)
+      TexDecoder_DecodeImpl_RGB5A3_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                        Wsteps8);
+    else if (ssse3)
       TexDecoder_DecodeImpl_RGB5A3_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                          Wsteps8);
     else
@@ -1478,7 +2034,10 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::RGBA8:
-    if (cpu_info.bSSSE3)
+    if (avx2)
+      TexDecoder_DecodeImpl_RGBA8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                       Wsteps8);
+    else if (ssse3)
       TexDecoder_DecodeImpl_RGBA8_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                         Wsteps8);
     else
@@ -1487,7 +2046,12 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::CMPR:
-    TexDecoder_DecodeImpl_CMPR(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (avx2)
+      TexDecoder_DecodeImpl_CMPR_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                      Wsteps8);
+    else
+      TexDecoder_DecodeImpl_CMPR(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                 Wsteps8);
     break;
 
   case TextureFormat::XFB:
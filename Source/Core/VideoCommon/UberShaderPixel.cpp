@@ -36,6 +36,24 @@ PixelShaderUid GetPixelShaderUid()
   return out;
 }
 
+PixelShaderUid GetSemiUberPixelShaderUid()
+{
+  PixelShaderUid out = GetPixelShaderUid();
+
+  pixel_ubershader_uid_data* const uid_data = out.GetUidData();
+  uid_data->semi_uber = 1;
+  uid_data->num_stages = bpmem.genMode.numtevstages;
+  for (u32 i = 0; i <= bpmem.genMode.numtevstages; i++)
+  {
+    if (bpmem.tevind[i].hex != 0)
+      uid_data->indirect = 1;
+  }
+  uid_data->fog = bpmem.fog.c_proj_fsel.fsel != FogType::Off;
+  uid_data->alpha_test_pass = bpmem.alpha_test.TestResult() == AlphaTestResult::Pass;
+
+  return out;
+}
+
 void ClearUnusedPixelShaderUidBits(APIType api_type, const ShaderHostConfig& host_config,
                                    PixelShaderUid* uid)
 {
@@ -68,6 +86,11 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
   const bool per_pixel_depth = uid_data->per_pixel_depth != 0;
   const bool bounding_box = host_config.bounding_box;
   const u32 numTexgen = uid_data->num_texgens;
+  // The state that semi-ubershaders are specialized on is only read from uniforms if it is needed.
+  const bool semi_uber = uid_data->semi_uber != 0;
+  const bool indirect = !semi_uber || uid_data->indirect;
+  const bool fog = !semi_uber || uid_data->fog;
+  const bool alpha_test = !semi_uber || !uid_data->alpha_test_pass;
   ShaderCode out;
 
   ASSERT_MSG(VIDEO, !(use_dual_source && use_framebuffer_fetch),
@@ -573,8 +596,15 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
   out.Write("void main()\n{{\n");
   out.Write("  float4 rawpos = gl_FragCoord;\n");
 
-  out.Write("  uint num_stages = {};\n\n",
-            BitfieldExtract<&GenMode::numtevstages>("bpmem_genmode"));
+  if (semi_uber)
+  {
+    out.Write("  uint num_stages = {}u;\n\n", uid_data->num_stages);
+  }
+  else
+  {
+    out.Write("  uint num_stages = {};\n\n",
+              BitfieldExtract<&GenMode::numtevstages>("bpmem_genmode"));
+  }
 
   if (use_framebuffer_fetch)
   {
@@ -667,115 +697,124 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
               "\n"
               "    bool texture_enabled = (ss.order & {}u) != 0u;\n",
               1 << TwoTevStageOrders().enable_tex_even.StartBit());
-    out.Write("\n"
-              "    // Indirect textures\n"
-              "    uint tevind = bpmem_tevind(stage);\n"
-              "    if (tevind != 0u)\n"
-              "    {{\n"
-              "      uint bs = {};\n",
-              BitfieldExtract<&TevStageIndirect::bs>("tevind"));
-    out.Write("      uint fmt = {};\n", BitfieldExtract<&TevStageIndirect::fmt>("tevind"));
-    out.Write("      uint bias = {};\n", BitfieldExtract<&TevStageIndirect::bias>("tevind"));
-    out.Write("      uint bt = {};\n", BitfieldExtract<&TevStageIndirect::bt>("tevind"));
-    out.Write("      uint matrix_index = {};\n",
-              BitfieldExtract<&TevStageIndirect::matrix_index>("tevind"));
-    out.Write("      uint matrix_id = {};\n",
-              BitfieldExtract<&TevStageIndirect::matrix_id>("tevind"));
-    out.Write("      int2 indtevtrans = int2(0, 0);\n"
-              "\n");
-    // There is always a bit set in bpmem_iref if the data is valid (matrix is not off, and the
-    // indirect texture stage is enabled). If the matrix is off, the result doesn't matter; if the
-    // indirect texture stage is disabled, the result is undefined (and produces a glitchy pattern
-    // on hardware, different from this).
-    // For the undefined case, we just skip applying the indirect operation, which is close
-    // enough. Viewtiful Joe hits the undefined case (bug 12525). Wrapping and add to previous
-    // still apply in this case (and when the stage is disabled).
-    out.Write("      if (bpmem_iref(bt) != 0u) {{\n");
-    out.Write("        int3 indcoord;\n");
-    LookupIndirectTexture("indcoord", "bt");
-    out.Write("        if (bs != 0u)\n"
-              "          s.AlphaBump = indcoord[bs - 1u];\n"
-              "        switch(fmt)\n"
-              "        {{\n"
-              "        case {:s}:\n",
-              IndTexFormat::ITF_8);
-    out.Write("          indcoord.x = indcoord.x + ((bias & 1u) != 0u ? -128 : 0);\n"
-              "          indcoord.y = indcoord.y + ((bias & 2u) != 0u ? -128 : 0);\n"
-              "          indcoord.z = indcoord.z + ((bias & 4u) != 0u ? -128 : 0);\n"
-              "          s.AlphaBump = s.AlphaBump & 0xf8;\n"
-              "          break;\n"
-              "        case {:s}:\n",
-              IndTexFormat::ITF_5);
-    out.Write("          indcoord.x = (indcoord.x >> 3) + ((bias & 1u) != 0u ? 1 : 0);\n"
-              "          indcoord.y = (indcoord.y >> 3) + ((bias & 2u) != 0u ? 1 : 0);\n"
-              "          indcoord.z = (indcoord.z >> 3) + ((bias & 4u) != 0u ? 1 : 0);\n"
-              "          s.AlphaBump = s.AlphaBump << 5;\n"
-              "          break;\n"
-              "        case {:s}:\n",
-              IndTexFormat::ITF_4);
-    out.Write("          indcoord.x = (indcoord.x >> 4) + ((bias & 1u) != 0u ? 1 : 0);\n"
-              "          indcoord.y = (indcoord.y >> 4) + ((bias & 2u) != 0u ? 1 : 0);\n"
-              "          indcoord.z = (indcoord.z >> 4) + ((bias & 4u) != 0u ? 1 : 0);\n"
-              "          s.AlphaBump = s.AlphaBump << 4;\n"
-              "          break;\n"
-              "        case {:s}:\n",
-              IndTexFormat::ITF_3);
-    out.Write("          indcoord.x = (indcoord.x >> 5) + ((bias & 1u) != 0u ? 1 : 0);\n"
-              "          indcoord.y = (indcoord.y >> 5) + ((bias & 2u) != 0u ? 1 : 0);\n"
-              "          indcoord.z = (indcoord.z >> 5) + ((bias & 4u) != 0u ? 1 : 0);\n"
-              "          s.AlphaBump = s.AlphaBump << 3;\n"
-              "          break;\n"
-              "        }}\n"
-              "\n"
-              "        // Matrix multiply\n"
-              "        if (matrix_index != 0u)\n"
-              "        {{\n"
-              "          uint mtxidx = 2u * (matrix_index - 1u);\n"
-              "          int shift = " I_INDTEXMTX "[mtxidx].w;\n"
-              "\n"
-              "          switch (matrix_id)\n"
-              "          {{\n"
-              "          case 0u: // 3x2 S0.10 matrix\n"
-              "            indtevtrans = int2(idot(" I_INDTEXMTX
-              "[mtxidx].xyz, indcoord), idot(" I_INDTEXMTX "[mtxidx + 1u].xyz, indcoord)) >> 3;\n"
-              "            break;\n"
-              "          case 1u: // S matrix, S17.7 format\n"
-              "            indtevtrans = (fixedPoint_uv * indcoord.xx) >> 8;\n"
-              "            break;\n"
-              "          case 2u: // T matrix, S17.7 format\n"
-              "            indtevtrans = (fixedPoint_uv * indcoord.yy) >> 8;\n"
-              "            break;\n"
-              "          }}\n"
-              "\n"
-              "          if (shift >= 0)\n"
-              "            indtevtrans = indtevtrans >> shift;\n"
-              "          else\n"
-              "            indtevtrans = indtevtrans << ((-shift) & 31);\n"
-              "        }}\n"
-              "      }}\n"
-              "\n"
-              "      // Wrapping\n"
-              "      uint sw = {};\n",
-              BitfieldExtract<&TevStageIndirect::sw>("tevind"));
-    out.Write("      uint tw = {}; \n", BitfieldExtract<&TevStageIndirect::tw>("tevind"));
-    out.Write(
-        "      int2 wrapped_coord = int2(Wrap(fixedPoint_uv.x, sw), Wrap(fixedPoint_uv.y, tw));\n"
-        "\n"
-        "      if ((tevind & {}u) != 0u) // add previous tevcoord\n",
-        1 << TevStageIndirect().fb_addprev.StartBit());
-    out.Write("        tevcoord.xy += wrapped_coord + indtevtrans;\n"
-              "      else\n"
-              "        tevcoord.xy = wrapped_coord + indtevtrans;\n"
-              "\n"
-              "      // Emulate s24 overflows\n"
-              "      tevcoord.xy = (tevcoord.xy << 8) >> 8;\n"
-              "    }}\n"
-              "    else\n"
-              "    {{\n"
-              "      tevcoord.xy = fixedPoint_uv;\n"
-              "    }}\n"
-              "\n"
-              "    // Sample texture for stage\n"
+    if (indirect)
+    {
+      out.Write("\n"
+                "    // Indirect textures\n"
+                "    uint tevind = bpmem_tevind(stage);\n"
+                "    if (tevind != 0u)\n"
+                "    {{\n"
+                "      uint bs = {};\n",
+                BitfieldExtract<&TevStageIndirect::bs>("tevind"));
+      out.Write("      uint fmt = {};\n", BitfieldExtract<&TevStageIndirect::fmt>("tevind"));
+      out.Write("      uint bias = {};\n", BitfieldExtract<&TevStageIndirect::bias>("tevind"));
+      out.Write("      uint bt = {};\n", BitfieldExtract<&TevStageIndirect::bt>("tevind"));
+      out.Write("      uint matrix_index = {};\n",
+                BitfieldExtract<&TevStageIndirect::matrix_index>("tevind"));
+      out.Write("      uint matrix_id = {};\n",
+                BitfieldExtract<&TevStageIndirect::matrix_id>("tevind"));
+      out.Write("      int2 indtevtrans = int2(0, 0);\n"
+                "\n");
+      // There is always a bit set in bpmem_iref if the data is valid (matrix is not off, and the
+      // indirect texture stage is enabled). If the matrix is off, the result doesn't matter; if the
+      // indirect texture stage is disabled, the result is undefined (and produces a glitchy pattern
+      // on hardware, different from this).
+      // For the undefined case, we just skip applying the indirect operation, which is close
+      // enough. Viewtiful Joe hits the undefined case (bug 12525). Wrapping and add to previous
+      // still apply in this case (and when the stage is disabled).
+      out.Write("      if (bpmem_iref(bt) != 0u) {{\n");
+      out.Write("        int3 indcoord;\n");
+      LookupIndirectTexture("indcoord", "bt");
+      out.Write("        if (bs != 0u)\n"
+                "          s.AlphaBump = indcoord[bs - 1u];\n"
+                "        switch(fmt)\n"
+                "        {{\n"
+                "        case {:s}:\n",
+                IndTexFormat::ITF_8);
+      out.Write("          indcoord.x = indcoord.x + ((bias & 1u) != 0u ? -128 : 0);\n"
+                "          indcoord.y = indcoord.y + ((bias & 2u) != 0u ? -128 : 0);\n"
+                "          indcoord.z = indcoord.z + ((bias & 4u) != 0u ? -128 : 0);\n"
+                "          s.AlphaBump = s.AlphaBump & 0xf8;\n"
+                "          break;\n"
+                "        case {:s}:\n",
+                IndTexFormat::ITF_5);
+      out.Write("          indcoord.x = (indcoord.x >> 3) + ((bias & 1u) != 0u ? 1 : 0);\n"
+                "          indcoord.y = (indcoord.y >> 3) + ((bias & 2u) != 0u ? 1 : 0);\n"
+                "          indcoord.z = (indcoord.z >> 3) + ((bias & 4u) != 0u ? 1 : 0);\n"
+                "          s.AlphaBump = s.AlphaBump << 5;\n"
+                "          break;\n"
+                "        case {:s}:\n",
+                IndTexFormat::ITF_4);
+      out.Write("          indcoord.x = (indcoord.x >> 4) + ((bias & 1u) != 0u ? 1 : 0);\n"
+                "          indcoord.y = (indcoord.y >> 4) + ((bias & 2u) != 0u ? 1 : 0);\n"
+                "          indcoord.z = (indcoord.z >> 4) + ((bias & 4u) != 0u ? 1 : 0);\n"
+                "          s.AlphaBump = s.AlphaBump << 4;\n"
+                "          break;\n"
+                "        case {:s}:\n",
+                IndTexFormat::ITF_3);
+      out.Write("          indcoord.x = (indcoord.x >> 5) + ((bias & 1u) != 0u ? 1 : 0);\n"
+                "          indcoord.y = (indcoord.y >> 5) + ((bias & 2u) != 0u ? 1 : 0);\n"
+                "          indcoord.z = (indcoord.z >> 5) + ((bias & 4u) != 0u ? 1 : 0);\n"
+                "          s.AlphaBump = s.AlphaBump << 3;\n"
+                "          break;\n"
+                "        }}\n"
+                "\n"
+                "        // Matrix multiply\n"
+                "        if (matrix_index != 0u)\n"
+                "        {{\n"
+                "          uint mtxidx = 2u * (matrix_index - 1u);\n"
+                "          int shift = " I_INDTEXMTX "[mtxidx].w;\n"
+                "\n"
+                "          switch (matrix_id)\n"
+                "          {{\n"
+                "          case 0u: // 3x2 S0.10 matrix\n"
+                "            indtevtrans = int2(idot(" I_INDTEXMTX
+                "[mtxidx].xyz, indcoord), idot(" I_INDTEXMTX "[mtxidx + 1u].xyz, indcoord)) >> 3;\n"
+                "            break;\n"
+                "          case 1u: // S matrix, S17.7 format\n"
+                "            indtevtrans = (fixedPoint_uv * indcoord.xx) >> 8;\n"
+                "            break;\n"
+                "          case 2u: // T matrix, S17.7 format\n"
+                "            indtevtrans = (fixedPoint_uv * indcoord.yy) >> 8;\n"
+                "            break;\n"
+                "          }}\n"
+                "\n"
+                "          if (shift >= 0)\n"
+                "            indtevtrans = indtevtrans >> shift;\n"
+                "          else\n"
+                "            indtevtrans = indtevtrans << ((-shift) & 31);\n"
+                "        }}\n"
+                "      }}\n"
+                "\n"
+                "      // Wrapping\n"
+                "      uint sw = {};\n",
+                BitfieldExtract<&TevStageIndirect::sw>("tevind"));
+      out.Write("      uint tw = {}; \n", BitfieldExtract<&TevStageIndirect::tw>("tevind"));
+      out.Write(
+          "      int2 wrapped_coord = int2(Wrap(fixedPoint_uv.x, sw), Wrap(fixedPoint_uv.y, tw));\n"
+          "\n"
+          "      if ((tevind & {}u) != 0u) // add previous tevcoord\n",
+          1 << TevStageIndirect().fb_addprev.StartBit());
+      out.Write("        tevcoord.xy += wrapped_coord + indtevtrans;\n"
+                "      else\n"
+                "        tevcoord.xy = wrapped_coord + indtevtrans;\n"
+                "\n"
+                "      // Emulate s24 overflows\n"
+                "      tevcoord.xy = (tevcoord.xy << 8) >> 8;\n"
+                "    }}\n"
+                "    else\n"
+                "    {{\n"
+                "      tevcoord.xy = fixedPoint_uv;\n"
+                "    }}\n"
+                "\n");
+    }
+    else
+    {
+      out.Write("\n"
+                "    tevcoord.xy = fixedPoint_uv;\n"
+                "\n");
+    }
+    out.Write("    // Sample texture for stage\n"
               "    if (texture_enabled) {{\n"
               "      uint sampler_num = {};\n",
               BitfieldExtract<&TwoTevStageOrders::texmap_even>("ss.order"));
@@ -1020,27 +1059,30 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
     out.Write("  #define discard_fragment discard\n");
   }
 
-  out.Write("  if (bpmem_alphaTest != 0u) {{\n"
-            "    bool comp0 = alphaCompare(TevResult.a, " I_ALPHA ".r, {});\n",
-            BitfieldExtract<&AlphaTest::comp0>("bpmem_alphaTest"));
-  out.Write("    bool comp1 = alphaCompare(TevResult.a, " I_ALPHA ".g, {});\n",
-            BitfieldExtract<&AlphaTest::comp1>("bpmem_alphaTest"));
-  out.Write("\n"
-            "    // These if statements are written weirdly to work around intel and Qualcomm "
-            "bugs with handling booleans.\n"
-            "    switch ({}) {{\n",
-            BitfieldExtract<&AlphaTest::logic>("bpmem_alphaTest"));
-  out.Write("    case 0u: // AND\n"
-            "      if (comp0 && comp1) break; else discard_fragment; break;\n"
-            "    case 1u: // OR\n"
-            "      if (comp0 || comp1) break; else discard_fragment; break;\n"
-            "    case 2u: // XOR\n"
-            "      if (comp0 != comp1) break; else discard_fragment; break;\n"
-            "    case 3u: // XNOR\n"
-            "      if (comp0 == comp1) break; else discard_fragment; break;\n"
-            "    }}\n"
-            "  }}\n"
-            "\n");
+  if (alpha_test)
+  {
+    out.Write("  if (bpmem_alphaTest != 0u) {{\n"
+              "    bool comp0 = alphaCompare(TevResult.a, " I_ALPHA ".r, {});\n",
+              BitfieldExtract<&AlphaTest::comp0>("bpmem_alphaTest"));
+    out.Write("    bool comp1 = alphaCompare(TevResult.a, " I_ALPHA ".g, {});\n",
+              BitfieldExtract<&AlphaTest::comp1>("bpmem_alphaTest"));
+    out.Write("\n"
+              "    // These if statements are written weirdly to work around intel and Qualcomm "
+              "bugs with handling booleans.\n"
+              "    switch ({}) {{\n",
+              BitfieldExtract<&AlphaTest::logic>("bpmem_alphaTest"));
+    out.Write("    case 0u: // AND\n"
+              "      if (comp0 && comp1) break; else discard_fragment; break;\n"
+              "    case 1u: // OR\n"
+              "      if (comp0 || comp1) break; else discard_fragment; break;\n"
+              "    case 2u: // XOR\n"
+              "      if (comp0 != comp1) break; else discard_fragment; break;\n"
+              "    case 3u: // XNOR\n"
+              "      if (comp0 == comp1) break; else discard_fragment; break;\n"
+              "    }}\n"
+              "  }}\n"
+              "\n");
+  }
 
   out.Write("  // Hardware testing indicates that an alpha of 1 can pass an alpha test,\n"
             "  // but doesn't do anything in blending\n"
@@ -1062,67 +1104,71 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
 
   // FIXME: Fog is implemented the same as ShaderGen, but ShaderGen's fog is all hacks.
   //        Should be fixed point, and should not make guesses about Range-Based adjustments.
-  out.Write("  // Fog\n"
-            "  uint fog_function = {};\n",
-            BitfieldExtract<&FogParam3::fsel>("bpmem_fogParam3"));
-  out.Write("  if (fog_function != {:s}) {{\n", FogType::Off);
-  out.Write("    // TODO: This all needs to be converted from float to fixed point\n"
-            "    float ze;\n"
-            "    if ({} == 0u) {{\n",
-            BitfieldExtract<&FogParam3::proj>("bpmem_fogParam3"));
-  out.Write("      // perspective\n"
-            "      // ze = A/(B - (Zs >> B_SHF)\n"
-            "      ze = (" I_FOGF ".x * 16777216.0) / float(" I_FOGI ".y - (zCoord >> " I_FOGI
-            ".w));\n"
-            "    }} else {{\n"
-            "      // orthographic\n"
-            "      // ze = a*Zs    (here, no B_SHF)\n"
-            "      ze = " I_FOGF ".x * float(zCoord) / 16777216.0;\n"
-            "    }}\n"
-            "\n"
-            "    if (bool({})) {{\n",
-            BitfieldExtract<&FogRangeParams::RangeBase::Enabled>("bpmem_fogRangeBase"));
-  out.Write("      // x_adjust = sqrt((x-center)^2 + k^2)/k\n"
-            "      // ze *= x_adjust\n"
-            "      float offset = (2.0 * (rawpos.x / " I_FOGF ".w)) - 1.0 - " I_FOGF ".z;\n"
-            "      float floatindex = clamp(9.0 - abs(offset) * 9.0, 0.0, 9.0);\n"
-            "      uint indexlower = uint(floatindex);\n"
-            "      uint indexupper = indexlower + 1u;\n"
-            "      float klower = " I_FOGRANGE "[indexlower >> 2u][indexlower & 3u];\n"
-            "      float kupper = " I_FOGRANGE "[indexupper >> 2u][indexupper & 3u];\n"
-            "      float k = lerp(klower, kupper, frac(floatindex));\n"
-            "      float x_adjust = sqrt(offset * offset + k * k) / k;\n"
-            "      ze *= x_adjust;\n"
-            "    }}\n"
-            "\n"
-            "    float fog = clamp(ze - " I_FOGF ".y, 0.0, 1.0);\n"
-            "\n");
-  out.Write("    if (fog_function >= {:s}) {{\n", FogType::Exp);
-  out.Write("      switch (fog_function) {{\n"
-            "      case {:s}:\n"
-            "        fog = 1.0 - exp2(-8.0 * fog);\n"
-            "        break;\n",
-            FogType::Exp);
-  out.Write("      case {:s}:\n"
-            "        fog = 1.0 - exp2(-8.0 * fog * fog);\n"
-            "        break;\n",
-            FogType::ExpSq);
-  out.Write("      case {:s}:\n"
-            "        fog = exp2(-8.0 * (1.0 - fog));\n"
-            "        break;\n",
-            FogType::BackwardsExp);
-  out.Write("      case {:s}:\n"
-            "        fog = 1.0 - fog;\n"
-            "        fog = exp2(-8.0 * fog * fog);\n"
-            "        break;\n",
-            FogType::BackwardsExpSq);
-  out.Write("      }}\n"
-            "    }}\n"
-            "\n"
-            "    int ifog = iround(fog * 256.0);\n"
-            "    TevResult.rgb = (TevResult.rgb * (256 - ifog) + " I_FOGCOLOR ".rgb * ifog) >> 8;\n"
-            "  }}\n"
-            "\n");
+  if (fog)
+  {
+    out.Write("  // Fog\n"
+              "  uint fog_function = {};\n",
+              BitfieldExtract<&FogParam3::fsel>("bpmem_fogParam3"));
+    out.Write("  if (fog_function != {:s}) {{\n", FogType::Off);
+    out.Write("    // TODO: This all needs to be converted from float to fixed point\n"
+              "    float ze;\n"
+              "    if ({} == 0u) {{\n",
+              BitfieldExtract<&FogParam3::proj>("bpmem_fogParam3"));
+    out.Write("      // perspective\n"
+              "      // ze = A/(B - (Zs >> B_SHF)\n"
+              "      ze = (" I_FOGF ".x * 16777216.0) / float(" I_FOGI ".y - (zCoord >> " I_FOGI
+              ".w));\n"
+              "    }} else {{\n"
+              "      // orthographic\n"
+              "      // ze = a*Zs    (here, no B_SHF)\n"
+              "      ze = " I_FOGF ".x * float(zCoord) / 16777216.0;\n"
+              "    }}\n"
+              "\n"
+              "    if (bool({})) {{\n",
+              BitfieldExtract<&FogRangeParams::RangeBase::Enabled>("bpmem_fogRangeBase"));
+    out.Write("      // x_adjust = sqrt((x-center)^2 + k^2)/k\n"
+              "      // ze *= x_adjust\n"
+              "      float offset = (2.0 * (rawpos.x / " I_FOGF ".w)) - 1.0 - " I_FOGF ".z;\n"
+              "      float floatindex = clamp(9.0 - abs(offset) * 9.0, 0.0, 9.0);\n"
+              "      uint indexlower = uint(floatindex);\n"
+              "      uint indexupper = indexlower + 1u;\n"
+              "      float klower = " I_FOGRANGE "[indexlower >> 2u][indexlower & 3u];\n"
+              "      float kupper = " I_FOGRANGE "[indexupper >> 2u][indexupper & 3u];\n"
+              "      float k = lerp(klower, kupper, frac(floatindex));\n"
+              "      float x_adjust = sqrt(offset * offset + k * k) / k;\n"
+              "      ze *= x_adjust;\n"
+              "    }}\n"
+              "\n"
+              "    float fog = clamp(ze - " I_FOGF ".y, 0.0, 1.0);\n"
+              "\n");
+    out.Write("    if (fog_function >= {:s}) {{\n", FogType::Exp);
+    out.Write("      switch (fog_function) {{\n"
+              "      case {:s}:\n"
+              "        fog = 1.0 - exp2(-8.0 * fog);\n"
+              "        break;\n",
+              FogType::Exp);
+    out.Write("      case {:s}:\n"
+              "        fog = 1.0 - exp2(-8.0 * fog * fog);\n"
+              "        break;\n",
+              FogType::ExpSq);
+    out.Write("      case {:s}:\n"
+              "        fog = exp2(-8.0 * (1.0 - fog));\n"
+              "        break;\n",
+              FogType::BackwardsExp);
+    out.Write("      case {:s}:\n"
+              "        fog = 1.0 - fog;\n"
+              "        fog = exp2(-8.0 * fog * fog);\n"
+              "        break;\n",
+              FogType::BackwardsExpSq);
+    out.Write("      }}\n"
+              "    }}\n"
+              "\n"
+              "    int ifog = iround(fog * 256.0);\n"
+              "    TevResult.rgb = (TevResult.rgb * (256 - ifog) + " I_FOGCOLOR
+              ".rgb * ifog) >> 8;\n"
+              "  }}\n"
+              "\n");
+  }
 
   if (use_framebuffer_fetch)
   {
@@ -20,6 +20,14 @@ struct pixel_ubershader_uid_data
   u32 uint_output : 1;
   u32 no_dual_src : 1;
 
+  // Semi-ubershaders are specialized on the coarse state below, which the others read from
+  // uniforms, and are much faster than them.
+  u32 semi_uber : 1;
+  u32 num_stages : 4;
+  u32 indirect : 1;
+  u32 fog : 1;
+  u32 alpha_test_pass : 1;
+
   u32 NumValues() const { return sizeof(pixel_ubershader_uid_data); }
 };
 #pragma pack()
@@ -27,6 +35,7 @@ struct pixel_ubershader_uid_data
 using PixelShaderUid = ShaderUid<pixel_ubershader_uid_data>;
 
 PixelShaderUid GetPixelShaderUid();
+PixelShaderUid GetSemiUberPixelShaderUid();
 
 ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
                           const pixel_ubershader_uid_data* uid_data);
@@ -43,9 +52,16 @@ struct fmt::formatter<UberShader::pixel_ubershader_uid_data>
   template <typename FormatContext>
   auto format(const UberShader::pixel_ubershader_uid_data& uid, FormatContext& ctx) const
   {
-    return fmt::format_to(
+    auto out = fmt::format_to(
         ctx.out(), "Pixel UberShader for {} texgens{}{}{}{}", uid.num_texgens,
         uid.early_depth ? ", early-depth" : "", uid.per_pixel_depth ? ", per-pixel depth" : "",
         uid.uint_output ? ", uint output" : "", uid.no_dual_src ? ", no dual-source blending" : "");
+    if (uid.semi_uber)
+    {
+      out = fmt::format_to(out, ", specialized for {} stages{}{}{}", uid.num_stages + 1,
+                           uid.indirect ? ", indirect" : "", uid.fog ? ", fog" : "",
+                           uid.alpha_test_pass ? ", no alpha test" : "");
+    }
+    return out;
   }
 };
@@ -19,6 +19,7 @@ class VertexLoaderUID
 
 public:
   VertexLoaderUID() {}
+  explicit VertexLoaderUID(const std::array<u32, 5>& data) : vid{data} { hash = CalculateHash(); }
   VertexLoaderUID(const TVtxDesc& vtx_desc, const VAT& vat)
   {
     vid[0] = vtx_desc.low.Hex;
@@ -32,6 +33,24 @@ public:
   bool operator==(const VertexLoaderUID& rh) const { return vid == rh.vid; }
   size_t GetHash() const { return hash; }
 
+  // The VCD and VAT register values, in the order that UID caches store them in.
+  const std::array<u32, 5>& GetData() const { return vid; }
+  TVtxDesc GetVtxDesc() const
+  {
+    TVtxDesc vtx_desc;
+    vtx_desc.low.Hex = vid[0];
+    vtx_desc.high.Hex = vid[1];
+    return vtx_desc;
+  }
+  VAT GetVAT() const
+  {
+    VAT vat;
+    vat.g0.Hex = vid[2];
+    vat.g1.Hex = vid[3];
+    vat.g2.Hex = vid[4];
+    return vat;
+  }
+
 private:
   size_t CalculateHash() const
   {
@@ -4,6 +4,7 @@
 #include "VideoCommon/VertexLoaderManager.h"
 
 #include <algorithm>
+#include <cstring>
 #include <iterator>
 #include <memory>
 #include <mutex>
@@ -15,8 +16,12 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
+#include "Common/Timer.h"
 
+#include "Core/ConfigManager.h"
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
@@ -25,6 +30,7 @@
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/DataReader.h"
+#include "VideoCommon/DisplayListCache.h"
 #include "VideoCommon/IndexGenerator.h"
 #include "VideoCommon/NativeVertexFormat.h"
 #include "VideoCommon/Statistics.h"
@@ -51,6 +57,14 @@ u32 g_current_components;
 typedef std::unordered_map<VertexLoaderUID, std::unique_ptr<VertexLoaderBase>> VertexLoaderMap;
 static std::mutex s_vertex_loader_map_lock;
 static VertexLoaderMap s_vertex_loader_map;
+// UIDs of the loaders that the current game has used. Guarded by s_vertex_loader_map_lock.
+static File::IOFile s_uid_cache_file;
+
+static DisplayListCache s_display_list_cache;
+// The display list that is being run from RAM, see SetDisplayList.
+static u32 s_display_list_address = 0;
+static const u8* s_display_list_data = nullptr;
+
 // TODO - change into array of pointers. Keep a map of all seen so far.
 
 Common::EnumMap<u8*, CPArray::TexCoord7> cached_arraybases;
@@ -68,15 +82,101 @@ void Init()
   g_main_vertex_loaders.fill(nullptr);
   g_preprocess_vertex_loaders.fill(nullptr);
   SETSTAT(g_stats.num_vertex_loaders, 0);
+  SETSTAT(g_stats.num_vertex_loaders_preloaded, 0);
+  g_stats.vertex_loader_creation_ms = 0;
+  g_stats.vertex_loader_preload_ms = 0;
 }
 
 void Clear()
 {
   std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+  s_uid_cache_file.Close();
+  s_display_list_cache.Clear();
   s_vertex_loader_map.clear();
   s_native_vertex_map.clear();
 }
 
+void SetDisplayList(u32 address, const u8* data)
+{
+  s_display_list_address = address;
+  s_display_list_data = data;
+}
+
+void ClearDisplayList()
+{
+  s_display_list_data = nullptr;
+}
+
+static constexpr u32 UID_CACHE_MAGIC = 0x44495556;  // VUID
+// Bump this when VertexLoaderUID changes.
+static constexpr u32 UID_CACHE_VERSION = 1;
+using SerializedVertexLoaderUID = std::array<u32, 5>;
+
+static void AppendUIDCache(const VertexLoaderUID& uid)
+{
+  if (!s_uid_cache_file.IsOpen())
+    return;
+
+  const SerializedVertexLoaderUID& data = uid.GetData();
+  if (!s_uid_cache_file.WriteArray(data.data(), data.size()) || !s_uid_cache_file.Flush())
+  {
+    WARN_LOG_FMT(VIDEO, "Writing vertex loader UID to cache failed, closing file.");
+    s_uid_cache_file.Close();
+  }
+}
+
+void LoadUIDCache()
+{
+  const std::string filename =
+      File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".vtxuidcache";
+
+  // A cut off entry at the end, like from a crash, is ignored.
+  std::vector<SerializedVertexLoaderUID> uids;
+  {
+    File::IOFile file(filename, "rb");
+    u32 magic;
+    u32 version;
+    if (file && file.ReadBytes(&magic, sizeof(magic)) &&
+        file.ReadBytes(&version, sizeof(version)) && magic == UID_CACHE_MAGIC &&
+        version == UID_CACHE_VERSION)
+    {
+      uids.resize(static_cast<size_t>((file.GetSize() - sizeof(magic) - sizeof(version)) /
+                                      sizeof(SerializedVertexLoaderUID)));
+      if (!file.ReadArray(uids.data(), uids.size()))
+        uids.clear();
+    }
+  }
+
+  std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+  const u64 start_time = Common::Timer::NowUs();
+  for (const SerializedVertexLoaderUID& data : uids)
+  {
+    const VertexLoaderUID uid(data);
+    if (s_vertex_loader_map.contains(uid))
+      continue;
+
+    std::unique_ptr<VertexLoaderBase> loader =
+        VertexLoaderBase::CreateVertexLoader(uid.GetVtxDesc(), uid.GetVAT());
+    loader->m_native_vertex_format = GetOrCreateMatchingFormat(loader->m_native_vtx_decl);
+    s_vertex_loader_map.emplace(uid, std::move(loader));
+    INCSTAT(g_stats.num_vertex_loaders);
+    INCSTAT(g_stats.num_vertex_loaders_preloaded);
+  }
+  ADDSTAT(g_stats.vertex_loader_preload_ms, (Common::Timer::NowUs() - start_time) / 1000.0f);
+  INFO_LOG_FMT(VIDEO, "Created {} vertex loaders from {}", g_stats.num_vertex_loaders_preloaded,
+               filename);
+
+  // Rewrite the cache from the loaders that exist, which also drops damaged and duplicate entries.
+  s_uid_cache_file.Close();
+  if (s_uid_cache_file.Open(filename, "wb"))
+  {
+    s_uid_cache_file.WriteBytes(&UID_CACHE_MAGIC, sizeof(UID_CACHE_MAGIC));
+    s_uid_cache_file.WriteBytes(&UID_CACHE_VERSION, sizeof(UID_CACHE_VERSION));
+    for (const auto& it : s_vertex_loader_map)
+      AppendUIDCache(it.first);
+  }
+}
+
 void UpdateVertexArrayPointers()
 {
   // Anything to update?
@@ -231,11 +331,14 @@ VertexLoaderBase* GetOrCreateLoader(int vtx_attr_group)
   }
   else
   {
+    const u64 start_time = Common::Timer::NowUs();
     auto [it, added] = s_vertex_loader_map.try_emplace(
         uid,
         VertexLoaderBase::CreateVertexLoader(state->vtx_desc, state->vtx_attr[vtx_attr_group]));
     loader = it->second.get();
     INCSTAT(g_stats.num_vertex_loaders);
+    ADDSTAT(g_stats.vertex_loader_creation_ms, (Common::Timer::NowUs() - start_time) / 1000.0f);
+    AppendUIDCache(uid);
   }
   if (check_for_native_format)
   {
@@ -438,15 +541,53 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
                           primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES);
 
     const int stride = loader->m_native_vtx_decl.stride;
+    const int max_vertices = 16380;  // Max is 16383, but 16380 is divisible by both 4 and 3
+
+    // Only triangles and quads are cached, since the indices of lines and points expanded in the
+    // vertex shader aren't relative to the first vertex. Fewer than 3 vertices would leave some
+    // of the zfreeze caches as they were, which the cache can't reproduce.
+    const DisplayListCache::Entry* cached = nullptr;
+    DisplayListCache::Entry* new_entry = nullptr;
+    if (s_display_list_data != nullptr && g_ActiveConfig.bDisplayListCache &&
+        primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES && count >= 3 &&
+        count <= max_vertices)
+    {
+      const u32 address = s_display_list_address + static_cast<u32>(src - s_display_list_data);
+      cached = s_display_list_cache.Lookup({address, static_cast<u32>(count), loader, primitive},
+                                           src, g_main_cp_state.vtx_desc,
+                                           g_main_cp_state.vtx_attr[vtx_attr_group], &new_entry);
+      if (cached)
+        INCSTAT(g_stats.this_frame.num_dlist_cache_hits);
+      else
+        INCSTAT(g_stats.this_frame.num_dlist_cache_misses);
+    }
+
     do
     {
-      const int max_vertices = 16380;  // Max is 16383, but 16380 is divisible by both 4 and 3
       const int run = CanSplit(primitive) && count > max_vertices ? max_vertices : count;
       count -= run;
       DataReader dst = g_vertex_manager->PrepareForAdditionalData(primitive, run, stride,
                                                                   cullall || can_cpu_cull);
 
-      const int num_loaded = loader->RunVertices(src, dst.GetPointer(), run);
+      int num_loaded;
+      if (cached)
+      {
+        num_loaded = static_cast<int>(cached->num_vertices);
+        std::memcpy(dst.GetPointer(), cached->vertices.data(), num_loaded * stride);
+        DisplayListCache::RestoreLoaderCaches(*cached);
+      }
+      else if (new_entry)
+      {
+        // Load into the entry instead of reading the vertices back from the vertex buffer.
+        // The SSE vertex loader can write up to 4 bytes past the end.
+        new_entry->vertices.resize(run * stride + 4);
+        num_loaded = loader->RunVertices(src, new_entry->vertices.data(), run);
+        std::memcpy(dst.GetPointer(), new_entry->vertices.data(), num_loaded * stride);
+      }
+      else
+      {
+        num_loaded = loader->RunVertices(src, dst.GetPointer(), run);
+      }
       src += loader->m_vertex_size * max_vertices;
 
       if (can_cpu_cull && !cullall)
@@ -461,7 +602,22 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
         }
       }
 
-      g_vertex_manager->AddIndices(primitive, num_loaded);
+      if (cached)
+      {
+        g_vertex_manager->AddRelativeIndices(cached->indices, num_loaded);
+      }
+      else if (new_entry && num_loaded == run)
+      {
+        // Vertices that were skipped because of their position index don't update the zfreeze
+        // caches, so only draws without any are stored.
+        std::vector<u16> indices;
+        g_vertex_manager->AddIndices(primitive, num_loaded, &indices);
+        s_display_list_cache.Store(new_entry, num_loaded, stride, std::move(indices));
+      }
+      else
+      {
+        g_vertex_manager->AddIndices(primitive, num_loaded);
+      }
       g_vertex_manager->FlushData(num_loaded, stride);
 
       ADDSTAT(g_stats.this_frame.num_prims, num_loaded);
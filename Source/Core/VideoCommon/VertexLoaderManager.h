@@ -28,6 +28,18 @@ using NativeVertexFormatMap =
 void Init();
 void Clear();
 
+// Creates the loaders and native vertex formats for all vertex formats that the current game has
+// used before, so that they don't have to be created when they are first drawn with. Vertex
+// formats that are new are added to the cache as they are used.
+void LoadUIDCache();
+
+// Tells RunVertices that its vertex data is read from the display list at the physical address,
+// whose data starts at data, until ClearDisplayList is called. Draws in the display list can then
+// be reused through DisplayListCache. Display lists that aren't read straight from RAM must not
+// be set.
+void SetDisplayList(u32 address, const u8* data);
+void ClearDisplayList();
+
 void MarkAllDirty();
 
 // Creates or obtains a pointer to a VertexFormat representing decl.
@@ -139,6 +139,17 @@ void VertexManagerBase::AddIndices(OpcodeDecoder::Primitive primitive, u32 num_v
   m_index_generator.AddIndices(primitive, num_vertices);
 }
 
+void VertexManagerBase::AddIndices(OpcodeDecoder::Primitive primitive, u32 num_vertices,
+                                   std::vector<u16>* relative_indices)
+{
+  m_index_generator.AddIndices(primitive, num_vertices, relative_indices);
+}
+
+void VertexManagerBase::AddRelativeIndices(std::span<const u16> indices, u32 num_vertices)
+{
+  m_index_generator.AddRelativeIndices(indices, num_vertices);
+}
+
 bool VertexManagerBase::AreAllVerticesCulled(VertexLoaderBase* loader,
                                              OpcodeDecoder::Primitive primitive, const u8* src,
                                              u32 count)
@@ -438,6 +449,7 @@ void VertexManagerBase::Flush()
     return;
 
   m_is_flushed = true;
+  m_deferred_flush_index_len = 0;
 
   if (m_draw_counter == 0)
   {
@@ -678,6 +690,23 @@ void VertexManagerBase::Flush()
   }
 }
 
+void VertexManagerBase::DeferFlush()
+{
+  if (!g_ActiveConfig.bMergeDraws)
+  {
+    Flush();
+    return;
+  }
+
+  const u32 num_indices = m_index_generator.GetIndexLen();
+  if (!HasSendableVertices() || num_indices == m_deferred_flush_index_len)
+    return;
+
+  // Without this, the vertices queued since the last state change would be drawn on their own.
+  m_deferred_flush_index_len = num_indices;
+  INCSTAT(g_stats.this_frame.num_draw_calls_merged);
+}
+
 void VertexManagerBase::DoState(PointerWrap& p)
 {
   if (p.IsReadMode())
@@ -819,6 +848,7 @@ void VertexManagerBase::UpdatePipelineConfig()
   {
     m_current_pipeline_config.ps_uid = ps_uid;
     m_current_uber_pipeline_config.ps_uid = UberShader::GetPixelShaderUid();
+    m_current_semi_uber_ps_uid = UberShader::GetSemiUberPixelShaderUid();
     m_pipeline_config_changed = true;
   }
 
@@ -887,6 +917,7 @@ void VertexManagerBase::UpdatePipelineObject()
   {
     // Ubershaders disabled? Block and compile the specialized shader.
     m_current_pipeline_object = g_shader_cache->GetPipelineForUid(m_current_pipeline_config);
+    m_current_pipeline_tier = PipelineTier::Specialized;
   }
   break;
 
@@ -895,6 +926,7 @@ void VertexManagerBase::UpdatePipelineObject()
     // Exclusive ubershader mode, always use ubershaders.
     m_current_pipeline_object =
         g_shader_cache->GetUberPipelineForUid(m_current_uber_pipeline_config);
+    m_current_pipeline_tier = PipelineTier::Uber;
   }
   break;
 
@@ -907,14 +939,28 @@ void VertexManagerBase::UpdatePipelineObject()
     {
       // Specialized shaders are ready, prefer these.
       m_current_pipeline_object = *res;
+      m_current_pipeline_tier = PipelineTier::Specialized;
       return;
     }
 
     if (g_ActiveConfig.iShaderCompilationMode == ShaderCompilationMode::AsynchronousUberShaders)
     {
-      // Specialized shaders not ready, use the ubershaders.
+      // Specialized shaders not ready. The semi-ubershader for the same coarse state is much
+      // faster than the ubershader and compiles quickly, so use it once it is ready, too.
+      VideoCommon::GXUberPipelineUid semi_uber_config = m_current_uber_pipeline_config;
+      semi_uber_config.ps_uid = m_current_semi_uber_ps_uid;
+      const auto semi_uber_res = g_shader_cache->GetUberPipelineForUidAsync(semi_uber_config);
+      if (semi_uber_res && *semi_uber_res)
+      {
+        m_current_pipeline_object = *semi_uber_res;
+        m_current_pipeline_tier = PipelineTier::SemiUber;
+        return;
+      }
+
+      // Neither is ready, use the ubershaders.
       m_current_pipeline_object =
           g_shader_cache->GetUberPipelineForUid(m_current_uber_pipeline_config);
+      m_current_pipeline_tier = PipelineTier::Uber;
     }
     else
     {
@@ -1094,6 +1140,18 @@ void VertexManagerBase::RenderDrawCall(
 
   // Track the total emulated state draws
   INCSTAT(g_stats.this_frame.num_draw_calls);
+  switch (m_current_pipeline_tier)
+  {
+  case PipelineTier::Specialized:
+    INCSTAT(g_stats.this_frame.num_draw_calls_specialized);
+    break;
+  case PipelineTier::SemiUber:
+    INCSTAT(g_stats.this_frame.num_draw_calls_semi_uber);
+    break;
+  case PipelineTier::Uber:
+    INCSTAT(g_stats.this_frame.num_draw_calls_uber);
+    break;
+  }
 
   if (PerfQueryBase::ShouldEmulate())
     g_perf_query->DisableQuery(bpmem.zcontrol.early_ztest ? PQG_ZCOMP_ZCOMPLOC : PQG_ZCOMP);
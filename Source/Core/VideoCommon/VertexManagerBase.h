@@ -4,6 +4,7 @@
 #pragma once
 
 #include <memory>
+#include <span>
 #include <vector>
 
 #include "Common/BitSet.h"
@@ -87,6 +88,14 @@ private:
     ProjectionCounts orthographic;
   };
 
+  // Which kind of shader the current pipeline was made from, for statistics.
+  enum class PipelineTier
+  {
+    Specialized,
+    SemiUber,
+    Uber,
+  };
+
 public:
   static constexpr u32 MAXVBUFFERSIZE =
       MathUtil::NextPowerOf2(MAX_PRIMITIVES_PER_COMMAND * LARGEST_POSSIBLE_VERTEX);
@@ -108,6 +117,9 @@ public:
 
   PrimitiveType GetCurrentPrimitiveType() const { return m_current_primitive_type; }
   void AddIndices(OpcodeDecoder::Primitive primitive, u32 num_vertices);
+  void AddIndices(OpcodeDecoder::Primitive primitive, u32 num_vertices,
+                  std::vector<u16>* relative_indices);
+  void AddRelativeIndices(std::span<const u16> indices, u32 num_vertices);
   bool AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
                             const u8* src, u32 count);
   virtual DataReader PrepareForAdditionalData(OpcodeDecoder::Primitive primitive, u32 count,
@@ -120,6 +132,11 @@ public:
 
   void Flush();
   bool HasSendableVertices() const { return !m_is_flushed && !m_cull_all; }
+  // Called instead of Flush() for state writes that used to flush but don't affect how the queued
+  // vertices are drawn, so that they are drawn together with the following vertices. Writes that
+  // change shader constants (matrices, lights, colors) still flush. Only defers the flush if
+  // merging draws is enabled in the config.
+  void DeferFlush();
 
   void DoState(PointerWrap& p);
 
@@ -208,7 +225,10 @@ protected:
 
   VideoCommon::GXPipelineUid m_current_pipeline_config;
   VideoCommon::GXUberPipelineUid m_current_uber_pipeline_config;
+  // Ubershader that is specialized on the coarse state of the current specialized shader.
+  UberShader::PixelShaderUid m_current_semi_uber_ps_uid;
   const AbstractPipeline* m_current_pipeline_object = nullptr;
+  PipelineTier m_current_pipeline_tier = PipelineTier::Specialized;
   PrimitiveType m_current_primitive_type = PrimitiveType::Points;
   bool m_pipeline_config_changed = true;
   bool m_rasterization_state_changed = true;
@@ -238,6 +258,8 @@ private:
                     const AbstractPipeline* current_pipeline) const;
 
   bool m_is_flushed = true;
+  // Number of indices queued at the last DeferFlush(), so that each merged draw counts once.
+  u32 m_deferred_flush_index_len = 0;
   FlushStatistics m_flush_statistics = {};
 
   // CPU access tracking
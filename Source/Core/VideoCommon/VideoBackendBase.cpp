@@ -341,6 +341,8 @@ bool VideoBackendBase::InitializeShared(std::unique_ptr<AbstractGfx> gfx,
                     OSD::Duration::NORMAL);
   }
 
+  if (g_ActiveConfig.bShaderCache && g_backend_info.api_type != APIType::Nothing)
+    VertexLoaderManager::LoadUIDCache();
   g_shader_cache->InitializeShaderCache();
   system.GetCustomResourceManager().Initialize();
 
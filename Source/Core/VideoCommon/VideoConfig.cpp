@@ -136,7 +136,12 @@ void VideoConfig::Refresh()
   iShaderCompilationMode = Config::Get(Config::GFX_SHADER_COMPILATION_MODE);
   iShaderCompilerThreads = Config::Get(Config::GFX_SHADER_COMPILER_THREADS);
   iShaderPrecompilerThreads = Config::Get(Config::GFX_SHADER_PRECOMPILER_THREADS);
+  iTextureDecodingThreads = Config::Get(Config::GFX_TEXTURE_DECODING_THREADS);
+  iSWRasterizerThreads = Config::Get(Config::GFX_SW_RASTERIZER_THREADS);
+  bSWVectorizedTev = Config::Get(Config::GFX_SW_VECTORIZED_TEV);
   bCPUCull = Config::Get(Config::GFX_CPU_CULL);
+  bDisplayListCache = Config::Get(Config::GFX_DISPLAY_LIST_CACHE);
+  bMergeDraws = Config::Get(Config::GFX_MERGE_DRAWS);
 
   texture_filtering_mode = Config::Get(Config::GFX_ENHANCE_FORCE_TEXTURE_FILTERING);
   iMaxAnisotropy = Config::Get(Config::GFX_ENHANCE_MAX_ANISOTROPY);
@@ -180,8 +185,10 @@ void VideoConfig::Refresh()
   bEFBEmulateFormatChanges = Config::Get(Config::GFX_HACK_EFB_EMULATE_FORMAT_CHANGES);
   bVertexRounding = Config::Get(Config::GFX_HACK_VERTEX_ROUNDING);
   iEFBAccessTileSize = Config::Get(Config::GFX_HACK_EFB_ACCESS_TILE_SIZE);
+  iEFBAccessLatency = Config::Get(Config::GFX_HACK_EFB_ACCESS_LATENCY);
   iMissingColorValue = Config::Get(Config::GFX_HACK_MISSING_COLOR_VALUE);
   bFastTextureSampling = Config::Get(Config::GFX_HACK_FAST_TEXTURE_SAMPLING);
+  bTextureWriteTracking = Config::Get(Config::GFX_HACK_TEXTURE_WRITE_TRACKING);
 #ifdef __APPLE__
   bNoMipmapping = Config::Get(Config::GFX_HACK_NO_MIPMAPPING);
 #endif
@@ -273,6 +280,26 @@ u32 VideoConfig::GetShaderPrecompilerThreads() const
     return 1;
 }
 
+u32 VideoConfig::GetSWRasterizerThreads() const
+{
+  if (iSWRasterizerThreads > 0)
+    return static_cast<u32>(iSWRasterizerThreads);
+  else if (iSWRasterizerThreads == -1)
+    return static_cast<u32>(std::max(cpu_info.num_cores - 1, 1));
+  else
+    return 1;
+}
+
+u32 VideoConfig::GetTextureDecodingThreads() const
+{
+  if (iTextureDecodingThreads > 0)
+    return static_cast<u32>(iTextureDecodingThreads);
+  else if (iTextureDecodingThreads < 0)
+    return static_cast<u32>(std::clamp(cpu_info.num_cores / 2, 1, 4));
+  else
+    return 1;
+}
+
 void CheckForConfigChanges()
 {
   const ShaderHostConfig old_shader_host_config = ShaderHostConfig::GetCurrent();
@@ -280,6 +307,7 @@ void CheckForConfigChanges()
   const u32 old_multisamples = g_ActiveConfig.iMultisamples;
   const auto old_anisotropy = g_ActiveConfig.iMaxAnisotropy;
   const int old_efb_access_tile_size = g_ActiveConfig.iEFBAccessTileSize;
+  const int old_efb_access_latency = g_ActiveConfig.iEFBAccessLatency;
   const auto old_texture_filtering_mode = g_ActiveConfig.texture_filtering_mode;
   const bool old_vsync = g_ActiveConfig.bVSyncActive;
   const bool old_bbox = g_ActiveConfig.bBBoxEnable;
@@ -317,6 +345,8 @@ void CheckForConfigChanges()
   // EFB tile cache doesn't need to notify the backend.
   if (old_efb_access_tile_size != g_ActiveConfig.iEFBAccessTileSize)
     g_framebuffer_manager->SetEFBCacheTileSize(std::max(g_ActiveConfig.iEFBAccessTileSize, 0));
+  if (old_efb_access_latency != g_ActiveConfig.iEFBAccessLatency)
+    g_framebuffer_manager->SetEFBCacheLatency(std::max(g_ActiveConfig.iEFBAccessLatency, 0));
 
   // Determine which (if any) settings have changed.
   ShaderHostConfig new_host_config = ShaderHostConfig::GetCurrent();
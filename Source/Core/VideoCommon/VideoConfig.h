@@ -282,6 +282,10 @@ struct VideoConfig final
   bool bPerfQueriesEnable = false;
   bool bBBoxEnable = false;
   bool bCPUCull = false;
+  // Reuses the loaded vertices of display lists that are called again with unchanged data.
+  bool bDisplayListCache = false;
+  // Doesn't flush the queued vertices for state writes that don't affect how they are drawn.
+  bool bMergeDraws = false;
 
   bool bEFBEmulateFormatChanges = false;
   bool bSkipEFBCopyToRam = false;
@@ -292,6 +296,9 @@ struct VideoConfig final
   bool bSkipPresentingDuplicateXFBs = false;
   bool bCopyEFBScaled = false;
   int iSafeTextureCache_ColorSamples = 0;
+  // Skips hashing textures whose memory wasn't written to. Off by default, since not every IOS
+  // device that writes to RAM through a pointer records its writes yet.
+  bool bTextureWriteTracking = false;
   float fAspectRatioHackW = 1;  // Initial value needed for the first frame
   float fAspectRatioHackH = 1;
   bool bEnablePixelLighting = false;
@@ -299,6 +306,9 @@ struct VideoConfig final
   bool bVertexRounding = false;
   bool bVISkip = false;
   int iEFBAccessTileSize = 0;
+  // Number of frames that EFB peeks may return old values for, so that they don't have to wait
+  // for the GPU. 0 always returns the current values.
+  int iEFBAccessLatency = 0;
   int iSaveTargetId = 0;  // TODO: Should be dropped
   u32 iMissingColorValue = 0;
   bool bFastTextureSampling = false;
@@ -343,6 +353,19 @@ struct VideoConfig final
   int iShaderCompilerThreads = 0;
   int iShaderPrecompilerThreads = 0;
 
+  // Number of threads large textures are decoded with on the CPU.
+  // 1 decodes on the video thread only.
+  // -1 uses an automatic number based on the CPU threads.
+  int iTextureDecodingThreads = -1;
+
+  // Number of threads the software renderer rasterizes with, including the video thread.
+  // 0 or 1 rasterizes on the video thread only.
+  // -1 uses one thread less than the host has hardware threads, leaving one for the CPU thread.
+  int iSWRasterizerThreads = 1;
+  // Whether the software renderer uses the SIMD TEV combiners of the host CPU. They produce the
+  // same results as the scalar ones, which can be used to verify that.
+  bool bSWVectorizedTev = true;
+
   // Loading custom drivers on Android
   std::string customDriverLibraryName;
 
@@ -391,6 +414,8 @@ struct VideoConfig final
   bool UsingUberShaders() const;
   u32 GetShaderCompilerThreads() const;
   u32 GetShaderPrecompilerThreads() const;
+  u32 GetSWRasterizerThreads() const;
+  u32 GetTextureDecodingThreads() const;
 
   float GetCustomAspectRatio() const { return (float)custom_aspect_width / custom_aspect_height; }
 };
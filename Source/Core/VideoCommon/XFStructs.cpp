@@ -22,6 +22,19 @@
 #include "VideoCommon/XFMemory.h"
 #include "VideoCommon/XFStateManager.h"
 
+bool IsRedundantXFWrite(u32 address, u32 value)
+{
+  const bool is_flushing_register =
+      (address >= XFMEM_SETVIEWPORT && address < XFMEM_SETVIEWPORT + 6) ||
+      (address >= XFMEM_SETPROJECTION && address < XFMEM_SETPROJECTION + 7) ||
+      (address >= XFMEM_SETTEXMTXINFO && address < XFMEM_SETTEXMTXINFO + 8) ||
+      (address >= XFMEM_SETPOSTMTXINFO && address < XFMEM_SETPOSTMTXINFO + 8);
+  if (address >= XFMEM_REGISTERS_START && !is_flushing_register)
+    return false;
+
+  return reinterpret_cast<const u32*>(&xfmem)[address] == value;
+}
+
 static void XFMemWritten(XFStateManager& xf_state_manager, u32 transferSize, u32 baseAddress)
 {
   g_vertex_manager->Flush();
@@ -120,6 +133,11 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
     case XFMEM_SETVIEWPORT + 3:
     case XFMEM_SETVIEWPORT + 4:
     case XFMEM_SETVIEWPORT + 5:
+      if (IsRedundantXFWrite(address, value))
+      {
+        g_vertex_manager->DeferFlush();
+        break;
+      }
       g_vertex_manager->Flush();
       xf_state_manager.SetViewportChanged();
       system.GetPixelShaderManager().SetViewportChanged();
@@ -133,6 +151,11 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
     case XFMEM_SETPROJECTION + 4:
     case XFMEM_SETPROJECTION + 5:
     case XFMEM_SETPROJECTION + 6:
+      if (IsRedundantXFWrite(address, value))
+      {
+        g_vertex_manager->DeferFlush();
+        break;
+      }
       g_vertex_manager->Flush();
       xf_state_manager.SetProjectionChanged();
       system.GetGeometryShaderManager().SetProjectionChanged();
@@ -151,6 +174,11 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
     case XFMEM_SETTEXMTXINFO + 5:
     case XFMEM_SETTEXMTXINFO + 6:
     case XFMEM_SETTEXMTXINFO + 7:
+      if (IsRedundantXFWrite(address, value))
+      {
+        g_vertex_manager->DeferFlush();
+        break;
+      }
       g_vertex_manager->Flush();
       xf_state_manager.SetTexMatrixInfoChanged(address - XFMEM_SETTEXMTXINFO);
       break;
@@ -163,6 +191,11 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
     case XFMEM_SETPOSTMTXINFO + 5:
     case XFMEM_SETPOSTMTXINFO + 6:
     case XFMEM_SETPOSTMTXINFO + 7:
+      if (IsRedundantXFWrite(address, value))
+      {
+        g_vertex_manager->DeferFlush();
+        break;
+      }
       g_vertex_manager->Flush();
       xf_state_manager.SetTexMatrixInfoChanged(address - XFMEM_SETPOSTMTXINFO);
       break;
@@ -232,12 +265,30 @@ void LoadXFReg(u16 base_address, u8 transfer_size, const u8* data)
       base_address = XFMEM_REGISTERS_START;
     }
 
-    XFMemWritten(xf_state_manager, xf_mem_transfer_size, xf_mem_base);
+    // Games often load the same matrices and lights again for each object. Like with indexed
+    // loads, only flush if the data actually changes.
+    u32* const curr_data = reinterpret_cast<u32*>(&xfmem) + xf_mem_base;
+    bool changed = false;
     for (u32 i = 0; i < xf_mem_transfer_size; i++)
     {
-      ((u32*)&xfmem)[xf_mem_base + i] = Common::swap32(data);
-      data += 4;
+      if (!IsRedundantXFWrite(xf_mem_base + i, Common::swap32(data + i * 4)))
+      {
+        changed = true;
+        break;
+      }
+    }
+
+    if (changed)
+    {
+      XFMemWritten(xf_state_manager, xf_mem_transfer_size, xf_mem_base);
+      for (u32 i = 0; i < xf_mem_transfer_size; i++)
+        curr_data[i] = Common::swap32(data + i * 4);
+    }
+    else
+    {
+      g_vertex_manager->DeferFlush();
     }
+    data += xf_mem_transfer_size * 4;
   }
 
   // write to XF regs
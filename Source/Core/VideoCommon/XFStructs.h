@@ -8,6 +8,10 @@
 
 #include "VideoCommon/XFMemory.h"
 
+// Whether writing value to address leaves a matrix, light, viewport, projection or texture
+// coordinate setting unchanged, so that the queued vertices don't need to be flushed for it.
+bool IsRedundantXFWrite(u32 address, u32 value);
+
 std::pair<std::string, std::string> GetXFRegInfo(u32 address, u32 value);
 std::string GetXFMemName(u32 address);
 std::string GetXFMemDescription(u32 address, u32 value);
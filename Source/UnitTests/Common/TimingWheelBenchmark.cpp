@@ -0,0 +1,94 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <compare>
+#include <functional>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/TimingWheel.h"
+
+namespace
+{
+struct Item
+{
+  s64 time;
+  u64 order;
+
+  constexpr auto operator<=>(const Item& other) const
+  {
+    return std::tie(time, order) <=> std::tie(other.time, other.order);
+  }
+  constexpr bool operator==(const Item& other) const = default;
+};
+
+// A binary heap, which is what CoreTiming kept its events in before the wheel.
+class HeapQueue
+{
+public:
+  void Push(Item item)
+  {
+    m_heap.push_back(item);
+    std::ranges::push_heap(m_heap, std::ranges::greater{});
+  }
+
+  Item Pop()
+  {
+    std::ranges::pop_heap(m_heap, std::ranges::greater{});
+    const Item item = m_heap.back();
+    m_heap.pop_back();
+    return item;
+  }
+
+private:
+  std::vector<Item> m_heap;
+};
+
+// Returns the time per pop of the earliest event and push of a new one, with a constant number of
+// pending events.
+template <typename Queue>
+double MeasurePopPush(Queue& queue, u32 pending)
+{
+  constexpr u32 iterations = 1000000;
+
+  std::mt19937_64 rng(pending);
+  std::uniform_int_distribution<s64> distance(1, 1000000);
+  u64 order = 0;
+  for (u32 i = 0; i < pending; ++i)
+    queue.Push({distance(rng), order++});
+
+  const auto start = std::chrono::steady_clock::now();
+  s64 sink = 0;
+  for (u32 i = 0; i < iterations; ++i)
+  {
+    const Item item = queue.Pop();
+    sink += item.time;
+    queue.Push({item.time + distance(rng), order++});
+  }
+  const auto end = std::chrono::steady_clock::now();
+  EXPECT_NE(sink, 0);
+  return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+}  // namespace
+
+TEST(TimingWheelBenchmark, PopPush)
+{
+  for (const u32 pending : {16u, 1024u, 4096u, 16384u})
+  {
+    HeapQueue heap;
+    Common::TimingWheel<Item> wheel;
+    wheel.Reset(0);
+    const double heap_ns = MeasurePopPush(heap, pending);
+    const double wheel_ns = MeasurePopPush(wheel, pending);
+    fmt::print("{:5} pending: heap {:6.2f} ns, wheel {:6.2f} ns per pop + push\n", pending, heap_ns,
+               wheel_ns);
+  }
+}
@@ -0,0 +1,188 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <compare>
+#include <functional>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/TimingWheel.h"
+
+namespace
+{
+struct Item
+{
+  s64 time;
+  u64 order;
+
+  constexpr auto operator<=>(const Item& other) const
+  {
+    return std::tie(time, order) <=> std::tie(other.time, other.order);
+  }
+  constexpr bool operator==(const Item& other) const = default;
+};
+
+// The binary heap the wheel has to match.
+class ReferenceQueue
+{
+public:
+  void Push(Item item)
+  {
+    m_heap.push_back(item);
+    std::ranges::push_heap(m_heap, std::ranges::greater{});
+  }
+
+  Item Pop()
+  {
+    std::ranges::pop_heap(m_heap, std::ranges::greater{});
+    const Item item = m_heap.back();
+    m_heap.pop_back();
+    return item;
+  }
+
+  const Item& Top() const { return m_heap.front(); }
+  bool Empty() const { return m_heap.empty(); }
+
+private:
+  std::vector<Item> m_heap;
+};
+
+// Pushes events at random distances from a clock that moves forward, like CoreTiming does, and
+// pops everything that is due after every step.
+void RunSimulation(std::mt19937_64& rng, s64 max_distance, u32 steps)
+{
+  Common::TimingWheel<Item> wheel;
+  ReferenceQueue reference;
+  wheel.Reset(0);
+
+  std::uniform_int_distribution<s64> distance(-100, max_distance);
+  std::uniform_int_distribution<u32> count(0, 8);
+  std::uniform_int_distribution<s64> step(0, max_distance / 16 + 1);
+
+  s64 now = 0;
+  u64 order = 0;
+  for (u32 i = 0; i < steps; ++i)
+  {
+    for (u32 j = count(rng); j != 0; --j)
+    {
+      const Item item{now + distance(rng), order++};
+      wheel.Push(item);
+      reference.Push(item);
+    }
+
+    now += step(rng);
+    while (!reference.Empty() && reference.Top().time <= now)
+    {
+      ASSERT_FALSE(wheel.Empty());
+      ASSERT_EQ(reference.Top(), wheel.Top());
+      ASSERT_EQ(reference.Pop(), wheel.Pop());
+    }
+    if (!reference.Empty())
+      ASSERT_EQ(reference.Top(), wheel.Top());
+  }
+
+  while (!reference.Empty())
+    ASSERT_EQ(reference.Pop(), wheel.Pop());
+  EXPECT_TRUE(wheel.Empty());
+}
+}  // namespace
+
+TEST(TimingWheel, Simple)
+{
+  Common::TimingWheel<Item> wheel;
+  wheel.Reset(0);
+  EXPECT_TRUE(wheel.Empty());
+
+  wheel.Push({1000, 0});
+  wheel.Push({500, 1});
+  wheel.Push({800, 2});
+  wheel.Push({100, 3});
+  wheel.Push({1200, 4});
+  EXPECT_EQ(5u, wheel.Size());
+
+  EXPECT_EQ(3u, wheel.Pop().order);
+  EXPECT_EQ(1u, wheel.Pop().order);
+  EXPECT_EQ(2u, wheel.Pop().order);
+  EXPECT_EQ(0u, wheel.Pop().order);
+  EXPECT_EQ(4u, wheel.Pop().order);
+  EXPECT_TRUE(wheel.Empty());
+}
+
+TEST(TimingWheel, SameTime)
+{
+  Common::TimingWheel<Item> wheel;
+  wheel.Reset(0);
+
+  // Items with the same time come out in insertion order, even when they are spread over several
+  // levels and pushed in reverse.
+  for (u64 i = 0; i < 100; ++i)
+    wheel.Push({s64(1) << (i % 40), 99 - i});
+
+  Item previous{-1, 0};
+  while (!wheel.Empty())
+  {
+    const Item item = wheel.Pop();
+    EXPECT_LT(previous, item);
+    previous = item;
+  }
+}
+
+TEST(TimingWheel, FarFutureAndPast)
+{
+  Common::TimingWheel<Item> wheel;
+  wheel.Reset(1000000);
+
+  wheel.Push({s64(1) << 60, 0});
+  wheel.Push({-(s64(1) << 60), 1});
+  wheel.Push({(s64(1) << 50) + 3, 2});
+  wheel.Push({(s64(1) << 50) + 2, 3});
+  wheel.Push({999999, 4});
+  wheel.Push({1000000 + (s64(1) << 34), 5});
+
+  EXPECT_EQ(1u, wheel.Pop().order);
+  EXPECT_EQ(4u, wheel.Pop().order);
+  EXPECT_EQ(5u, wheel.Pop().order);
+  EXPECT_EQ(3u, wheel.Pop().order);
+  EXPECT_EQ(2u, wheel.Pop().order);
+  EXPECT_EQ(0u, wheel.Pop().order);
+  EXPECT_TRUE(wheel.Empty());
+}
+
+TEST(TimingWheel, EraseIf)
+{
+  Common::TimingWheel<Item> wheel;
+  wheel.Reset(0);
+
+  for (u64 i = 0; i < 1000; ++i)
+    wheel.Push({s64(i * i * 97), i});
+  // Move some items into the due heap.
+  EXPECT_EQ(0u, wheel.Top().order);
+
+  EXPECT_EQ(500u, wheel.EraseIf([](const Item& item) { return item.order % 2 == 0; }));
+  EXPECT_EQ(500u, wheel.Size());
+
+  u64 count = 0;
+  wheel.ForEach([&](const Item& item) {
+    EXPECT_EQ(1u, item.order % 2);
+    ++count;
+  });
+  EXPECT_EQ(500u, count);
+
+  for (u64 i = 1; i < 1000; i += 2)
+    EXPECT_EQ(i, wheel.Pop().order);
+  EXPECT_TRUE(wheel.Empty());
+}
+
+TEST(TimingWheel, MatchesHeap)
+{
+  std::mt19937_64 rng(0x1234);
+  RunSimulation(rng, 1000, 10000);
+  RunSimulation(rng, 100000, 10000);
+  RunSimulation(rng, 100000000, 10000);
+  RunSimulation(rng, s64(1) << 40, 1000);
+}
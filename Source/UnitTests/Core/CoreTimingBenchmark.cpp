@@ -0,0 +1,90 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+
+#include <fmt/format.h>
+
+#include "Common/Config/Config.h"
+#include "Common/FileUtil.h"
+#include "Core/ConfigManager.h"
+#include "Core/Core.h"
+#include "Core/CoreTiming.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+#include "UICommon/UICommon.h"
+
+namespace
+{
+CoreTiming::EventType* s_cb_periodic = nullptr;
+u64 s_events_run = 0;
+
+// Reschedules itself with the period in userdata, like the periodic events of the hardware do.
+void PeriodicCallback(Core::System& system, const u64 userdata, const s64 lateness)
+{
+  ++s_events_run;
+  system.GetCoreTiming().ScheduleEvent(static_cast<s64>(userdata) - lateness, s_cb_periodic,
+                                       userdata);
+}
+}  // namespace
+
+// Measures Advance() with thousands of pending periodic events.
+TEST(CoreTimingBenchmark, ManyPendingEvents)
+{
+  auto& system = Core::System::GetInstance();
+
+  const std::string profile_path = File::CreateTempDir();
+  ASSERT_FALSE(profile_path.empty());
+  Core::DeclareAsCPUThread();
+  UICommon::SetUserDirectory(profile_path);
+  Config::Init();
+  SConfig::Init();
+  system.GetPowerPC().Init(PowerPC::CPUCore::Interpreter);
+  auto& core_timing = system.GetCoreTiming();
+  core_timing.Init();
+
+  auto& ppc_state = system.GetPPCState();
+  s_cb_periodic = core_timing.RegisterEvent("callbackPeriodic", PeriodicCallback);
+
+  // Enter slice 0
+  core_timing.Advance();
+
+  for (const u64 pending : {16u, 1024u, 4096u, 16384u})
+  {
+    core_timing.RemoveEvent(s_cb_periodic);
+
+    u64 seed = pending;
+    for (u64 i = 0; i < pending; ++i)
+    {
+      seed = seed * 6364136223846793005 + 1442695040888963407;
+      const u64 period = 100 + (seed >> 33) % 1000000;
+      core_timing.ScheduleEvent(static_cast<s64>(period), s_cb_periodic, period);
+    }
+
+    constexpr u32 advances = 100000;
+    s_events_run = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (u32 i = 0; i < advances; ++i)
+    {
+      ppc_state.downcount = 0;
+      core_timing.Advance();
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    const double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    fmt::print("{:5} pending: {:6.2f} ns per Advance, {:6.2f} ns per event ({} events)\n",
+               pending, ns / advances, ns / std::max<u64>(s_events_run, 1), s_events_run);
+  }
+
+  core_timing.RemoveEvent(s_cb_periodic);
+  core_timing.Shutdown();
+  system.GetPowerPC().Shutdown();
+  SConfig::Shutdown();
+  Config::Shutdown();
+  Core::UndeclareAsCPUThread();
+  File::DeleteDirRecursively(profile_path);
+}
@@ -3,9 +3,14 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
 #include <bitset>
 #include <string>
+#include <thread>
+#include <vector>
+
+#include <fmt/format.h>
 
 #include "Common/Config/Config.h"
 #include "Common/FileUtil.h"
@@ -393,3 +398,126 @@ TEST(CoreTiming, Overclocking)
   Config::SetCurrent(Config::MAIN_OVERCLOCK, 1.0f);
   AdvanceAndCheck(system, 4, MAX_SLICE_LENGTH);
 }
+
+namespace ManyEventsTest
+{
+static std::vector<u64> s_fired;
+
+static void RecordCallback(Core::System& system, const u64 userdata, const s64 lateness)
+{
+  s_fired.push_back(userdata);
+}
+
+struct ScheduledEvent
+{
+  s64 time;
+  u64 id;
+  CoreTiming::EventType* type;
+};
+}  // namespace ManyEventsTest
+
+// Thousands of pending events spread over several levels of the timing wheel must still run in
+// exactly (time, scheduling order) order.
+TEST(CoreTiming, ManyEvents)
+{
+  using namespace ManyEventsTest;
+
+  auto& system = Core::System::GetInstance();
+
+  ScopeInit guard(system);
+  ASSERT_TRUE(guard.UserDirectoryExists());
+
+  auto& core_timing = system.GetCoreTiming();
+  auto& ppc_state = system.GetPPCState();
+
+  std::array<CoreTiming::EventType*, 4> types;
+  for (size_t i = 0; i < types.size(); ++i)
+    types[i] = core_timing.RegisterEvent(fmt::format("callback{}", i), RecordCallback);
+
+  // Enter slice 0
+  core_timing.Advance();
+
+  std::vector<ScheduledEvent> expected;
+  u64 seed = 1;
+  for (u64 id = 0; id < 5000; ++id)
+  {
+    seed = seed * 6364136223846793005 + 1442695040888963407;
+    // Half of the events share a few hundred distinct times, the rest are spread much further.
+    const u64 range = id % 2 == 0 ? 300 : 50000000;
+    const s64 cycles = static_cast<s64>((seed >> 33) % range) * (id % 2 == 0 ? 10 : 1);
+    CoreTiming::EventType* type = types[id % types.size()];
+    core_timing.ScheduleEvent(cycles, type, id);
+    expected.push_back({cycles, id, type});
+  }
+
+  core_timing.RemoveEvent(types[3]);
+  std::erase_if(expected, [&](const ScheduledEvent& ev) { return ev.type == types[3]; });
+  std::ranges::stable_sort(expected, {}, &ScheduledEvent::time);
+
+  s_fired.clear();
+  for (u32 i = 0; i < 100000 && s_fired.size() < expected.size(); ++i)
+  {
+    ppc_state.downcount = 0;
+    core_timing.Advance();
+  }
+
+  ASSERT_EQ(expected.size(), s_fired.size());
+  for (size_t i = 0; i < expected.size(); ++i)
+    EXPECT_EQ(expected[i].id, s_fired[i]);
+  EXPECT_EQ(MAX_SLICE_LENGTH, ppc_state.downcount);
+}
+
+// Events scheduled concurrently from several non-CPU threads must all arrive, and the events of
+// each thread must keep the order that thread scheduled them in.
+TEST(CoreTiming, ScheduleFromManyThreads)
+{
+  using namespace ManyEventsTest;
+
+  auto& system = Core::System::GetInstance();
+
+  ScopeInit guard(system);
+  ASSERT_TRUE(guard.UserDirectoryExists());
+
+  auto& core_timing = system.GetCoreTiming();
+  auto& ppc_state = system.GetPPCState();
+
+  CoreTiming::EventType* cb = core_timing.RegisterEvent("callbackRecord", RecordCallback);
+
+  // Enter slice 0
+  core_timing.Advance();
+
+  constexpr u64 num_threads = 4;
+  constexpr u64 events_per_thread = 2000;
+
+  s_fired.clear();
+  std::vector<std::thread> threads;
+  for (u64 thread = 0; thread < num_threads; ++thread)
+  {
+    threads.emplace_back([&core_timing, cb, thread] {
+      for (u64 i = 0; i < events_per_thread; ++i)
+      {
+        core_timing.ScheduleEvent(static_cast<s64>(i), cb, thread << 32 | i,
+                                  CoreTiming::FromThread::NON_CPU);
+      }
+    });
+  }
+
+  while (s_fired.size() < num_threads * events_per_thread)
+  {
+    ppc_state.downcount = 0;
+    core_timing.Advance();
+    std::this_thread::yield();
+  }
+
+  for (std::thread& thread : threads)
+    thread.join();
+
+  std::array<u64, num_threads> next{};
+  for (const u64 userdata : s_fired)
+  {
+    const u64 thread = userdata >> 32;
+    ASSERT_LT(thread, num_threads);
+    EXPECT_EQ(next[thread], userdata & 0xFFFFFFFF);
+    next[thread] = (userdata & 0xFFFFFFFF) + 1;
+  }
+}
@@ -0,0 +1,180 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Core/HW/PageWriteTracker.h"
+
+using Memory::PageWriteTracker;
+
+namespace
+{
+constexpr u32 PAGE_SIZE = PageWriteTracker::PAGE_SIZE;
+constexpr u32 MEM1_SIZE = 0x01800000;
+constexpr u32 MEM2_SIZE = 0x04000000;
+constexpr u32 MEM2_ADDRESS = 0x10000000;
+
+using Runs = std::vector<std::pair<u32, u32>>;
+
+auto RecordRuns(Runs* runs)
+{
+  return [runs](u32 address, u32 size) { runs->emplace_back(address, size); };
+}
+}  // namespace
+
+TEST(PageWriteTracker, RecordsWritesToWatchedPages)
+{
+  PageWriteTracker tracker;
+  tracker.Init(MEM1_SIZE, MEM2_SIZE);
+  Runs runs;
+
+  const std::optional<u64> generation = tracker.Watch(0x1000, 0x2000, RecordRuns(&runs));
+  ASSERT_TRUE(generation.has_value());
+  EXPECT_TRUE(tracker.IsUnchangedSince(0x1000, 0x2000, *generation));
+  EXPECT_TRUE(tracker.IsWatched(0x2FFF, 1));
+  EXPECT_FALSE(tracker.IsWatched(0x3000, 0x100));
+
+  // Writes next to the range don't count.
+  EXPECT_FALSE(tracker.Unwatch(0x3000, 0x1000, RecordRuns(&runs)));
+  EXPECT_FALSE(tracker.Unwatch(MEM2_ADDRESS + 0x1000, 0x1000, RecordRuns(&runs)));
+  EXPECT_TRUE(tracker.IsUnchangedSince(0x1000, 0x2000, *generation));
+
+  EXPECT_TRUE(tracker.Unwatch(0x2FFC, 8, RecordRuns(&runs)));
+  EXPECT_FALSE(tracker.IsUnchangedSince(0x1000, 0x2000, *generation));
+  EXPECT_TRUE(tracker.IsUnchangedSince(0x1000, 0x1000, *generation));
+  EXPECT_FALSE(tracker.IsWatched(0x2000, 0x1000));
+
+  // Watching again starts a new generation for the range.
+  const std::optional<u64> new_generation = tracker.Watch(0x1000, 0x2000, RecordRuns(&runs));
+  ASSERT_TRUE(new_generation.has_value());
+  EXPECT_LT(*generation, *new_generation);
+  EXPECT_TRUE(tracker.IsUnchangedSince(0x1000, 0x2000, *new_generation));
+  EXPECT_FALSE(tracker.IsUnchangedSince(0x1000, 0x2000, *generation));
+}
+
+TEST(PageWriteTracker, ProtectsRunsOfPages)
+{
+  PageWriteTracker tracker;
+  tracker.Init(MEM1_SIZE, MEM2_SIZE);
+  Runs runs;
+
+  tracker.Watch(0x3000, 0x1000, RecordRuns(&runs));
+  EXPECT_EQ((Runs{{0x3000, 0x1000}}), runs);
+
+  // Only pages which aren't watched yet are protected, and partial pages count as whole ones.
+  runs.clear();
+  tracker.Watch(0x1800, 0x4000, RecordRuns(&runs));
+  EXPECT_EQ((Runs{{0x1000, 0x2000}, {0x4000, 0x2000}}), runs);
+  EXPECT_EQ(5u, tracker.GetWatchedPageCount());
+
+  runs.clear();
+  tracker.Watch(MEM2_ADDRESS + 0x8000, 0x10, RecordRuns(&runs));
+  EXPECT_EQ((Runs{{MEM2_ADDRESS + 0x8000, PAGE_SIZE}}), runs);
+
+  runs.clear();
+  EXPECT_TRUE(tracker.Unwatch(0x2000, 0x2001, RecordRuns(&runs)));
+  EXPECT_EQ((Runs{{0x2000, 0x3000}}), runs);
+
+  runs.clear();
+  tracker.UnwatchAll(RecordRuns(&runs));
+  EXPECT_EQ((Runs{{0x1000, 0x1000}, {0x5000, 0x1000}, {MEM2_ADDRESS + 0x8000, PAGE_SIZE}}), runs);
+  EXPECT_EQ(0u, tracker.GetWatchedPageCount());
+}
+
+TEST(PageWriteTracker, Addresses)
+{
+  PageWriteTracker tracker;
+  tracker.Init(MEM1_SIZE, 0);
+  Runs runs;
+
+  // Uncached and cached mirrors are the same memory.
+  tracker.Watch(0x0000'1000, 0x100, RecordRuns(&runs));
+  EXPECT_TRUE(tracker.IsWatched(0xC000'1000, 4));
+  EXPECT_TRUE(tracker.IsWatched(0x8000'1000, 4));
+
+  // Ranges that aren't completely within MEM1 or MEM2 can't be watched.
+  EXPECT_FALSE(tracker.Watch(MEM1_SIZE - 0x100, 0x200, RecordRuns(&runs)).has_value());
+  EXPECT_FALSE(tracker.Watch(MEM2_ADDRESS, 0x100, RecordRuns(&runs)).has_value());
+  EXPECT_FALSE(tracker.Watch(0x0C00'0000, 0x100, RecordRuns(&runs)).has_value());
+  EXPECT_FALSE(tracker.Watch(0x1000, 0, RecordRuns(&runs)).has_value());
+  EXPECT_FALSE(tracker.IsUnchangedSince(MEM1_SIZE - 0x100, 0x200, 0));
+
+  // But writes to them are recorded for the part that is.
+  const std::optional<u64> generation = tracker.Watch(MEM1_SIZE - 0x100, 0x100, RecordRuns(&runs));
+  ASSERT_TRUE(generation.has_value());
+  EXPECT_TRUE(tracker.Unwatch(MEM1_SIZE - 0x10, 0x20, RecordRuns(&runs)));
+  EXPECT_FALSE(tracker.IsUnchangedSince(MEM1_SIZE - 0x100, 0x100, *generation));
+
+  // Physical addresses that faults are checked against aren't mirrored.
+  EXPECT_TRUE(tracker.IsTracked(MEM1_SIZE - 1));
+  EXPECT_FALSE(tracker.IsTracked(MEM1_SIZE));
+  EXPECT_FALSE(tracker.IsTracked(MEM2_ADDRESS));
+  EXPECT_FALSE(tracker.IsTracked(0x4000'1000));
+}
+
+// Compares the tracker with remembering every write.
+TEST(PageWriteTracker, MatchesWriteLog)
+{
+  struct Hash
+  {
+    u32 address;
+    u32 size;
+    u64 generation;
+    bool written;
+  };
+
+  std::mt19937 rng(0x9a6e);
+  PageWriteTracker tracker;
+  tracker.Init(MEM1_SIZE, MEM2_SIZE);
+  std::vector<Hash> hashes;
+  u32 protected_pages = 0;
+
+  const auto random_range = [&]() -> std::pair<u32, u32> {
+    // A small area, so that ranges overlap a lot.
+    const u32 base = rng() % 2 ? MEM2_ADDRESS : 0;
+    return {base + rng() % (64 * PAGE_SIZE), 1 + rng() % (4 * PAGE_SIZE)};
+  };
+  const auto protect = [&](u32, u32 size) { protected_pages += size / PAGE_SIZE; };
+  const auto unprotect = [&](u32, u32 size) { protected_pages -= size / PAGE_SIZE; };
+
+  for (int i = 0; i < 20000; i++)
+  {
+    const auto [address, size] = random_range();
+    if (rng() % 2)
+    {
+      const std::optional<u64> generation = tracker.Watch(address, size, protect);
+      ASSERT_TRUE(generation.has_value());
+      hashes.push_back({address, size, *generation, false});
+    }
+    else
+    {
+      if (tracker.IsWatched(address, size))
+        tracker.Unwatch(address, size, unprotect);
+
+      for (Hash& hash : hashes)
+      {
+        // Writes are tracked per page, so a write to the same page counts.
+        if (address / PAGE_SIZE <= (hash.address + hash.size - 1) / PAGE_SIZE &&
+            hash.address / PAGE_SIZE <= (address + size - 1) / PAGE_SIZE)
+        {
+          hash.written = true;
+        }
+      }
+    }
+
+    ASSERT_EQ(tracker.GetWatchedPageCount(), protected_pages);
+    for (const Hash& hash : hashes)
+    {
+      ASSERT_EQ(!hash.written, tracker.IsUnchangedSince(hash.address, hash.size, hash.generation))
+          << i;
+    }
+    if (hashes.size() > 100)
+      hashes.erase(hashes.begin(), hashes.begin() + 50);
+  }
+}
@@ -0,0 +1,105 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <cstring>
+
+#include "Common/BitSet.h"
+#include "Common/CommonTypes.h"
+#include "Common/ScopeGuard.h"
+#include "Core/Core.h"
+#include "Core/PowerPC/Jit64/Jit.h"
+#include "Core/PowerPC/Jit64Common/BlockCache.h"
+#include "Core/System.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+class TestBlockCache : public JitBlockCache
+{
+public:
+  using JitBlockCache::JitBlockCache;
+  using JitBlockCache::WriteLinkBlock;
+};
+
+constexpr u8 JMP_REL32 = 0xE9;
+constexpr u8 FILL = 0xCC;
+
+s32 GetJumpDisplacement(const u8* jump)
+{
+  s32 displacement;
+  std::memcpy(&displacement, jump + 1, sizeof(displacement));
+  return displacement;
+}
+
+struct LinkTest
+{
+  LinkTest() : jit(Core::System::GetInstance()), cache(jit) { code.fill(FILL); }
+
+  Jit64 jit;
+  TestBlockCache cache;
+  std::array<u8, 32> code;
+};
+}  // namespace
+
+TEST(Jit64, LinkToFollowingBlockNopsOutJump)
+{
+  Core::DeclareAsCPUThread();
+  Common::ScopeGuard cpu_thread_guard([] { Core::UndeclareAsCPUThread(); });
+  LinkTest test;
+
+  JitBlock dest(false);
+  dest.normalEntry = test.code.data() + 5;
+
+  JitBlock::LinkData source{};
+  source.exitPtrs = test.code.data();
+  test.cache.WriteLinkBlock(source, &dest);
+
+  EXPECT_NE(JMP_REL32, test.code[0]);
+  EXPECT_EQ(FILL, test.code[5]);
+}
+
+TEST(Jit64, LinkToFollowingPreloadedEntryKeepsLoads)
+{
+  Core::DeclareAsCPUThread();
+  Common::ScopeGuard cpu_thread_guard([] { Core::UndeclareAsCPUThread(); });
+  LinkTest test;
+
+  // The destination directly follows the exit, and its normal entry loads a single register
+  // (mov ebx, [rbp+d8] is 3 bytes) before the preloaded entry.
+  JitBlock dest(false);
+  dest.normalEntry = test.code.data() + 5;
+  dest.preloadedEntry = test.code.data() + 8;
+  dest.preloaded_gprs = BitSet32{3};
+
+  JitBlock::LinkData source{};
+  source.exitPtrs = test.code.data();
+  source.preloaded_gprs = dest.preloaded_gprs;
+  test.cache.WriteLinkBlock(source, &dest);
+
+  EXPECT_EQ(JMP_REL32, test.code[0]);
+  EXPECT_EQ(3, GetJumpDisplacement(test.code.data()));
+  for (size_t i = 5; i < test.code.size(); i++)
+    EXPECT_EQ(FILL, test.code[i]) << "byte " << i;
+}
+
+TEST(Jit64, LinkWithOtherRegistersUsesNormalEntry)
+{
+  Core::DeclareAsCPUThread();
+  Common::ScopeGuard cpu_thread_guard([] { Core::UndeclareAsCPUThread(); });
+  LinkTest test;
+
+  JitBlock dest(false);
+  dest.normalEntry = test.code.data() + 16;
+  dest.preloadedEntry = test.code.data() + 19;
+  dest.preloaded_gprs = BitSet32{3};
+
+  JitBlock::LinkData source{};
+  source.exitPtrs = test.code.data();
+  source.preloaded_gprs = BitSet32{4};
+  test.cache.WriteLinkBlock(source, &dest);
+
+  EXPECT_EQ(JMP_REL32, test.code[0]);
+  EXPECT_EQ(11, GetJumpDisplacement(test.code.data()));
+}
@@ -0,0 +1,190 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/ScopeGuard.h"
+#include "Core/Core.h"
+#include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/JitCommon/JitAsmCommon.h"
+#include "Core/System.h"
+
+#include "TestQuantize.h"
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+namespace
+{
+template <typename T>
+u64 ReferenceDequantize(u64 input, u32 scale)
+{
+  using U = std::make_unsigned_t<T>;
+  constexpr u32 bits = sizeof(T) * 8;
+
+  const float factor = m_dequantizeTableS[scale * 2];
+  const auto dequantize = [&](U value) {
+    return std::bit_cast<u32>(static_cast<float>(static_cast<T>(value)) * factor);
+  };
+  return dequantize(static_cast<U>(input)) | u64(dequantize(static_cast<U>(input >> bits))) << 32;
+}
+
+template <typename T>
+u64 ReferenceQuantize(u64 input, u32 scale)
+{
+  using U = std::make_unsigned_t<T>;
+  constexpr u32 bits = sizeof(T) * 8;
+  constexpr float min = static_cast<float>(std::numeric_limits<T>::min());
+  constexpr float max = static_cast<float>(std::numeric_limits<T>::max());
+
+  const float factor = m_quantizeTableS[scale * 2];
+  const auto quantize = [&](u32 value) -> u64 {
+    const float scaled = std::bit_cast<float>(value) * factor;
+    if (std::isnan(scaled))
+      return 0;
+    return static_cast<U>(static_cast<T>(std::clamp(std::trunc(scaled), min, max)));
+  };
+  return quantize(static_cast<u32>(input)) | quantize(static_cast<u32>(input >> 32)) << bits;
+}
+
+u64 ReferenceDequantize(EQuantizeType type, u64 input, u32 scale)
+{
+  switch (type)
+  {
+  case QUANTIZE_U8:
+    return ReferenceDequantize<u8>(input, scale);
+  case QUANTIZE_U16:
+    return ReferenceDequantize<u16>(input, scale);
+  case QUANTIZE_S8:
+    return ReferenceDequantize<s8>(input, scale);
+  default:
+    return ReferenceDequantize<s16>(input, scale);
+  }
+}
+
+u64 ReferenceQuantize(EQuantizeType type, u64 input, u32 scale)
+{
+  switch (type)
+  {
+  case QUANTIZE_U8:
+    return ReferenceQuantize<u8>(input, scale);
+  case QUANTIZE_U16:
+    return ReferenceQuantize<u16>(input, scale);
+  case QUANTIZE_S8:
+    return ReferenceQuantize<s8>(input, scale);
+  default:
+    return ReferenceQuantize<s16>(input, scale);
+  }
+}
+
+// Only the bits that psq_st writes to memory are meaningful in the result of quantization.
+u64 GetQuantizedMask(EQuantizeType type)
+{
+  return type == QUANTIZE_U8 || type == QUANTIZE_S8 ? 0xffff : 0xffffffff;
+}
+
+std::vector<u64> GetIntegerInputs(EQuantizeType type)
+{
+  std::vector<u64> inputs;
+  if (type == QUANTIZE_U8 || type == QUANTIZE_S8)
+  {
+    for (u32 i = 0; i < 0x100; i++)
+      inputs.push_back(i | (0xff - i) << 8);
+  }
+  else
+  {
+    for (u32 i = 0; i < 0x10000; i += 0x101)
+      inputs.push_back(i | (0xffff - i) << 16);
+  }
+  return inputs;
+}
+
+std::vector<u64> GetFloatInputs()
+{
+  static constexpr std::array<float, 20> values = {
+      0.0f,     -0.0f,    0.5f,     -0.5f,     1.0f,     -1.0f,     1.5f,
+      127.9f,   128.0f,   -128.5f,  255.5f,    256.0f,   32767.5f,  -32768.5f,
+      65535.0f, 65536.0f, 1.0e10f,  -1.0e10f,  1.0e-5f,  std::numeric_limits<float>::infinity()};
+
+  std::vector<u64> inputs;
+  for (const float a : values)
+  {
+    for (const float b : values)
+      inputs.push_back(std::bit_cast<u32>(a) | u64(std::bit_cast<u32>(b)) << 32);
+  }
+  inputs.push_back(std::bit_cast<u32>(std::numeric_limits<float>::quiet_NaN()) |
+                   u64(std::bit_cast<u32>(-std::numeric_limits<float>::infinity())) << 32);
+  return inputs;
+}
+
+}  // namespace
+
+TEST(JitArm64, Dequantize)
+{
+  Core::DeclareAsCPUThread();
+  Common::ScopeGuard cpu_thread_guard([] { Core::UndeclareAsCPUThread(); });
+
+  TestQuantize test(Core::System::GetInstance());
+
+  for (const EQuantizeType type : QUANTIZED_TYPES)
+  {
+    for (u32 scale = 0; scale < NUM_SCALES; scale++)
+    {
+      for (const u64 input : GetIntegerInputs(type))
+      {
+        const u64 expected = ReferenceDequantize(type, input, scale);
+        const u64 runtime = test.Dequantize(type, RUNTIME_SCALE)(input, scale);
+        const u64 constant = test.Dequantize(type, scale)(input, 0);
+
+        if (expected != runtime || expected != constant)
+        {
+          fmt::print("type {} scale {}: {:016x} -> {:016x} / {:016x} == {:016x}\n",
+                     static_cast<u32>(type), scale, input, runtime, constant, expected);
+        }
+
+        EXPECT_EQ(expected, runtime);
+        EXPECT_EQ(expected, constant);
+      }
+    }
+  }
+}
+
+TEST(JitArm64, Quantize)
+{
+  Core::DeclareAsCPUThread();
+  Common::ScopeGuard cpu_thread_guard([] { Core::UndeclareAsCPUThread(); });
+
+  TestQuantize test(Core::System::GetInstance());
+
+  const std::vector<u64> inputs = GetFloatInputs();
+  for (const EQuantizeType type : QUANTIZED_TYPES)
+  {
+    for (u32 scale = 0; scale < NUM_SCALES; scale++)
+    {
+      for (const u64 input : inputs)
+      {
+        const u64 expected = ReferenceQuantize(type, input, scale);
+        const u64 mask = GetQuantizedMask(type);
+        const u64 runtime = test.Quantize(type, RUNTIME_SCALE)(input, scale) & mask;
+        const u64 constant = test.Quantize(type, scale)(input, 0) & mask;
+
+        if (expected != runtime || expected != constant)
+        {
+          fmt::print("type {} scale {}: {:016x} -> {:016x} / {:016x} == {:016x}\n",
+                     static_cast<u32>(type), scale, input, runtime, constant, expected);
+        }
+
+        EXPECT_EQ(expected, runtime);
+        EXPECT_EQ(expected, constant);
+      }
+    }
+  }
+}
@@ -0,0 +1,53 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <bit>
+#include <chrono>
+
+#include "Common/CommonTypes.h"
+#include "Common/ScopeGuard.h"
+#include "Core/Core.h"
+#include "Core/PowerPC/Gekko.h"
+#include "Core/System.h"
+
+#include "TestQuantize.h"
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+// Compares the runtime scale path of the asm routines against the constant scale path used for
+// known GQRs, for every psq_l/psq_st type and scale.
+TEST(JitArm64Benchmark, Quantize)
+{
+  Core::DeclareAsCPUThread();
+  Common::ScopeGuard cpu_thread_guard([] { Core::UndeclareAsCPUThread(); });
+
+  TestQuantize test(Core::System::GetInstance());
+
+  constexpr u32 iterations = 100000;
+  const auto measure = [](ConversionFunction function, u64 input, u64 scale) {
+    const auto start = std::chrono::steady_clock::now();
+    u64 sink = 0;
+    for (u32 i = 0; i < iterations; i++)
+      sink ^= function(input ^ (i & 0xff), scale);
+    const auto end = std::chrono::steady_clock::now();
+    EXPECT_NE(sink, u64(0x0123456789abcdef));
+    return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+  };
+
+  const u64 float_input = std::bit_cast<u32>(12.75f) | u64(std::bit_cast<u32>(-3.5f)) << 32;
+  for (const EQuantizeType type : QUANTIZED_TYPES)
+  {
+    const u64 integer_input = type == QUANTIZE_U8 || type == QUANTIZE_S8 ? 0xe817 : 0xe8e81717;
+    for (u32 scale = 0; scale < NUM_SCALES; scale++)
+    {
+      fmt::print("type {} scale {:2}: psq_l {:5.2f} ns / {:5.2f} ns, "
+                 "psq_st {:5.2f} ns / {:5.2f} ns (runtime / constant)\n",
+                 static_cast<u32>(type), scale,
+                 measure(test.Dequantize(type, RUNTIME_SCALE), integer_input, scale),
+                 measure(test.Dequantize(type, scale), integer_input, 0),
+                 measure(test.Quantize(type, RUNTIME_SCALE), float_input, scale),
+                 measure(test.Quantize(type, scale), float_input, 0));
+    }
+  }
+}
@@ -0,0 +1,74 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <bit>
+
+#include "Common/Arm64Emitter.h"
+#include "Common/CommonTypes.h"
+#include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/JitArm64/Jit.h"
+#include "Core/System.h"
+
+constexpr std::array<EQuantizeType, 4> QUANTIZED_TYPES = {QUANTIZE_U8, QUANTIZE_U16, QUANTIZE_S8,
+                                                          QUANTIZE_S16};
+constexpr u32 NUM_SCALES = 64;
+constexpr int RUNTIME_SCALE = -1;
+
+using ConversionFunction = u64 (*)(u64 value, u64 scale);
+
+// Emits the code for converting between paired singles and quantized values once for every type
+// and scale, so that it can be called like a function.
+class TestQuantize : public JitArm64
+{
+public:
+  explicit TestQuantize(Core::System& system) : JitArm64(system)
+  {
+    using namespace Arm64Gen;
+
+    const Common::ScopedJITPageWriteAndNoExecute enable_jit_page_writes;
+
+    AllocCodeSpace(65536);
+
+    for (const EQuantizeType type : QUANTIZED_TYPES)
+    {
+      for (int scale = RUNTIME_SCALE; scale < static_cast<int>(NUM_SCALES); scale++)
+      {
+        m_dequantize[type][scale + 1] = std::bit_cast<ConversionFunction>(GetCodePtr());
+        m_float_emit.INS(64, ARM64Reg::D0, 0, ARM64Reg::X0);
+        EmitDequantize(ARM64Reg::D0, ARM64Reg::D0, type, scale, ARM64Reg::X1, ARM64Reg::X2,
+                       ARM64Reg::D1);
+        m_float_emit.UMOV(64, ARM64Reg::X0, ARM64Reg::D0, 0);
+        RET();
+
+        m_quantize[type][scale + 1] = std::bit_cast<ConversionFunction>(GetCodePtr());
+        m_float_emit.INS(64, ARM64Reg::D0, 0, ARM64Reg::X0);
+        EmitQuantize(ARM64Reg::D0, ARM64Reg::D0, type, scale, ARM64Reg::X1, ARM64Reg::X2,
+                     ARM64Reg::D1);
+        m_float_emit.UMOV(64, ARM64Reg::X0, ARM64Reg::D0, 0);
+        RET();
+      }
+    }
+
+    FlushIcache();
+  }
+
+  ~TestQuantize() override { FreeCodeSpace(); }
+
+  // A scale of RUNTIME_SCALE selects the code used by the asm routines, which reads the scale from
+  // a register. Any other scale selects the code emitted inline for a constant GQR.
+  ConversionFunction Dequantize(EQuantizeType type, int scale) const
+  {
+    return m_dequantize[type][scale + 1];
+  }
+  ConversionFunction Quantize(EQuantizeType type, int scale) const
+  {
+    return m_quantize[type][scale + 1];
+  }
+
+private:
+  std::array<std::array<ConversionFunction, NUM_SCALES + 1>, 8> m_dequantize{};
+  std::array<std::array<ConversionFunction, NUM_SCALES + 1>, 8> m_quantize{};
+};
@@ -0,0 +1,180 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/System.h"
+#include "VideoCommon/BPMemory.h"
+#include "VideoCommon/CPMemory.h"
+#include "VideoCommon/CPUCull.h"
+#include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/VertexLoaderBase.h"
+#include "VideoCommon/XFMemory.h"
+#include "VideoCommon/XFStateManager.h"
+
+namespace
+{
+class TestCPUCull : public CPUCull
+{
+public:
+  using CPUCull::m_bounds_test_enabled;
+};
+
+struct Triangle
+{
+  float x, y;
+  // Negative to flip the winding
+  float size;
+};
+
+// Enough vertices for the bounding box to be tested
+constexpr int NUM_TRIANGLES = 8;
+using Triangles = std::array<Triangle, NUM_TRIANGLES>;
+
+Triangles MakeTriangles(float x, float y, float size, float spacing)
+{
+  Triangles triangles;
+  for (int i = 0; i < NUM_TRIANGLES; i++)
+    triangles[i] = {x + (i % 4) * spacing, y + (i / 4) * spacing, size};
+  return triangles;
+}
+}  // namespace
+
+class CPUCullTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    TVtxDesc vtx_desc;
+    vtx_desc.low.Hex = 0;
+    vtx_desc.high.Hex = 0;
+    vtx_desc.low.Position = VertexComponentFormat::Direct;
+    VAT vat;
+    vat.g0.Hex = 0;
+    vat.g1.Hex = 0;
+    vat.g2.Hex = 0;
+    vat.g0.PosFormat = ComponentFormat::Float;
+    vat.g0.PosElements = CoordComponentCount::XYZ;
+    m_loader = VertexLoaderBase::CreateVertexLoader(vtx_desc, vat);
+
+    // Clip space is the same as object space: the visible area is -1 to 1 in x and y.
+    g_main_cp_state.matrix_index_a.PosNormalMtxIdx = 0;
+    std::memset(xfmem.posMatrices, 0, sizeof(xfmem.posMatrices));
+    xfmem.posMatrices[0] = 1.0f;
+    xfmem.posMatrices[5] = 1.0f;
+    xfmem.posMatrices[10] = 1.0f;
+    xfmem.projection.type = ProjectionType::Orthographic;
+    xfmem.projection.rawProjection = {1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f};
+    xfmem.viewport.ht = -1.0f;
+    Core::System::GetInstance().GetXFStateManager().SetProjectionChanged();
+
+    m_cull.Init();
+  }
+
+  std::vector<u8> MakeVertices(const Triangles& triangles) const
+  {
+    const u32 stride = m_loader->m_native_vtx_decl.stride;
+    std::vector<u8> vertices(triangles.size() * 3 * stride);
+    u8* dst = vertices.data();
+    for (const Triangle& triangle : triangles)
+    {
+      const std::array<std::array<float, 3>, 3> positions = {{
+          {triangle.x, triangle.y, 0.0f},
+          {triangle.x + triangle.size, triangle.y, 0.0f},
+          {triangle.x, triangle.y + triangle.size, 0.0f},
+      }};
+      for (const auto& position : positions)
+      {
+        std::memcpy(dst, position.data(), sizeof(position));
+        dst += stride;
+      }
+    }
+    return vertices;
+  }
+
+  // Checks that testing the bounding box first doesn't change which batches are culled, and
+  // returns whether the batch is culled.
+  bool IsCulled(const Triangles& triangles, CullMode cull_mode)
+  {
+    const std::vector<u8> vertices = MakeVertices(triangles);
+    const u32 count = NUM_TRIANGLES * 3;
+    bpmem.genMode.cull_mode = cull_mode;
+
+    m_cull.m_bounds_test_enabled = false;
+    const bool culled = m_cull.AreAllVerticesCulled(
+        m_loader.get(), OpcodeDecoder::Primitive::GX_DRAW_TRIANGLES, vertices.data(), count);
+    m_cull.m_bounds_test_enabled = true;
+    const bool culled_by_bounds = m_cull.AreAllVerticesCulled(
+        m_loader.get(), OpcodeDecoder::Primitive::GX_DRAW_TRIANGLES, vertices.data(), count);
+
+    EXPECT_EQ(culled, culled_by_bounds) << "cull mode " << static_cast<int>(cull_mode);
+    return culled;
+  }
+
+  std::unique_ptr<VertexLoaderBase> m_loader;
+  TestCPUCull m_cull;
+};
+
+TEST_F(CPUCullTest, Inside)
+{
+  const auto triangles = MakeTriangles(-0.5f, -0.5f, 0.1f, 0.2f);
+  EXPECT_FALSE(IsCulled(triangles, CullMode::None));
+  IsCulled(triangles, CullMode::Back);
+  IsCulled(triangles, CullMode::Front);
+  EXPECT_TRUE(IsCulled(triangles, CullMode::All));
+
+  auto flipped = triangles;
+  for (Triangle& triangle : flipped)
+    triangle.size = -triangle.size;
+  EXPECT_NE(IsCulled(triangles, CullMode::Back), IsCulled(flipped, CullMode::Back));
+  EXPECT_NE(IsCulled(triangles, CullMode::Front), IsCulled(flipped, CullMode::Front));
+}
+
+TEST_F(CPUCullTest, InsideWithMixedWinding)
+{
+  auto triangles = MakeTriangles(-0.5f, -0.5f, 0.1f, 0.2f);
+  triangles[3].size = -triangles[3].size;
+  for (const CullMode cull_mode : {CullMode::None, CullMode::Back, CullMode::Front})
+    EXPECT_FALSE(IsCulled(triangles, cull_mode));
+}
+
+TEST_F(CPUCullTest, Outside)
+{
+  for (const auto& triangles :
+       {MakeTriangles(2.0f, -0.5f, 0.1f, 0.2f), MakeTriangles(-3.0f, -0.5f, 0.1f, 0.2f),
+        MakeTriangles(-0.5f, 2.0f, 0.1f, 0.2f), MakeTriangles(-0.5f, -3.0f, 0.1f, 0.2f)})
+  {
+    for (const CullMode cull_mode :
+         {CullMode::None, CullMode::Back, CullMode::Front, CullMode::All})
+    {
+      EXPECT_TRUE(IsCulled(triangles, cull_mode));
+    }
+  }
+}
+
+TEST_F(CPUCullTest, CrossingEdge)
+{
+  // Only some of the triangles are visible
+  const auto partly_visible = MakeTriangles(0.5f, -0.5f, 0.1f, 0.3f);
+  // Triangles around the visible area, two of them inside of it
+  const auto around = MakeTriangles(-2.0f, -2.0f, 0.1f, 1.2f);
+  // The bounding box contains the visible area, but every triangle is outside of one of its edges
+  auto split = MakeTriangles(2.0f, -0.5f, 0.1f, 0.2f);
+  for (int i = 0; i < NUM_TRIANGLES / 2; i++)
+    split[i].x = -split[i].x;
+
+  for (const CullMode cull_mode : {CullMode::None, CullMode::Back, CullMode::Front, CullMode::All})
+  {
+    IsCulled(partly_visible, cull_mode);
+    IsCulled(around, cull_mode);
+    EXPECT_TRUE(IsCulled(split, cull_mode));
+  }
+  EXPECT_FALSE(IsCulled(partly_visible, CullMode::None));
+  EXPECT_FALSE(IsCulled(around, CullMode::None));
+}
@@ -0,0 +1,153 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Core/HW/Memmap.h"
+#include "Core/System.h"
+#include "VideoCommon/CPMemory.h"
+#include "VideoCommon/DisplayListCache.h"
+#include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/VertexLoaderBase.h"
+
+class DisplayListCacheTest : public testing::Test
+{
+protected:
+  static constexpr u32 NUM_VERTICES = 3;
+  static constexpr u32 STRIDE = 12;
+
+  void SetUp() override
+  {
+    Core::System::GetInstance().GetMemory().Init();
+
+    m_vtx_desc.low.Hex = 0;
+    m_vtx_desc.high.Hex = 0;
+    m_vtx_desc.low.Position = VertexComponentFormat::Direct;
+    m_vat.g0.Hex = 0;
+    m_vat.g1.Hex = 0;
+    m_vat.g2.Hex = 0;
+    m_vat.g0.PosFormat = ComponentFormat::Float;
+    m_vat.g0.PosElements = CoordComponentCount::XYZ;
+    m_loader = VertexLoaderBase::CreateVertexLoader(m_vtx_desc, m_vat);
+    ASSERT_EQ(STRIDE, m_loader->m_vertex_size);
+  }
+
+  void TearDown() override { Core::System::GetInstance().GetMemory().Shutdown(); }
+
+  DisplayListCache::Key MakeKey(u32 address) const
+  {
+    return {address, NUM_VERTICES, m_loader.get(), OpcodeDecoder::Primitive::GX_DRAW_TRIANGLES};
+  }
+
+  void WriteVertices(u32 address, u8 value)
+  {
+    std::array<u8, NUM_VERTICES * STRIDE> data;
+    data.fill(value);
+    Core::System::GetInstance().GetMemory().CopyToEmu(address, data.data(), data.size());
+  }
+
+  const DisplayListCache::Entry* Lookup(u32 address, DisplayListCache::Entry** new_entry)
+  {
+    const u8* src =
+        Core::System::GetInstance().GetMemory().GetPointerForRange(address, NUM_VERTICES * STRIDE);
+    return m_cache.Lookup(MakeKey(address), src, m_vtx_desc, m_vat, new_entry);
+  }
+
+  // Does what VertexLoaderManager does for a new entry whose vertices could all be loaded.
+  void LoadAndStore(DisplayListCache::Entry* entry)
+  {
+    entry->vertices.resize(NUM_VERTICES * STRIDE + 4);
+    m_cache.Store(entry, NUM_VERTICES, STRIDE, std::vector<u16>{0, 1, 2});
+  }
+
+  TVtxDesc m_vtx_desc;
+  VAT m_vat;
+  std::unique_ptr<VertexLoaderBase> m_loader;
+  DisplayListCache m_cache;
+};
+
+TEST_F(DisplayListCacheTest, HitAfterStore)
+{
+  WriteVertices(0x1000, 1);
+
+  DisplayListCache::Entry* new_entry;
+  EXPECT_EQ(nullptr, Lookup(0x1000, &new_entry));
+  ASSERT_NE(nullptr, new_entry);
+  LoadAndStore(new_entry);
+  EXPECT_EQ(NUM_VERTICES * STRIDE + 3 * sizeof(u16), m_cache.GetSize());
+
+  const DisplayListCache::Entry* cached = Lookup(0x1000, &new_entry);
+  ASSERT_NE(nullptr, cached);
+  EXPECT_EQ(nullptr, new_entry);
+  EXPECT_EQ(NUM_VERTICES, cached->num_vertices);
+  EXPECT_EQ((std::vector<u16>{0, 1, 2}), cached->indices);
+}
+
+TEST_F(DisplayListCacheTest, ChangedDataInvalidates)
+{
+  WriteVertices(0x1000, 1);
+
+  DisplayListCache::Entry* new_entry;
+  Lookup(0x1000, &new_entry);
+  ASSERT_NE(nullptr, new_entry);
+  LoadAndStore(new_entry);
+
+  WriteVertices(0x1000, 2);
+  EXPECT_EQ(nullptr, Lookup(0x1000, &new_entry));
+  ASSERT_NE(nullptr, new_entry);
+  EXPECT_EQ(0u, m_cache.GetSize());
+
+  LoadAndStore(new_entry);
+  EXPECT_NE(nullptr, Lookup(0x1000, &new_entry));
+}
+
+TEST_F(DisplayListCacheTest, DataThatKeepsChangingIsNotCached)
+{
+  DisplayListCache::Entry* new_entry;
+  for (u8 i = 0; i < 3; i++)
+  {
+    WriteVertices(0x1000, i);
+    Lookup(0x1000, &new_entry);
+    ASSERT_NE(nullptr, new_entry);
+    LoadAndStore(new_entry);
+  }
+
+  WriteVertices(0x1000, 3);
+  EXPECT_EQ(nullptr, Lookup(0x1000, &new_entry));
+  EXPECT_EQ(nullptr, new_entry);
+  EXPECT_EQ(0u, m_cache.GetSize());
+}
+
+TEST_F(DisplayListCacheTest, EntryThatIsNeverStoredIsNotCounted)
+{
+  WriteVertices(0x1000, 1);
+  WriteVertices(0x2000, 1);
+  WriteVertices(0x3000, 1);
+
+  DisplayListCache::Entry* new_entry;
+  Lookup(0x1000, &new_entry);
+  ASSERT_NE(nullptr, new_entry);
+  LoadAndStore(new_entry);
+  const size_t stored_size = m_cache.GetSize();
+
+  // Like a draw with skipped vertices: the vertices are loaded, but the entry isn't stored.
+  Lookup(0x2000, &new_entry);
+  ASSERT_NE(nullptr, new_entry);
+  new_entry->vertices.resize(NUM_VERTICES * STRIDE + 4);
+  EXPECT_EQ(stored_size, m_cache.GetSize());
+
+  // The draw isn't cached the next time either, and its vertices are freed.
+  EXPECT_EQ(nullptr, Lookup(0x2000, &new_entry));
+  EXPECT_EQ(nullptr, new_entry);
+  EXPECT_EQ(stored_size, m_cache.GetSize());
+
+  // A new draw doesn't make the cache start over.
+  Lookup(0x3000, &new_entry);
+  EXPECT_NE(nullptr, new_entry);
+  EXPECT_NE(nullptr, Lookup(0x1000, &new_entry));
+}
@@ -0,0 +1,84 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/BPMemory.h"
+#include "VideoCommon/BPStructs.h"
+#include "VideoCommon/XFMemory.h"
+#include "VideoCommon/XFStructs.h"
+
+namespace
+{
+u32 ReadXF(u32 address)
+{
+  return reinterpret_cast<const u32*>(&xfmem)[address];
+}
+}  // namespace
+
+TEST(FlushDeferral, EFBCopyAndClearRegistersDefer)
+{
+  for (const u32 address :
+       {u32(BPMEM_EFB_TL), u32(BPMEM_EFB_WH), u32(BPMEM_EFB_ADDR), u32(BPMEM_EFB_STRIDE),
+        u32(BPMEM_COPYYSCALE), u32(BPMEM_CLEAR_AR), u32(BPMEM_CLEAR_GB), u32(BPMEM_CLEAR_Z),
+        u32(BPMEM_COPYFILTER0), u32(BPMEM_COPYFILTER1), u32(BPMEM_PRELOAD_ADDR)})
+  {
+    EXPECT_TRUE(IsDrawIndependentBPRegister(address)) << "BP register " << address;
+  }
+}
+
+TEST(FlushDeferral, DrawStateRegistersFlush)
+{
+  // The copy trigger itself needs the queued vertices to be drawn into the EFB first.
+  for (const u32 address :
+       {u32(BPMEM_GENMODE), u32(BPMEM_SCISSORTL), u32(BPMEM_ZMODE), u32(BPMEM_TEV_COLOR_ENV),
+        u32(BPMEM_TRIGGER_EFB_COPY), u32(BPMEM_LOADTLUT1)})
+  {
+    EXPECT_FALSE(IsDrawIndependentBPRegister(address)) << "BP register " << address;
+  }
+}
+
+TEST(FlushDeferral, UnchangedXFMemoryDefers)
+{
+  std::memset(&xfmem, 0, sizeof(xfmem));
+  xfmem.posMatrices[4] = 1.0f;
+  xfmem.lights[0].cosatt[0] = 1.0f;
+
+  for (const u32 address : {u32(XFMEM_POSMATRICES + 4), u32(XFMEM_POSMATRICES + 5),
+                            u32(XFMEM_LIGHTS + 3), u32(XFMEM_LIGHTS + 4)})
+  {
+    EXPECT_TRUE(IsRedundantXFWrite(address, ReadXF(address))) << "XF address " << address;
+    EXPECT_FALSE(IsRedundantXFWrite(address, ReadXF(address) ^ 1)) << "XF address " << address;
+  }
+}
+
+TEST(FlushDeferral, UnchangedXFRegistersDefer)
+{
+  std::memset(&xfmem, 0, sizeof(xfmem));
+  xfmem.viewport.wd = 320.0f;
+  xfmem.projection.rawProjection[0] = 1.0f;
+
+  for (const u32 address :
+       {u32(XFMEM_SETVIEWPORT), u32(XFMEM_SETVIEWPORT + 5), u32(XFMEM_SETPROJECTION),
+        u32(XFMEM_SETPROJECTION + 6), u32(XFMEM_SETTEXMTXINFO + 7), u32(XFMEM_SETPOSTMTXINFO)})
+  {
+    EXPECT_TRUE(IsRedundantXFWrite(address, ReadXF(address))) << "XF register " << address;
+    EXPECT_FALSE(IsRedundantXFWrite(address, ReadXF(address) ^ 1)) << "XF register " << address;
+  }
+}
+
+TEST(FlushDeferral, OtherXFRegistersAreHandledByTheirWrite)
+{
+  // These registers decide for themselves whether to flush, so they are never deferred.
+  std::memset(&xfmem, 0, sizeof(xfmem));
+  for (const u32 address :
+       {u32(XFMEM_SETNUMCHAN), u32(XFMEM_SETCHAN0_COLOR), u32(XFMEM_SETMATRIXINDA),
+        u32(XFMEM_SETNUMTEXGENS), u32(XFMEM_DUALTEX), u32(XFMEM_UNKNOWN_GROUP_2_START),
+        u32(XFMEM_UNKNOWN_GROUP_3_START)})
+  {
+    EXPECT_FALSE(IsRedundantXFWrite(address, ReadXF(address))) << "XF register " << address;
+  }
+}
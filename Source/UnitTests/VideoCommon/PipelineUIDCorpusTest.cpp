@@ -0,0 +1,145 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "VideoCommon/PipelineUIDCorpus.h"
+
+using VideoCommon::PipelineUIDCorpus;
+using VideoCommon::SerializedGXPipelineUid;
+
+namespace
+{
+SerializedGXPipelineUid MakeUID(u32 id)
+{
+  SerializedGXPipelineUid uid;
+  uid.rasterization_state_bits = id;
+  return uid;
+}
+
+std::vector<SerializedGXPipelineUid> MakeUIDs(const std::vector<u32>& ids)
+{
+  std::vector<SerializedGXPipelineUid> uids;
+  for (const u32 id : ids)
+    uids.push_back(MakeUID(id));
+  return uids;
+}
+
+std::vector<u32> GetIDs(const PipelineUIDCorpus& corpus)
+{
+  std::vector<u32> ids;
+  for (const PipelineUIDCorpus::Entry& entry : corpus.GetEntries())
+    ids.push_back(entry.uid.rasterization_state_bits);
+  return ids;
+}
+
+class PipelineUIDCorpusTest : public testing::Test
+{
+protected:
+  PipelineUIDCorpusTest() : m_directory(File::CreateTempDir()) {}
+
+  ~PipelineUIDCorpusTest() override
+  {
+    if (!m_directory.empty())
+      File::DeleteDirRecursively(m_directory);
+  }
+
+  void SetUp() override
+  {
+    if (m_directory.empty())
+      FAIL();
+  }
+
+  const std::string m_directory;
+};
+}  // namespace
+
+TEST(PipelineUIDCorpus, OrdersByOccurrencesAndPosition)
+{
+  PipelineUIDCorpus corpus;
+  corpus.AddUIDCache(MakeUIDs({1, 2, 3}));
+  corpus.AddUIDCache(MakeUIDs({3, 1, 3}));
+  corpus.AddUIDCache(MakeUIDs({4, 1}));
+
+  // 1 is in every cache, 3 in two of them, and 4 is added before 2.
+  EXPECT_EQ((std::vector<u32>{1, 3, 4, 2}), GetIDs(corpus));
+  EXPECT_EQ(3u, corpus.GetSourceCount());
+
+  const std::vector<PipelineUIDCorpus::Entry> entries = corpus.GetEntries();
+  EXPECT_EQ(3u, entries[0].occurrences);
+  EXPECT_EQ(2u, entries[1].occurrences);
+  EXPECT_EQ(0u, entries[2].position);
+  EXPECT_EQ(PipelineUIDCorpus::POSITION_SCALE / 2, entries[3].position);
+}
+
+TEST(PipelineUIDCorpus, MergesCorpora)
+{
+  const std::vector<std::vector<u32>> caches = {{5, 6, 7}, {7, 8}, {8, 5, 9}, {6}, {9, 7, 5, 8}};
+
+  PipelineUIDCorpus all;
+  PipelineUIDCorpus first;
+  PipelineUIDCorpus second;
+  for (size_t i = 0; i < caches.size(); i++)
+  {
+    all.AddUIDCache(MakeUIDs(caches[i]));
+    (i < 2 ? first : second).AddUIDCache(MakeUIDs(caches[i]));
+  }
+  first.SetRevision(3);
+  second.SetRevision(7);
+  first.AddCorpus(second);
+
+  EXPECT_EQ(GetIDs(all), GetIDs(first));
+  EXPECT_EQ(all.GetSourceCount(), first.GetSourceCount());
+  EXPECT_EQ(7u, first.GetRevision());
+}
+
+TEST_F(PipelineUIDCorpusTest, SavesAndLoads)
+{
+  const std::string path = m_directory + "/GAMEID.uidcorpus";
+
+  PipelineUIDCorpus corpus;
+  corpus.AddUIDCache(MakeUIDs({10, 11, 12, 13}));
+  corpus.AddUIDCache(MakeUIDs({13, 12}));
+  corpus.SetRevision(2);
+  ASSERT_TRUE(corpus.Save(path));
+
+  const std::optional<PipelineUIDCorpus> loaded = PipelineUIDCorpus::Load(path);
+  ASSERT_TRUE(loaded.has_value());
+  EXPECT_EQ(GetIDs(corpus), GetIDs(*loaded));
+  EXPECT_EQ(2u, loaded->GetSourceCount());
+  EXPECT_EQ(2u, loaded->GetRevision());
+
+  // A corpus isn't a UID cache, and a cut off corpus isn't loaded.
+  EXPECT_FALSE(VideoCommon::ReadPipelineUIDCache(path).has_value());
+  ASSERT_TRUE(File::IOFile(path, "r+b").Resize(File::GetSize(path) - 1));
+  EXPECT_FALSE(PipelineUIDCorpus::Load(path).has_value());
+  EXPECT_FALSE(PipelineUIDCorpus::Load(m_directory + "/missing.uidcorpus").has_value());
+}
+
+TEST_F(PipelineUIDCorpusTest, ReadsUIDCache)
+{
+  const std::string path = m_directory + "/GAMEID.uidcache";
+  const std::vector<SerializedGXPipelineUid> uids = MakeUIDs({20, 21, 22});
+
+  // The header that ShaderCache writes, followed by the UIDs and part of another one.
+  {
+    File::IOFile file(path, "wb");
+    const u32 header[] = {0x44495550, VideoCommon::GX_PIPELINE_UID_VERSION};
+    ASSERT_TRUE(file.WriteArray(header, 2));
+    ASSERT_TRUE(file.WriteArray(uids.data(), uids.size()));
+    ASSERT_TRUE(file.WriteBytes(&uids[0], 5));
+  }
+
+  const std::optional<std::vector<SerializedGXPipelineUid>> read =
+      VideoCommon::ReadPipelineUIDCache(path);
+  ASSERT_TRUE(read.has_value());
+  ASSERT_EQ(3u, read->size());
+  EXPECT_EQ(22u, (*read)[2].rasterization_state_bits);
+  EXPECT_FALSE(PipelineUIDCorpus::Load(path).has_value());
+}
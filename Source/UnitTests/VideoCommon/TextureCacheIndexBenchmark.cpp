@@ -0,0 +1,140 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureCacheIndex.h"
+
+namespace
+{
+// Counts the bytes that a container allocates.
+size_t s_allocated_bytes = 0;
+
+template <typename T>
+struct CountingAllocator
+{
+  using value_type = T;
+
+  CountingAllocator() = default;
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U>&)
+  {
+  }
+
+  T* allocate(size_t n)
+  {
+    s_allocated_bytes += n * sizeof(T);
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T* p, size_t n)
+  {
+    s_allocated_bytes -= n * sizeof(T);
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  template <typename U>
+  bool operator==(const CountingAllocator<U>&) const
+  {
+    return true;
+  }
+};
+
+// Stand-in for a texture cache entry, with the fields that GetTexture compares.
+struct Entry
+{
+  TextureCacheKey key;
+  u32 levels;
+};
+}  // namespace
+
+// Compares looking up textures which are in the cache with the index and with a scan over a
+// multimap by address, which is how the texture cache looked them up before, as well as the memory
+// both take.
+TEST(TextureCacheIndexBenchmark, Lookup)
+{
+  constexpr u32 iterations = 200;
+
+  fmt::print("{:>8} {:>14} {:>14} {:>12} {:>12} {:>8}\n", "textures", "multimap", "index",
+             "multimap mem", "index mem", "probes");
+  for (const u32 num_textures : {100, 500, 2000, 8000})
+  {
+    // Like in games, most addresses hold one texture, and some hold a few.
+    std::mt19937 rng(num_textures);
+    std::vector<Entry> entries(num_textures);
+    for (u32 i = 0; i < num_textures; i++)
+    {
+      Entry& entry = entries[i];
+      const u32 address = 0x80000000 + (i % 8 == 7 ? i - 1 : i) * 0x800;
+      entry.key = {address, static_cast<u32>(rng() % 14), 8u << (rng() % 7), 8u << (rng() % 7),
+                   (u64{rng()} << 32) | rng()};
+      entry.levels = 1 + rng() % 4;
+    }
+
+    using Multimap =
+        std::multimap<u32, Entry*, std::less<u32>, CountingAllocator<std::pair<const u32, Entry*>>>;
+    s_allocated_bytes = 0;
+    auto multimap = std::make_unique<Multimap>();
+    for (Entry& entry : entries)
+      multimap->emplace(entry.key.address, &entry);
+    const size_t multimap_memory = s_allocated_bytes;
+
+    TextureCacheIndex<Entry*> index;
+    for (Entry& entry : entries)
+      index.Insert(entry.key, &entry);
+
+    std::vector<Entry*> lookups;
+    for (u32 i = 0; i < num_textures * 4; i++)
+      lookups.push_back(&entries[rng() % num_textures]);
+
+    const auto measure = [&](const auto& find) {
+      u32 found = 0;
+      const auto start = std::chrono::steady_clock::now();
+      for (u32 i = 0; i < iterations; i++)
+      {
+        for (const Entry* wanted : lookups)
+          found += find(*wanted) == wanted;
+      }
+      const auto end = std::chrono::steady_clock::now();
+      EXPECT_EQ(lookups.size() * iterations, found);
+      return std::chrono::duration<double, std::nano>(end - start).count() /
+             (lookups.size() * iterations);
+    };
+
+    const double multimap_time = measure([&](const Entry& wanted) -> Entry* {
+      const auto range = multimap->equal_range(wanted.key.address);
+      for (auto iter = range.first; iter != range.second; ++iter)
+      {
+        const Entry* entry = iter->second;
+        if (entry->key == wanted.key && entry->levels >= wanted.levels)
+          return iter->second;
+      }
+      return nullptr;
+    });
+
+    u64 probes = 0;
+    const double index_time = measure([&](const Entry& wanted) -> Entry* {
+      const auto result = index.FindIf(
+          wanted.key, [&](const Entry* entry) { return entry->levels >= wanted.levels; });
+      probes += result.probes;
+      return result.value ? *result.value : nullptr;
+    });
+
+    fmt::print("{:>8} {:>11.1f} ns {:>11.1f} ns {:>9} KiB {:>9} KiB {:>8.2f}\n", num_textures,
+               multimap_time, index_time, multimap_memory / 1024, index.GetMemoryUsage() / 1024,
+               static_cast<double>(probes) / (lookups.size() * iterations));
+
+    multimap.reset();
+  }
+}
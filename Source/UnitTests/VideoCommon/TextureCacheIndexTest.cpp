@@ -0,0 +1,115 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureCacheIndex.h"
+
+namespace
+{
+auto MakeTuple(const TextureCacheKey& key)
+{
+  return std::tie(key.address, key.format, key.width, key.height, key.hash);
+}
+
+struct KeyLess
+{
+  bool operator()(const TextureCacheKey& a, const TextureCacheKey& b) const
+  {
+    return MakeTuple(a) < MakeTuple(b);
+  }
+};
+
+// Few distinct values per field, so that there are plenty of duplicate keys and keys which only
+// differ in one field.
+TextureCacheKey RandomKey(std::mt19937& rng)
+{
+  std::uniform_int_distribution<u32> small(0, 3);
+  return {0x80000000 + small(rng) * 0x20, small(rng), 8u << small(rng), 8u << small(rng),
+          small(rng) * 0x123456789ULL};
+}
+}  // namespace
+
+TEST(TextureCacheIndex, MatchesMultimap)
+{
+  std::mt19937 rng(0x1dec);
+  TextureCacheIndex<int> index;
+  std::multimap<TextureCacheKey, int, KeyLess> reference;
+
+  for (int value = 0; value < 20000; value++)
+  {
+    const TextureCacheKey key = RandomKey(rng);
+    switch (rng() % 3)
+    {
+    case 0:
+      index.Insert(key, value);
+      reference.emplace(key, value);
+      break;
+
+    case 1:
+    {
+      // Remove a value which is stored under the key, if there is one.
+      const auto range = reference.equal_range(key);
+      if (range.first == range.second)
+      {
+        EXPECT_FALSE(index.Remove(key, -1));
+        break;
+      }
+      auto iter = range.first;
+      std::advance(iter, rng() % std::distance(range.first, range.second));
+      EXPECT_TRUE(index.Remove(key, iter->second));
+      reference.erase(iter);
+      break;
+    }
+
+    case 2:
+    {
+      // Every value under the key has to be found, and nothing else.
+      const auto range = reference.equal_range(key);
+      for (auto iter = range.first; iter != range.second; ++iter)
+      {
+        const auto result = index.FindIf(key, [&](int v) { return v == iter->second; });
+        ASSERT_NE(nullptr, result.value);
+        EXPECT_EQ(iter->second, *result.value);
+      }
+      EXPECT_EQ(nullptr, index.FindIf(key, [](int v) { return v < 0; }).value);
+      break;
+    }
+    }
+    ASSERT_EQ(reference.size(), index.Size());
+  }
+
+  for (auto iter = reference.begin(); iter != reference.end(); iter = reference.erase(iter))
+    EXPECT_TRUE(index.Remove(iter->first, iter->second));
+  EXPECT_EQ(0u, index.Size());
+  EXPECT_EQ(nullptr, index.FindIf(RandomKey(rng), [](int) { return true; }).value);
+}
+
+TEST(TextureCacheIndex, SizeBound)
+{
+  TextureSizeBound bound;
+  EXPECT_EQ(0u, bound.GetMaxSize());
+
+  bound.Add(0x1000);
+  bound.Add(0x30);
+  EXPECT_LE(0x1000u, bound.GetMaxSize());
+  EXPECT_GT(0x2000u, bound.GetMaxSize());
+
+  bound.Add(0x4000000);
+  EXPECT_LE(0x4000000u, bound.GetMaxSize());
+  bound.Remove(0x4000000);
+  EXPECT_GT(0x2000u, bound.GetMaxSize());
+
+  bound.Remove(0x1000);
+  EXPECT_LE(0x30u, bound.GetMaxSize());
+  EXPECT_GT(0x40u, bound.GetMaxSize());
+
+  bound.Add(0xFFFFFFFF);
+  EXPECT_EQ(0xFFFFFFFFu, bound.GetMaxSize());
+}
@@ -0,0 +1,72 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureDecoder.h"
+#include "VideoCommon/TextureDecoderPool.h"
+
+#include "TextureDecoderTestUtil.h"
+
+// Measures how long decoding a 1024x1024 texture with mipmaps takes with every texture format,
+// serially with each supported instruction set and with the decoding threads.
+TEST(TextureDecoderBenchmark, Decode)
+{
+  constexpr u32 iterations = 50;
+
+  std::mt19937 rng(1);
+  std::vector<u8> tlut(TLUT_SIZE);
+  for (u8& byte : tlut)
+    byte = static_cast<u8>(rng());
+
+  TextureDecoderPool pool;
+  pool.SetThreadCount(std::max(std::thread::hardware_concurrency() / 2, 2u));
+
+  const std::vector<TexDecoderISA> isas = TexDecoder_GetSupportedISAs();
+  fmt::print("{:>12}", "format");
+  for (const TexDecoderISA isa : isas)
+    fmt::print(" {:>10}", fmt::format("{:n}", isa));
+  fmt::print(" {:>10} ({} threads)\n", "parallel", pool.GetThreadCount());
+
+  for (const TextureFormat format : ALL_FORMATS)
+  {
+    const std::vector<Level> levels = MakeMipChain(1024, 1024, format, rng);
+    std::vector<u8> dst(GetDecodedSize(levels));
+
+    const auto measure = [&](const auto& decode) {
+      const auto start = std::chrono::steady_clock::now();
+      for (u32 i = 0; i < iterations; i++)
+        decode();
+      const auto end = std::chrono::steady_clock::now();
+      return std::chrono::duration<double, std::micro>(end - start).count() / iterations;
+    };
+
+    fmt::print("{:>12}", fmt::format("{:n}", format));
+    for (const TexDecoderISA isa : isas)
+    {
+      const double serial = measure([&] {
+        u8* level_dst = dst.data();
+        for (const Level& level : levels)
+        {
+          _TexDecoder_DecodeImplWithISA(isa, reinterpret_cast<u32*>(level_dst), level.data.data(),
+                                        level.width, level.height, format, tlut.data(),
+                                        GetTlutFormat(format));
+          level_dst += static_cast<size_t>(level.width) * level.height * sizeof(u32);
+        }
+      });
+      fmt::print(" {:>7.0f} us", serial);
+    }
+    const double parallel =
+        measure([&] { DecodeInParallel(pool, dst.data(), levels, format, tlut.data()); });
+    fmt::print(" {:>7.0f} us\n", parallel);
+  }
+}
@@ -0,0 +1,87 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureDecoder.h"
+#include "VideoCommon/TextureDecoderPool.h"
+
+#include "TextureDecoderTestUtil.h"
+
+TEST(TextureDecoder, MatchesGeneric)
+{
+  std::mt19937 rng(0x7e0);
+  std::vector<u8> tlut(TLUT_SIZE);
+
+  for (const TexDecoderISA isa : TexDecoder_GetSupportedISAs())
+  {
+    for (const TextureFormat format : ALL_FORMATS)
+    {
+      for (const TLUTFormat tlut_format : {TLUTFormat::IA8, TLUTFormat::RGB565, TLUTFormat::RGB5A3})
+      {
+        if (!IsColorIndexed(format) && tlut_format != TLUTFormat::IA8)
+          continue;
+
+        SCOPED_TRACE(fmt::format("{}, {}, {}", isa, format, tlut_format));
+        for (u8& byte : tlut)
+          byte = static_cast<u8>(rng());
+
+        // A single block, and sizes with an odd number of blocks.
+        for (const Level& level : MakeMipChain(72, 40, format, rng))
+        {
+          std::vector<u32> expected(level.width * level.height, 0);
+          std::vector<u32> actual(level.width * level.height, 0xffffffff);
+          _TexDecoder_DecodeImplGeneric(expected.data(), level.data.data(), level.width,
+                                        level.height, format, tlut.data(), tlut_format);
+          _TexDecoder_DecodeImplWithISA(isa, actual.data(), level.data.data(), level.width,
+                                        level.height, format, tlut.data(), tlut_format);
+
+          EXPECT_TRUE(expected == actual) << level.width << "x" << level.height;
+        }
+      }
+    }
+  }
+}
+
+TEST(TextureDecoder, ParallelMatchesSerial)
+{
+  std::mt19937 rng(0xdec0de);
+  std::vector<u8> tlut(TLUT_SIZE);
+  for (u8& byte : tlut)
+    byte = static_cast<u8>(rng());
+
+  TextureDecoderPool pool;
+  for (const u32 threads : {1, 3, 4})
+  {
+    pool.SetThreadCount(threads);
+    EXPECT_EQ(threads, pool.GetThreadCount());
+
+    for (const TextureFormat format : ALL_FORMATS)
+    {
+      // Sizes which split into several bands, with and without a remainder, as well as textures
+      // that are too small to be split.
+      for (const auto& [width, height] : {std::pair{1024, 1024}, {528, 328}, {16, 8}})
+      {
+        SCOPED_TRACE(fmt::format("{} threads, {} {}x{}", threads, format, width, height));
+        const std::vector<Level> levels = MakeMipChain(width, height, format, rng);
+
+        // Fill the outputs differently, so that any pixel that isn't written shows up.
+        std::vector<u8> expected(GetDecodedSize(levels), 0x00);
+        std::vector<u8> actual(GetDecodedSize(levels), 0xff);
+        DecodeSerially(expected.data(), levels, format, tlut.data());
+        DecodeInParallel(pool, actual.data(), levels, format, tlut.data());
+
+        EXPECT_TRUE(expected == actual);
+      }
+    }
+  }
+}
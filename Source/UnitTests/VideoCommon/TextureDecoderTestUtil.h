@@ -0,0 +1,92 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureDecoder.h"
+#include "VideoCommon/TextureDecoderPool.h"
+
+constexpr std::array<TextureFormat, 12> ALL_FORMATS = {
+    TextureFormat::I4,     TextureFormat::I8,     TextureFormat::IA4,   TextureFormat::IA8,
+    TextureFormat::RGB565, TextureFormat::RGB5A3, TextureFormat::RGBA8, TextureFormat::C4,
+    TextureFormat::C8,     TextureFormat::C14X2,  TextureFormat::CMPR,  TextureFormat::XFB,
+};
+
+// Large enough for the 14-bit indices of C14X2.
+constexpr u32 TLUT_SIZE = (1 << 14) * sizeof(u16);
+
+struct Level
+{
+  int width;
+  int height;
+  std::vector<u8> data;
+};
+
+// Returns a mip chain down to 1x1, filled with random texture data. Like in the texture cache, the
+// size of each level is expanded to whole blocks.
+inline std::vector<Level> MakeMipChain(int width, int height, TextureFormat format,
+                                       std::mt19937& rng)
+{
+  const int block_width = TexDecoder_GetBlockWidthInTexels(format);
+  const int block_height = TexDecoder_GetBlockHeightInTexels(format);
+
+  std::vector<Level> levels;
+  while (width > 0 && height > 0)
+  {
+    Level& level = levels.emplace_back();
+    level.width = (width + block_width - 1) / block_width * block_width;
+    level.height = (height + block_height - 1) / block_height * block_height;
+    level.data.resize(TexDecoder_GetTextureSizeInBytes(level.width, level.height, format));
+    for (u8& byte : level.data)
+      byte = static_cast<u8>(rng());
+
+    if (width == 1 && height == 1)
+      break;
+    width = std::max(width / 2, 1);
+    height = std::max(height / 2, 1);
+  }
+  return levels;
+}
+
+inline size_t GetDecodedSize(const std::vector<Level>& levels)
+{
+  size_t size = 0;
+  for (const Level& level : levels)
+    size += static_cast<size_t>(level.width) * level.height * sizeof(u32);
+  return size;
+}
+
+inline TLUTFormat GetTlutFormat(TextureFormat format)
+{
+  return static_cast<TLUTFormat>(static_cast<u32>(format) % 3);
+}
+
+inline void DecodeSerially(u8* dst, const std::vector<Level>& levels, TextureFormat format,
+                           const u8* tlut)
+{
+  for (const Level& level : levels)
+  {
+    TexDecoder_Decode(dst, level.data.data(), level.width, level.height, format, tlut,
+                      GetTlutFormat(format));
+    dst += static_cast<size_t>(level.width) * level.height * sizeof(u32);
+  }
+}
+
+inline void DecodeInParallel(TextureDecoderPool& pool, u8* dst,
+                             const std::vector<Level>& levels, TextureFormat format,
+                             const u8* tlut)
+{
+  for (const Level& level : levels)
+  {
+    pool.Add(dst, level.data.data(), level.width, level.height, format, tlut,
+             GetTlutFormat(format));
+    dst += static_cast<size_t>(level.width) * level.height * sizeof(u32);
+  }
+  pool.Run();
+}